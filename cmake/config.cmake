@@ -201,6 +201,13 @@ if(OMR_THR_YIELD_ALG)
 endif()
 # TODO set to disabled. Stuff fails to compile when its on
 set(OMR_THR_MCS_LOCKS OFF CACHE BOOL "Enable the usage of the MCS lock in the OMR thread monitor.")
+set(OMR_THR_FUTEX_LOCKS OFF CACHE BOOL "Block contended OMR thread monitor entries on a futex on the monitor's lock word.")
+if(OMR_THR_FUTEX_LOCKS)
+	omr_assert(FATAL_ERROR
+		TEST OMR_OS_LINUX AND OMR_THR_THREE_TIER_LOCKING AND NOT OMR_THR_MCS_LOCKS
+		MESSAGE "OMR_THR_FUTEX_LOCKS requires Linux and OMR_THR_THREE_TIER_LOCKING, and cannot be combined with OMR_THR_MCS_LOCKS"
+	)
+endif()
 
 #TODO this should maybe be a OMRTHREAD_LIB string variable?
 set(OMRTHREAD_WIN32_DEFAULT OFF)
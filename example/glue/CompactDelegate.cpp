@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omr.h"
+#include "omrhashtable.h"
+
+#include "CompactDelegate.hpp"
+#include "CompactScheme.hpp"
+#include "EnvironmentBase.hpp"
+#include "omrExampleVM.hpp"
+#include "OMRVMThreadListIterator.hpp"
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+
+void
+MM_CompactDelegate::fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme)
+{
+	if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+		OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+		J9HashTableState state;
+
+		if (NULL != omrVM->rootTable) {
+			RootEntry *rootEntry = (RootEntry *)hashTableStartDo(omrVM->rootTable, &state);
+			while (NULL != rootEntry) {
+				rootEntry->rootPtr = compactScheme->getForwardingPtr(rootEntry->rootPtr);
+				rootEntry = (RootEntry *)hashTableNextDo(&state);
+			}
+		}
+
+		/* the object table is keyed by name, so entries can be updated in place */
+		if (NULL != omrVM->objectTable) {
+			ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(omrVM->objectTable, &state);
+			while (NULL != objectEntry) {
+				objectEntry->objPtr = compactScheme->getForwardingPtr(objectEntry->objPtr);
+				objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+			}
+		}
+
+		OMR_VMThread *walkThread = NULL;
+		GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+		while (NULL != (walkThread = threadListIterator.nextOMRVMThread())) {
+			walkThread->_savedObject1 = (void *)compactScheme->getForwardingPtr((omrobjectptr_t)walkThread->_savedObject1);
+			walkThread->_savedObject2 = (void *)compactScheme->getForwardingPtr((omrobjectptr_t)walkThread->_savedObject2);
+		}
+	}
+}
+
+#endif /* OMR_GC_MODRON_COMPACTION */
@@ -77,8 +77,11 @@ public:
 	void
 	verifyHeap(MM_EnvironmentBase *env, MM_MarkMap *markMap) { }
 
-	void
-	fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme) { }
+	/**
+	 * Update the root table, the object table and the thread saved objects to the new object locations.
+	 * Called by all GC threads after the heap has been fixed up.
+	 */
+	void fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme);
 
 	void
 	workerCleanupAfterGC(MM_EnvironmentBase *env) { }
@@ -134,7 +134,9 @@ public:
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	OMR_SizeClasses *getSegregatedSizeClasses(MM_EnvironmentBase *env)
 	{
-		return NULL;
+		/* MM_SizeClasses fills in the SMALL_SIZECLASSES distribution when the heap is created */
+		static OMR_SizeClasses sizeClasses;
+		return &sizeClasses;
 	}
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
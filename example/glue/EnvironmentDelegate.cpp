@@ -50,6 +50,14 @@ MM_EnvironmentDelegate::detachVMThread(OMR_VM *omrVM, OMR_VMThread *omrVMThread,
 	}
 }
 
+bool
+MM_EnvironmentDelegate::describeAllocationSite(uintptr_t allocationSite, char *buffer, uintptr_t bufferSize)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_env->getOmrVM());
+	omrstr_printf(buffer, bufferSize, "%s", (const char *)allocationSite);
+	return true;
+}
+
 void
 MM_EnvironmentDelegate::acquireVMAccess()
 {
@@ -163,6 +163,21 @@ public:
 	 */
 	bool objectAllocationNotify(omrobjectptr_t omrObject) { return true; }
 
+	/**
+	 * Describe a language allocation site (see MM_AllocateDescription::setAllocationSite) for allocation
+	 * profiles. The description is written as collapsed stack frames, outermost first and separated by ';'.
+	 * It is requested on the allocating thread the first time the thread is sampled at the site, so a
+	 * language may also walk the stack of the current thread here.
+	 *
+	 * In the example VM allocation sites are NUL terminated strings naming the allocating code.
+	 *
+	 * @param allocationSite the allocation site of the sampled allocation (never 0)
+	 * @param buffer the buffer to write the description to
+	 * @param bufferSize the size of buffer in bytes
+	 * @return true if the site was described, false if it is unknown
+	 */
+	bool describeAllocationSite(uintptr_t allocationSite, char *buffer, uintptr_t bufferSize);
+
 	/**
 	 * Acquire shared VM access. Threads must acquire VM access before accessing any OMR internal
 	 * structures such as the heap. Requests for VM access will be blocked if any other thread is
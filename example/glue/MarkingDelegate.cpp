@@ -23,9 +23,15 @@
 #include "omrhashtable.h"
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 #include "MarkingScheme.hpp"
 #include "omrExampleVM.hpp"
 #include "OMRVMThreadListIterator.hpp"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#include "SublistIterator.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 
 #include "MarkingDelegate.hpp"
 
@@ -68,4 +74,22 @@ MM_MarkingDelegate::mainCleanupAfterGC(MM_EnvironmentBase *env)
 		}
 		objEntry = (ObjectEntry *)hashTableNextDo(&state);
 	}
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/* Sweep reuses the memory of dead remembered objects, so the next scavenge must not scan them */
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->scavengerEnabled) {
+		MM_SublistPuddle *puddle = NULL;
+		GC_SublistIterator rememberedSetIterator(&extensions->rememberedSet);
+		while (NULL != (puddle = rememberedSetIterator.nextList())) {
+			omrobjectptr_t *slotPtr = NULL;
+			GC_SublistSlotIterator rememberedSetSlotIterator(puddle);
+			while (NULL != (slotPtr = (omrobjectptr_t *)rememberedSetSlotIterator.nextSlot())) {
+				if ((NULL != *slotPtr) && !_markingScheme->isMarked(*slotPtr)) {
+					rememberedSetSlotIterator.removeSlot();
+				}
+			}
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 }
@@ -69,9 +69,13 @@ public:
 
 	/**
 	 * Constructor.
+	 *
+	 * @param allocationSite NUL terminated string naming the allocating code, reported with allocation samples (may be NULL)
 	 */
-	MM_ObjectAllocationModel(MM_EnvironmentBase *env,  uintptr_t requiredSizeInBytes, uintptr_t allocateObjectFlags = 0)
+	MM_ObjectAllocationModel(MM_EnvironmentBase *env,  uintptr_t requiredSizeInBytes, uintptr_t allocateObjectFlags = 0, const char *allocationSite = NULL)
 		: MM_AllocateInitialization(env, allocation_category_example, requiredSizeInBytes, allocateObjectFlags)
-	{}
+	{
+		getAllocateDescription()->setAllocationSite((uintptr_t)allocationSite);
+	}
 };
 #endif /* OBJECTALLOCATIONMODEL_HPP_ */
@@ -119,6 +119,10 @@ static const PoolInputData poolParams[] = {
 	{"POOL_ALWAYS_KEEP_SORTED flag",						32,		10,		sizeof(uintptr_t),		0,		POOL_ALWAYS_KEEP_SORTED},
 	{"POOL_ROUND_TO_PAGE_SIZE flag",						32,		10,		sizeof(uintptr_t),		0,		POOL_ROUND_TO_PAGE_SIZE},
 	{"POOL_NEVER_FREE_PUDDLES flag",						32,		10,		sizeof(uintptr_t),		0,		POOL_NEVER_FREE_PUDDLES},
+	{"POOL_CONCURRENT flag - with 4-byte elements",			4,		100,	sizeof(uintptr_t),		0,		POOL_CONCURRENT},
+	{"POOL_CONCURRENT flag - page size pool",				16,		0,		sizeof(uintptr_t),		0,		POOL_CONCURRENT},
+	{"POOL_CONCURRENT flag - large alignment size",			24,		100,	64,						0,		POOL_CONCURRENT},
+	{"POOL_CONCURRENT flag - POOL_NO_ZERO flag",			32,		10,		sizeof(uintptr_t),		0,		POOL_CONCURRENT | POOL_NO_ZERO},
 };
 
 static const uintptr_t data1[] = {1, 2, 3, 4, 5, 6, 7, 17, 18, 19, 20, 21, 22, 23, 24, 25};
@@ -0,0 +1,286 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Tests for POOL_CONCURRENT pools: many threads allocating and freeing at once never share an
+ * element, and the pool can be walked afterwards. Also a throughput microbenchmark against a
+ * regular pool guarded by a monitor. Run with -logLevel=info to see the measured latencies.
+ */
+
+#include "omrport.h"
+#include "omrTest.h"
+#include "omrutil.h"
+#include "pool_api.h"
+#include "testEnvironment.hpp"
+#include "thread_api.h"
+
+extern PortEnvironment *omrTestEnv;
+
+#define CONCURRENT_MAX_THREADS 8
+#define CONCURRENT_ITERATIONS 20000
+#define CONCURRENT_MAX_HELD 200
+#define THROUGHPUT_ITERATIONS 20000
+#define THROUGHPUT_BATCH 16
+
+typedef struct PoolTestElement {
+	uintptr_t owner;
+	uintptr_t sequence;
+} PoolTestElement;
+
+typedef struct PoolConcurrentInfo {
+	J9Pool *pool;
+	omrthread_monitor_t lock; /* guards the pool when it is not concurrent */
+	omrthread_monitor_t control; /* releases the threads together */
+	uintptr_t started;
+	BOOLEAN go;
+} PoolConcurrentInfo;
+
+typedef struct PoolThreadInfo {
+	PoolConcurrentInfo *shared;
+	uintptr_t id;
+	uintptr_t held;
+	uintptr_t failures;
+	PoolTestElement *elements[CONCURRENT_MAX_HELD];
+} PoolThreadInfo;
+
+static void
+waitForStart(PoolConcurrentInfo *info)
+{
+	omrthread_monitor_enter(info->control);
+	info->started += 1;
+	omrthread_monitor_notify_all(info->control);
+	while (!info->go) {
+		omrthread_monitor_wait(info->control);
+	}
+	omrthread_monitor_exit(info->control);
+}
+
+/**
+ * Randomly allocate and free elements, checking that every new element is zeroed and that
+ * nothing else wrote to the elements this thread holds. Ends still holding some elements.
+ */
+static int J9THREAD_PROC
+allocateAndFreeThread(void *entryArg)
+{
+	PoolThreadInfo *info = (PoolThreadInfo *)entryArg;
+	J9Pool *pool = info->shared->pool;
+	uint32_t random = (uint32_t)info->id * 2654435761u;
+
+	waitForStart(info->shared);
+
+	for (uintptr_t i = 0; i < CONCURRENT_ITERATIONS; i++) {
+		random = (random * 1103515245) + 12345;
+		if ((0 == info->held) || ((info->held < CONCURRENT_MAX_HELD) && (0 != ((random >> 16) & 1)))) {
+			PoolTestElement *element = (PoolTestElement *)pool_newElement(pool);
+			if (NULL == element) {
+				info->failures += 1;
+				break;
+			}
+			if ((0 != element->owner) || (0 != element->sequence)) {
+				info->failures += 1;
+			}
+			element->owner = info->id;
+			element->sequence = i;
+			info->elements[info->held] = element;
+			info->held += 1;
+		} else {
+			uintptr_t index = (random >> 8) % info->held;
+			PoolTestElement *element = info->elements[index];
+			if (info->id != element->owner) {
+				info->failures += 1;
+			}
+			element->owner = 0;
+			pool_removeElement(pool, element);
+			info->held -= 1;
+			info->elements[index] = info->elements[info->held];
+		}
+	}
+
+	for (uintptr_t i = 0; i < info->held; i++) {
+		if (info->id != info->elements[i]->owner) {
+			info->failures += 1;
+		}
+	}
+	return 0;
+}
+
+static int J9THREAD_PROC
+throughputThread(void *entryArg)
+{
+	PoolThreadInfo *info = (PoolThreadInfo *)entryArg;
+	J9Pool *pool = info->shared->pool;
+	omrthread_monitor_t lock = info->shared->lock;
+
+	waitForStart(info->shared);
+
+	for (uintptr_t i = 0; i < THROUGHPUT_ITERATIONS; i++) {
+		for (uintptr_t j = 0; j < THROUGHPUT_BATCH; j++) {
+			if (NULL != lock) {
+				omrthread_monitor_enter(lock);
+			}
+			info->elements[j] = (PoolTestElement *)pool_newElement(pool);
+			if (NULL != lock) {
+				omrthread_monitor_exit(lock);
+			}
+		}
+		for (uintptr_t j = 0; j < THROUGHPUT_BATCH; j++) {
+			if (NULL != lock) {
+				omrthread_monitor_enter(lock);
+			}
+			pool_removeElement(pool, info->elements[j]);
+			if (NULL != lock) {
+				omrthread_monitor_exit(lock);
+			}
+		}
+	}
+	return 0;
+}
+
+/**
+ * Run entryPoint on threadCount new threads, all released at once.
+ * @return elapsed wall time in nanoseconds
+ */
+static uint64_t
+runThreads(PoolConcurrentInfo *info, PoolThreadInfo *threadInfo, uintptr_t threadCount, omrthread_entrypoint_t entryPoint)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	omrthread_t threads[CONCURRENT_MAX_THREADS];
+	uint64_t start = 0;
+
+	info->started = 0;
+	info->go = FALSE;
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		omrthread_attr_t attr = NULL;
+		threadInfo[i].shared = info;
+		threadInfo[i].id = i + 1;
+		threadInfo[i].held = 0;
+		threadInfo[i].failures = 0;
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&threads[i], &attr, 0, entryPoint, &threadInfo[i]));
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_attr_destroy(&attr));
+	}
+
+	omrthread_monitor_enter(info->control);
+	while (info->started < threadCount) {
+		omrthread_monitor_wait(info->control);
+	}
+	start = omrtime_hires_clock();
+	info->go = TRUE;
+	omrthread_monitor_notify_all(info->control);
+	omrthread_monitor_exit(info->control);
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_join(threads[i]));
+	}
+	return omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+}
+
+TEST(OmrAlgoTest, PoolConcurrentAllocateAndFree)
+{
+	OMRPortLibrary *portLib = omrTestEnv->getPortLibrary();
+	PoolThreadInfo threadInfo[CONCURRENT_MAX_THREADS];
+	PoolConcurrentInfo info;
+	uintptr_t held = 0;
+	uintptr_t walked = 0;
+	pool_state state;
+
+	memset(&info, 0, sizeof(info));
+	/* Small puddles, so that threads keep growing the pool and going to the shared free list. */
+	info.pool = pool_new(sizeof(PoolTestElement), 64, 0, POOL_CONCURRENT, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(portLib));
+	ASSERT_TRUE(NULL != info.pool);
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&info.control, 0, "poolConcurrentTest control"));
+
+	runThreads(&info, threadInfo, CONCURRENT_MAX_THREADS, allocateAndFreeThread);
+	for (uintptr_t i = 0; i < CONCURRENT_MAX_THREADS; i++) {
+		EXPECT_EQ((uintptr_t)0, threadInfo[i].failures) << "thread " << threadInfo[i].id;
+		held += threadInfo[i].held;
+	}
+
+	/* Every element still held is walked exactly once, and nothing else is. */
+	EXPECT_EQ(held, pool_numElements(info.pool));
+	for (PoolTestElement *element = (PoolTestElement *)pool_startDo(info.pool, &state); NULL != element; element = (PoolTestElement *)pool_nextDo(&state)) {
+		ASSERT_TRUE((0 != element->owner) && (element->owner <= CONCURRENT_MAX_THREADS));
+		element->owner |= (uintptr_t)1 << (sizeof(uintptr_t) * 8 - 1);
+		walked += 1;
+	}
+	EXPECT_EQ(held, walked);
+	for (uintptr_t i = 0; i < CONCURRENT_MAX_THREADS; i++) {
+		for (uintptr_t j = 0; j < threadInfo[i].held; j++) {
+			EXPECT_TRUE(pool_includesElement(info.pool, threadInfo[i].elements[j]));
+			EXPECT_NE((uintptr_t)0, threadInfo[i].elements[j]->owner >> (sizeof(uintptr_t) * 8 - 1));
+		}
+	}
+
+	/* Freeing an element twice only frees it once. */
+	if (0 != held) {
+		PoolTestElement *element = (PoolTestElement *)pool_startDo(info.pool, &state);
+		pool_removeElement(info.pool, element);
+		pool_removeElement(info.pool, element);
+		EXPECT_EQ(held - 1, pool_numElements(info.pool));
+		EXPECT_FALSE(pool_includesElement(info.pool, element));
+	}
+
+	pool_clear(info.pool);
+	EXPECT_EQ((uintptr_t)0, pool_numElements(info.pool));
+	EXPECT_TRUE(NULL == pool_startDo(info.pool, &state));
+
+	omrthread_monitor_destroy(info.control);
+	pool_kill(info.pool);
+}
+
+/**
+ * Measure new/remove element pairs on 1 to CONCURRENT_MAX_THREADS threads, for a regular pool
+ * guarded by a monitor and for a POOL_CONCURRENT pool.
+ */
+TEST(OmrAlgoTest, PoolConcurrentThroughput)
+{
+	OMRPortLibrary *portLib = omrTestEnv->getPortLibrary();
+	PoolThreadInfo threadInfo[CONCURRENT_MAX_THREADS];
+
+	omrTestEnv->log(LEVEL_INFO, "%8s %20s %20s\n", "threads", "locked ns/pair", "concurrent ns/pair");
+	for (uintptr_t threadCount = 1; threadCount <= CONCURRENT_MAX_THREADS; threadCount *= 2) {
+		double nsPerPair[2];
+		for (uintptr_t concurrent = 0; concurrent < 2; concurrent++) {
+			PoolConcurrentInfo info;
+			uint64_t elapsed = 0;
+
+			memset(&info, 0, sizeof(info));
+			info.pool = pool_new(sizeof(PoolTestElement), 0, 0, (1 == concurrent) ? POOL_CONCURRENT : 0, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(portLib));
+			ASSERT_TRUE(NULL != info.pool);
+			ASSERT_EQ(0, omrthread_monitor_init_with_name(&info.control, 0, "poolConcurrentTest control"));
+			if (0 == concurrent) {
+				ASSERT_EQ(0, omrthread_monitor_init_with_name(&info.lock, 0, "poolConcurrentTest lock"));
+			}
+
+			elapsed = runThreads(&info, threadInfo, threadCount, throughputThread);
+			EXPECT_EQ((uintptr_t)0, pool_numElements(info.pool));
+			nsPerPair[concurrent] = (double)elapsed / (double)(threadCount * THROUGHPUT_ITERATIONS * THROUGHPUT_BATCH);
+
+			if (NULL != info.lock) {
+				omrthread_monitor_destroy(info.lock);
+			}
+			omrthread_monitor_destroy(info.control);
+			pool_kill(info.pool);
+		}
+		omrTestEnv->log(LEVEL_INFO, "%8zu %20.1f %20.1f\n", threadCount, nsPerPair[0], nsPerPair[1]);
+	}
+}
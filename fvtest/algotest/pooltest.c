@@ -165,7 +165,9 @@ testPoolNewElement(OMRPortLibrary *portLib, PoolInputData *inputData, J9Pool *cu
 
 
 	J9PoolPuddleList* puddleList = J9POOL_PUDDLELIST(currentPool);
-	J9PoolPuddle* initialPuddle = J9POOLPUDDLELIST_NEXTAVAILABLEPUDDLE(puddleList);
+	/* Concurrent pools do not keep an available puddle list; new puddles go to the head of the puddle list. */
+	uintptr_t concurrent = currentPool->flags & POOL_CONCURRENT;
+	J9PoolPuddle* initialPuddle = concurrent ? J9POOLPUDDLELIST_NEXTPUDDLE(puddleList) : J9POOLPUDDLELIST_NEXTAVAILABLEPUDDLE(puddleList);
 	J9PoolPuddle* currentPuddle = initialPuddle;
 
 	/* Call pool_newElement until a new puddle is allocated... and then allocate a couple of new elements into the new puddle */
@@ -207,7 +209,7 @@ testPoolNewElement(OMRPortLibrary *portLib, PoolInputData *inputData, J9Pool *cu
 		/* currentPuddle will become NULL when the puddle being used becomes FULL if there has been no deletions */
 		elementsInPuddle++;
 
-		currentPuddle = J9POOLPUDDLELIST_NEXTAVAILABLEPUDDLE(puddleList);
+		currentPuddle = concurrent ? J9POOLPUDDLELIST_NEXTPUDDLE(puddleList) : J9POOLPUDDLELIST_NEXTAVAILABLEPUDDLE(puddleList);
 	}
 	if (elementsInPuddle < expectedNumElems) {
 		return -4;
@@ -19,13 +19,16 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include "AtomicOperations.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCConfigTest.hpp"
+#include "HeapWalker.hpp"
 #include "ObjectAllocationModel.hpp"
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
 #include "omrgc.h"
+#include "ParallelGlobalGC.hpp"
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
 #include "VerboseWriterChain.hpp"
@@ -43,21 +46,64 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_work_stealing_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_async_logging_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_async_logging_binary_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_parallel_heap_walk_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_sync_spin_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_adaptive_threads_config.xml"
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
 #endif
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+                        , "fvtest/gctest/configuration/global_GC_concurrent_sweep_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_COMPACTION)
+                        , "fvtest/gctest/configuration/global_GC_compact_config.xml"
+#endif
+#if defined(OMR_GC_SEGREGATED_HEAP)
+                        , "fvtest/gctest/configuration/segregated_GC_config.xml"
+                        , "fvtest/gctest/configuration/segregated_GC_generational_config.xml"
+#endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_numa_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_adaptive_scan_cache_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_huge_page_advise_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_allocation_sampling_config.xml"
                         , "fvtest/gctest/configuration/gencon_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_pretenuring_config.xml"
 #endif
                         };
 
 const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
-								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
+								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+								, "perftest/gctest/configuration/gencon_slot_prefetch_off.xml"
+								, "perftest/gctest/configuration/gencon_slot_prefetch_depth8.xml"
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+								};
+
+/* Pause-time benchmark matrix, run once per -gcThreadCount=<n> (see omr_pausebenchmark in perftest/omrperftest.mk) */
+const char *pauseBenchmarkTests[] = {"perftest/gctest/configuration/pause_flat_allocrate.xml"
+								, "perftest/gctest/configuration/pause_flat_liveset.xml"
+								, "perftest/gctest/configuration/pause_flat_shape.xml"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+								, "perftest/gctest/configuration/pause_gencon_allocrate.xml"
+								, "perftest/gctest/configuration/pause_gencon_liveset.xml"
+								, "perftest/gctest/configuration/pause_gencon_shape.xml"
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+								, "perftest/gctest/configuration/pause_segregated_allocrate.xml"
+								, "perftest/gctest/configuration/pause_segregated_liveset.xml"
+								, "perftest/gctest/configuration/pause_segregated_shape.xml"
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+								};
+
 void
 GCConfigTest::SetUp()
 {
@@ -108,7 +154,12 @@ GCConfigTest::SetUp()
 	if (NULL == verboseFile) {
 		FAIL() << "Failed to allocate native memory.";
 	}
-	omrstr_printf(verboseFile, MAX_NAME_LENGTH, "%s_%d_%lld.xml", verboseFileNamePrefix, omrsysinfo_get_pid(), omrtime_current_time_millis());
+	if (0 != gcTestEnv->gcThreadCount) {
+		/* keep the results of each thread count apart */
+		omrstr_printf(verboseFile, MAX_NAME_LENGTH, "%s_t%zu_%d_%lld.xml", verboseFileNamePrefix, gcTestEnv->gcThreadCount, omrsysinfo_get_pid(), omrtime_current_time_millis());
+	} else {
+		omrstr_printf(verboseFile, MAX_NAME_LENGTH, "%s_%d_%lld.xml", verboseFileNamePrefix, omrsysinfo_get_pid(), omrtime_current_time_millis());
+	}
 	verboseManager = MM_VerboseManager::newInstance(env, exampleVM->_omrVM);
 	verboseManager->configureVerboseGC(exampleVM->_omrVM, verboseFile, numOfFiles, numOfCycles);
 	gcTestEnv->log("Verbose File: %s\n", verboseFile);
@@ -116,6 +167,12 @@ GCConfigTest::SetUp()
 	verboseManager->enableVerboseGC();
 	verboseManager->setInitializedTime(omrtime_hires_clock());
 
+	createObjectTables();
+}
+
+void
+GCConfigTest::createObjectTables()
+{
 	/* Initialize root table */
 	exampleVM->rootTable = hashTableNew(
 			exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
@@ -128,10 +185,8 @@ GCConfigTest::SetUp()
 }
 
 void
-GCConfigTest::TearDown()
+GCConfigTest::freeObjectTables()
 {
-	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
-
 	/* Free root hash table */
 	if (NULL != exampleVM->rootTable) {
 		hashTableFree(exampleVM->rootTable);
@@ -144,6 +199,14 @@ GCConfigTest::TearDown()
 		hashTableFree(exampleVM->objectTable);
 		exampleVM->objectTable = NULL;
 	}
+}
+
+void
+GCConfigTest::TearDown()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+
+	freeObjectTables();
 
 	/* close verboseManager and clean up verbose files */
 	if (NULL != verboseManager) {
@@ -297,7 +360,7 @@ GCConfigTest::parseObjectType(pugi::xml_node node)
 }
 
 ObjectEntry *
-GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
+GCConfigTest::allocateHelper(const char *objName, uintptr_t size, const char *allocationSite)
 {
 	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
 
@@ -308,13 +371,13 @@ GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 
 	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
 	MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
-			MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+			MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true), allocationSite);
 	objEntry.objPtr = OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
 
 	if (NULL == objEntry.objPtr) {
 		gcTestEnv->log("No free memory to allocate %s of size 0x%llx, GC start.\n", objName, size);
 		MM_ObjectAllocationModel *withGc = new(objectAllocationModelSpace)
-				MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false));
+				MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false), allocationSite);
 		objEntry.objPtr = OMR_GC_AllocateObject(exampleVM->_omrVMThread, withGc);
 	}
 
@@ -353,7 +416,14 @@ GCConfigTest::createObject(const char *namePrefix, OMRGCObjectType objType, int3
 		gcTestEnv->log(LEVEL_VERBOSE, "Found object %s in object table.\n", objEntry->name);
 		omrmem_free_memory(objName);
 	} else {
-		objEntry = allocateHelper(objName, size);
+		/* allocation sites are reported as collapsed stack frames in allocation profiles */
+		const char *allocationSite = "GCConfigTest::createObject;garbage";
+		if (ROOT == objType) {
+			allocationSite = "GCConfigTest::createObject;root";
+		} else if (NORMAL == objType) {
+			allocationSite = "GCConfigTest::createObject;normal";
+		}
+		objEntry = allocateHelper(objName, size, allocationSite);
 		if (NULL != objEntry) {
 			/* Keep count of the new allocated non-garbage object size for garbage insertion. If the object exists in objectTable, its size is ignored. */
 			if ((ROOT == objType) || (NORMAL == objType)) {
@@ -953,6 +1023,53 @@ done:
 	return rt;
 }
 
+typedef struct HeapWalkTotals {
+	uintptr_t objectCount;
+	uintptr_t objectBytes;
+	uintptr_t addressSum;
+} HeapWalkTotals;
+
+static void
+countWalkedObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	HeapWalkTotals *totals = (HeapWalkTotals *)userData;
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrVMThread->_vm);
+	MM_AtomicOperations::add(&totals->objectCount, 1);
+	MM_AtomicOperations::add(&totals->objectBytes, extensions->objectModel.getConsumedSizeInBytesWithHeader(object));
+	MM_AtomicOperations::add(&totals->addressSum, (uintptr_t)object);
+}
+
+int32_t
+GCConfigTest::verifyParallelHeapWalk()
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (!extensions->isStandardGC()) {
+		gcTestEnv->log("Parallel heap walk is only supported by the standard collectors, skipped.\n");
+		return 0;
+	}
+
+	MM_HeapWalker *heapWalker = ((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getHeapWalker();
+	HeapWalkTotals serialTotals = {0, 0, 0};
+	HeapWalkTotals parallelTotals = {0, 0, 0};
+
+	env->acquireExclusiveVMAccess();
+	heapWalker->allObjectsDo(env, countWalkedObject, &serialTotals, 0, false, false);
+	heapWalker->allObjectsDo(env, countWalkedObject, &parallelTotals, 0, true, false);
+	env->releaseExclusiveVMAccess();
+
+	gcTestEnv->log("Heap walk: serial %zu objects (%zu bytes), parallel %zu objects (%zu bytes).\n",
+		serialTotals.objectCount, serialTotals.objectBytes, parallelTotals.objectCount, parallelTotals.objectBytes);
+	if ((0 == serialTotals.objectCount)
+		|| (serialTotals.objectCount != parallelTotals.objectCount)
+		|| (serialTotals.objectBytes != parallelTotals.objectBytes)
+		|| (serialTotals.addressSum != parallelTotals.addressSum)
+	) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Parallel heap walk does not match the serial heap walk.\n", __FILE__, __LINE__);
+		return 1;
+	}
+	return 0;
+}
+
 int32_t
 GCConfigTest::triggerOperation(pugi::xml_node node)
 {
@@ -973,6 +1090,10 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "heapWalk")) {
+			gcTestEnv->log("Comparing parallel and serial heap walks...\n");
+			rt = verifyParallelHeapWalk();
+			OMRGCTEST_CHECK_RT(rt);
 		}
 	}
 done:
@@ -1031,10 +1152,18 @@ TEST_P(GCConfigTest, test)
 			rt = parseGarbagePolicy(configChild.child(xs.garbagePolicy));
 			ASSERT_EQ(0, rt) << "Failed to parse garbage policy.";
 			pugi::xpath_node_set objects = configChild.select_nodes(xs.object);
+			/* repeated allocations drop every object allocated so far, so the live set stays that of one pass */
+			uintptr_t repeat = OMR_MAX(configChild.attribute("repeat").as_uint(1), 1U);
 			int64_t startTime = omrtime_current_time_millis();
-			for (pugi::xpath_node_set::const_iterator it = objects.begin(); it != objects.end(); ++it) {
-				rt = allocationWalker(it->node());
-				ASSERT_EQ(0, rt) << "Failed to perform allocation.";
+			for (uintptr_t pass = 0; pass < repeat; pass++) {
+				if (0 != pass) {
+					freeObjectTables();
+					createObjectTables();
+				}
+				for (pugi::xpath_node_set::const_iterator it = objects.begin(); it != objects.end(); ++it) {
+					rt = allocationWalker(it->node());
+					ASSERT_EQ(0, rt) << "Failed to perform allocation.";
+				}
 			}
 			gcTestEnv->log("Time elapsed in allocation: %lld ms\n", (omrtime_current_time_millis() - startTime));
 		} else if (0 == strcmp(configChild.name(), "verification")) {
@@ -1057,6 +1186,28 @@ TEST_P(GCConfigTest, test)
 			FAIL() << "Invalid XML input: unrecognized XML node \"" << configChild.name() << "\" in configuration file.";
 		}
 	}
+
+	if (0 != env->getExtensions()->allocationSamplingInterval) {
+		char profileFile[MAX_NAME_LENGTH];
+		omrstr_printf(profileFile, MAX_NAME_LENGTH, "AllocationProfile_%d_%lld.folded", omrsysinfo_get_pid(), omrtime_current_time_millis());
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_WriteAllocationProfile(exampleVM->_omrVMThread, profileFile)) << "Failed to write allocation profile " << profileFile << ".";
+		gcTestEnv->log("Allocation profile: %s\n", profileFile);
+		/* every sample is attributed to one of the sites named by createObject(), never to an unknown site */
+		char profile[4096];
+		intptr_t profileSize = -1;
+		intptr_t fd = omrfile_open(profileFile, EsOpenRead, 0);
+		if (-1 != fd) {
+			profileSize = omrfile_read(fd, profile, sizeof(profile) - 1);
+			omrfile_close(fd);
+		}
+		if (false == gcTestEnv->keepLog) {
+			omrfile_unlink(profileFile);
+		}
+		ASSERT_LT(0, profileSize) << "No allocations were sampled.";
+		profile[profileSize] = '\0';
+		ASSERT_TRUE(NULL != strstr(profile, ";GCConfigTest::createObject;")) << "Allocation sites are missing from the profile:\n" << profile;
+		ASSERT_TRUE(NULL == strstr(profile, "[unknown site]")) << "Allocation sites are missing from the profile:\n" << profile;
+	}
 }
 
 INSTANTIATE_TEST_CASE_P(gcFunctionalTest,GCConfigTest,
@@ -1064,3 +1215,6 @@ INSTANTIATE_TEST_CASE_P(gcFunctionalTest,GCConfigTest,
 
 INSTANTIATE_TEST_CASE_P(perfTest,GCConfigTest,
         ::testing::ValuesIn(perfTests));
+
+INSTANTIATE_TEST_CASE_P(pauseBenchmark,GCConfigTest,
+        ::testing::ValuesIn(pauseBenchmarkTests));
@@ -91,10 +91,12 @@ protected:
 	 * Function members
 	 */
 protected:
+	void createObjectTables();
+	void freeObjectTables();
 	void freeAttributeList(AttributeElem *root);
 	int32_t parseAttribute(AttributeElem **root, const char *attrStr);
 	OMRGCObjectType parseObjectType(pugi::xml_node node);
-	ObjectEntry *allocateHelper(const char *objName, uintptr_t size);
+	ObjectEntry *allocateHelper(const char *objName, uintptr_t size, const char *allocationSite);
 	ObjectEntry *createObject(const char *namePrefix, OMRGCObjectType objType, int32_t depth, int32_t nthInRow, uintptr_t size);
 	int32_t createFixedSizeTree(ObjectEntry **objectEntry, const char *namePrefixStr, OMRGCObjectType objType, uintptr_t totalSize, uintptr_t objSize, int32_t breadth);
 	int32_t processObjNode(pugi::xml_node node, const char *namePrefixStr, OMRGCObjectType objType, AttributeElem *numOfFieldsElem, AttributeElem *breadthElem, int32_t depth);
@@ -110,6 +112,7 @@ protected:
 	int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
 	int32_t parseGarbagePolicy(pugi::xml_node node);
 	int32_t triggerOperation(pugi::xml_node node);
+	int32_t verifyParallelHeapWalk();
 	int32_t iniXMLStr(const char *configStyle);
 
 	/* This implementation assumes that existing entries hashed into the rootTable and objectTable can
@@ -83,7 +83,8 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -91,21 +92,99 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+						_useSegregatedGC = true;
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, optavgpause or segregated): %s\n", attr.value());
 						result = false;
 					}
+				} else if (0 == strcmp(attr.name(), "allocationSamplingInterval")) {
+					extensions->allocationSamplingInterval = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "hugePageAdvise")) {
+					extensions->hugePageAdvise = true;
+					if (0 == j9_cmdla_stricmp(attr.value(), "all")) {
+						extensions->hugePageMemoryTypes = MEMORY_TYPE_NEW | MEMORY_TYPE_OLD;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "nursery")) {
+						extensions->hugePageMemoryTypes = MEMORY_TYPE_NEW;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "tenure")) {
+						extensions->hugePageMemoryTypes = MEMORY_TYPE_OLD;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "none")) {
+						extensions->hugePageMemoryTypes = 0;
+					} else {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized hugePageAdvise (expected all, nursery, tenure or none): %s\n", attr.value());
+						result = false;
+					}
+				} else if (0 == strcmp(attr.name(), "asyncLogging")) {
+					extensions->asyncLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "asyncLoggingBinary")) {
+					extensions->asyncLoggingBinary = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "asyncLoggingBufferSize")) {
+					extensions->asyncLoggingBufferSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "hugePageCollapse")) {
+					extensions->hugePageCollapse = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "hugePageAlignment")) {
+					extensions->hugePageAlignment = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "markingWorkStealing")) {
+					extensions->markingWorkStealing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "markingWorkStealingDequeSize")) {
+					extensions->markingWorkStealingDequeSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "adaptiveSyncSpin")) {
+					extensions->adaptiveSyncSpin = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveGlobalGCThreading")) {
+					extensions->adaptiveGlobalGCThreading = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "slotPrefetchDepth")) {
+					extensions->slotPrefetchDepth = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "concurrentSweep")) {
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+					extensions->concurrentSweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+					extensions->payAllocationTax = extensions->concurrentSweep;
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentSweep=true ignored, requires OMR_GC_CONCURRENT_SWEEP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP)*/
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+					if (0 == j9_cmdla_stricmp(attr.value(), "true")) {
+						extensions->noCompactOnGlobalGC = 0;
+						extensions->compactOnGlobalGC = 1;
+					}
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: compactOnGlobalGC=true ignored, requires OMR_GC_MODRON_COMPACTION (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+				} else if (0 == strcmp(attr.name(), "compactSummaryTable")) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+					extensions->compactUseSummaryTable = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 					extensions->concurrentMark = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+#if defined(OMR_GC_SEGREGATED_HEAP)
+				} else if (0 == strcmp(attr.name(), "segregatedGenerational")) {
+					extensions->segregatedGenerational = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "segregatedNurseryCollections")) {
+					extensions->segregatedNurseryCollections = (uintptr_t)atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "segregatedNurserySize")) {
+					extensions->segregatedNurserySize = atoi(attr.value()) * unitSize;
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerNUMAAware")) {
+					extensions->scavengerNUMAAware = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "simulatedNUMANodeCount")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
+				} else if (0 == strcmp(attr.name(), "adaptiveScanCacheSizing")) {
+					extensions->adaptiveScanCacheSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerPretenuring")) {
+					extensions->scavengerPretenuring = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerPretenureThreshold")) {
+					extensions->scavengerPretenureThreshold = (uintptr_t)atoi(attr.value());
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
@@ -116,7 +195,15 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #if defined(OMR_GC_MODRON_SCAVENGER)
 			extensions->fvtest_forceScavengerBackout &= extensions->scavengerEnabled;
 			extensions->fvtest_forcePoisonEvacuate &= extensions->scavengerEnabled;
+			extensions->scavengerNUMAAware &= extensions->scavengerEnabled;
+			extensions->adaptiveScanCacheSizing &= extensions->scavengerEnabled;
+			extensions->scavengerPretenuring &= extensions->scavengerEnabled;
 #endif /* OMR_GC_MODRON_SCAVENGER */
+			/* -gcThreadCount=<n> runs every configuration at the same thread count */
+			if (0 != gcTestEnv->gcThreadCount) {
+				extensions->gcThreadCount = gcTestEnv->gcThreadCount;
+				extensions->gcThreadCountForced = true;
+			}
 		}
 	}
 	return result;
@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+#include "omrport.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ParallelDispatcher.hpp"
+#include "ParallelTask.hpp"
+#include "StartupManagerTestExample.hpp"
+#include "gcTestHelpers.hpp"
+
+#define ADAPTIVE_TEST_THREADS 8
+#define ADAPTIVE_TEST_SECTIONS 20
+#define ADAPTIVE_TEST_SECTION_MICROS 1000
+
+/**
+ * Task modelled on a phase with a serial bottleneck: each section is run by a single thread while
+ * the others wait for it at the synchronization point. Every thread adds the time it spent waiting
+ * to the stall time of the task, the way the mark and sweep tasks report theirs.
+ */
+class StallTestTask : public MM_ParallelTask
+{
+private:
+	volatile uint64_t _stallTime;
+
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PARALLEL_OBJECT_DO; }
+
+	virtual void
+	run(MM_EnvironmentBase *env)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uint64_t stallTime = 0;
+		for (uintptr_t i = 0; i < ADAPTIVE_TEST_SECTIONS; i++) {
+			uint64_t start = omrtime_hires_clock();
+			if (synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
+				uint64_t workStart = omrtime_hires_clock();
+				stallTime += workStart - start;
+				while (omrtime_hires_delta(workStart, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS) < ADAPTIVE_TEST_SECTION_MICROS) {
+					/* serial work */
+				}
+				releaseSynchronizedGCThreads(env);
+			} else {
+				stallTime += omrtime_hires_clock() - start;
+			}
+		}
+		MM_AtomicOperations::add(&_stallTime, stallTime);
+	}
+
+	uint64_t getStallTime() { return _stallTime; }
+
+	StallTestTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher)
+		: MM_ParallelTask(env, dispatcher)
+		, _stallTime(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+class gcFunctionalTestAdaptiveGlobalThreading : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+
+	virtual void
+	SetUp()
+	{
+		/* forces a large gcthreadCount, so the test does not depend on the number of CPUs */
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "fvtest/gctest/configuration/global_GC_sync_spin_config.xml");
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread"));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread));
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+	}
+
+	virtual void
+	TearDown()
+	{
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownDispatcherThreads(exampleVM->_omrVMThread));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Free(exampleVM->_omrVMThread));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+		exampleVM->_omrVMThread = NULL;
+	}
+
+public:
+	gcFunctionalTestAdaptiveGlobalThreading()
+		: exampleVM(&(gcTestEnv->exampleVM))
+		, env(NULL)
+	{
+	}
+};
+
+TEST_F(gcFunctionalTestAdaptiveGlobalThreading, stallHeavyPhaseDropsThreads)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_ParallelDispatcher *dispatcher = extensions->dispatcher;
+	uintptr_t threadCount = OMR_MIN(dispatcher->threadCountMaximum(), (uintptr_t)ADAPTIVE_TEST_THREADS);
+	bool adaptiveGlobalGCThreading = extensions->adaptiveGlobalGCThreading;
+	bool gcThreadCountForced = extensions->gcThreadCountForced;
+
+	/* a serial bottleneck stalls at most (threadCount - 1) / threadCount of the phase, which the model only acts on with five or more threads */
+	ASSERT_EQ((uintptr_t)ADAPTIVE_TEST_THREADS, threadCount);
+
+	StallTestTask task(env, dispatcher);
+	env->acquireExclusiveVMAccess();
+	uint64_t start = omrtime_hires_clock();
+	dispatcher->run(env, &task, threadCount);
+	uint64_t phaseTime = omrtime_hires_clock() - start;
+	env->releaseExclusiveVMAccess();
+	ASSERT_EQ(threadCount, task.getThreadCount());
+
+	/* the thread count is only forced to run the task on more threads than the small heap would get */
+	extensions->adaptiveGlobalGCThreading = true;
+	extensions->gcThreadCountForced = false;
+	EXPECT_EQ(UDATA_MAX, dispatcher->getAdaptivePhaseThreads(MM_ParallelDispatcher::ADAPTIVE_PHASE_GLOBAL_MARK));
+
+	dispatcher->recordAdaptivePhaseEfficiency(env, MM_ParallelDispatcher::ADAPTIVE_PHASE_GLOBAL_MARK, threadCount, phaseTime, task.getStallTime());
+	uintptr_t recommended = dispatcher->getAdaptivePhaseThreads(MM_ParallelDispatcher::ADAPTIVE_PHASE_GLOBAL_MARK);
+	EXPECT_LT(recommended, threadCount) << "stall " << task.getStallTime() << " of " << (phaseTime * threadCount) << " thread ticks";
+	EXPECT_LE((uintptr_t)1, recommended);
+
+	/* phases are adapted independently */
+	EXPECT_EQ(UDATA_MAX, dispatcher->getAdaptivePhaseThreads(MM_ParallelDispatcher::ADAPTIVE_PHASE_GLOBAL_SWEEP));
+
+	/* a phase that stalled throughout gains nothing from more than one thread */
+	dispatcher->recordAdaptivePhaseEfficiency(env, MM_ParallelDispatcher::ADAPTIVE_PHASE_GLOBAL_SWEEP, threadCount, phaseTime, phaseTime * threadCount);
+	EXPECT_EQ((uintptr_t)1, dispatcher->getAdaptivePhaseThreads(MM_ParallelDispatcher::ADAPTIVE_PHASE_GLOBAL_SWEEP));
+
+	/* a phase that never stalled may use every thread */
+	dispatcher->recordAdaptivePhaseEfficiency(env, MM_ParallelDispatcher::ADAPTIVE_PHASE_GLOBAL_SWEEP, threadCount, phaseTime, 0);
+	EXPECT_EQ(dispatcher->threadCount(), dispatcher->getAdaptivePhaseThreads(MM_ParallelDispatcher::ADAPTIVE_PHASE_GLOBAL_SWEEP));
+
+	/* a forced thread count disables adaptation */
+	extensions->gcThreadCountForced = true;
+	EXPECT_EQ(UDATA_MAX, dispatcher->getAdaptivePhaseThreads(MM_ParallelDispatcher::ADAPTIVE_PHASE_GLOBAL_MARK));
+
+	extensions->adaptiveGlobalGCThreading = adaptiveGlobalGCThreading;
+	extensions->gcThreadCountForced = gcThreadCountForced;
+}
@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "CollectionSetSelector.hpp"
+#include "HeapRegionStateTable.hpp"
+#include "RegionRememberedSet.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <Forge.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace OMR::GC;
+
+#define TEST_REGION_SIZE 1000
+
+TEST(TestCollectionSetSelector, RegionRememberedSet)
+{
+    Forge forge;
+    ASSERT_TRUE(forge.initialize(gcTestEnv->getPortLibrary()));
+
+    RegionRememberedSet rememberedSet;
+    ASSERT_TRUE(rememberedSet.initialize(&forge, 2, 3));
+
+    rememberedSet.remember(0, 7);
+    rememberedSet.remember(0, 7);
+    rememberedSet.remember(0, 9);
+    EXPECT_EQ(rememberedSet.getCardCount(0), 2U);
+    EXPECT_EQ(rememberedSet.getCards(0)[0], 7U);
+    EXPECT_EQ(rememberedSet.getCards(0)[1], 9U);
+    EXPECT_FALSE(rememberedSet.isOverflowed(0));
+    EXPECT_EQ(rememberedSet.getCardCount(1), 0U);
+
+    rememberedSet.remember(0, 11);
+    EXPECT_FALSE(rememberedSet.isOverflowed(0));
+    rememberedSet.remember(0, 13);
+    EXPECT_TRUE(rememberedSet.isOverflowed(0));
+    EXPECT_EQ(rememberedSet.getCardCount(0), 3U);
+    rememberedSet.remember(0, 15);
+    EXPECT_TRUE(rememberedSet.isOverflowed(0));
+
+    rememberedSet.clear(0);
+    EXPECT_FALSE(rememberedSet.isOverflowed(0));
+    EXPECT_EQ(rememberedSet.getCardCount(0), 0U);
+
+    rememberedSet.tearDown(&forge);
+    forge.tearDown();
+}
+
+TEST(TestCollectionSetSelector, SelectByGarbageDensity)
+{
+    Forge forge;
+    ASSERT_TRUE(forge.initialize(gcTestEnv->getPortLibrary()));
+
+    RegionRememberedSet rememberedSet;
+    ASSERT_TRUE(rememberedSet.initialize(&forge, 6, 4));
+
+    CollectionSetSelector selector;
+    ASSERT_TRUE(selector.initialize(&forge, 6, TEST_REGION_SIZE, &rememberedSet));
+
+    /* default model: 10us per region, 1000 bytes/us copied, 20 cards/us scanned */
+    selector.setRegion(0, CollectionSetSelector::REGION_REQUIRED, 1000, 1000); /* 11us */
+    selector.setRegion(1, CollectionSetSelector::REGION_CANDIDATE, 1000, 900); /* 100 garbage, 10.9us */
+    selector.setRegion(2, CollectionSetSelector::REGION_CANDIDATE, 1000, 0); /* 1000 garbage, 10us */
+    selector.setRegion(3, CollectionSetSelector::REGION_CANDIDATE, 1000, 500); /* 500 garbage, 10.5us */
+    selector.setRegion(4, CollectionSetSelector::REGION_CANDIDATE, 1000, 950); /* below minimum garbage fraction */
+    selector.setRegion(5, CollectionSetSelector::REGION_UNUSED, 0, 0);
+
+    EXPECT_DOUBLE_EQ(selector.predictRegionCost(0), 11.0);
+
+    /* required region plus the emptiest candidate */
+    EXPECT_EQ(selector.select(25.0, NULL, 0), 2U);
+    EXPECT_EQ(selector.getSelectedRegions()[0], 0U);
+    EXPECT_EQ(selector.getSelectedRegions()[1], 2U);
+    EXPECT_DOUBLE_EQ(selector.getPredictedPauseMicros(), 21.0);
+
+    /* a large enough budget takes every candidate with enough garbage, densest first */
+    EXPECT_EQ(selector.select(1000.0, NULL, 0), 4U);
+    EXPECT_EQ(selector.getSelectedRegions()[1], 2U);
+    EXPECT_EQ(selector.getSelectedRegions()[2], 3U);
+    EXPECT_EQ(selector.getSelectedRegions()[3], 1U);
+
+    /* remembered set cards make a candidate more expensive and overflow excludes it */
+    rememberedSet.remember(2, 1);
+    rememberedSet.remember(2, 2);
+    EXPECT_DOUBLE_EQ(selector.predictRegionCost(2), 10.1);
+    for (uint32_t card = 3; card < 8; card++) {
+        rememberedSet.remember(2, card);
+    }
+    EXPECT_EQ(selector.select(25.0, NULL, 0), 2U);
+    EXPECT_EQ(selector.getSelectedRegions()[1], 3U);
+
+    /* the required region is selected even when it alone exceeds the target */
+    EXPECT_EQ(selector.select(1.0, NULL, 0), 1U);
+    EXPECT_EQ(selector.getSelectedRegions()[0], 0U);
+
+    /* a slower measured copy rate makes copying live data more expensive */
+    selector.recordCopy(1000, 10.0);
+    EXPECT_DOUBLE_EQ(selector.predictRegionCost(0), 10.0 + (1000.0 / 730.0));
+
+    HeapRegionStateTable table;
+    ASSERT_TRUE(table.initialize(&forge, 0, 10, 6));
+    selector.select(1000.0, &table, 1);
+    EXPECT_EQ(table.getRegionStateAtIndex(0), 1U);
+    EXPECT_EQ(table.getRegionStateAtIndex(1), 1U);
+    EXPECT_EQ(table.getRegionStateAtIndex(2), 0U);
+    EXPECT_EQ(table.getRegionStateAtIndex(3), 1U);
+    EXPECT_EQ(table.getRegionStateAtIndex(4), 0U);
+    EXPECT_EQ(table.getRegionStateAtIndex(5), 0U);
+
+    table.tearDown(&forge);
+    selector.tearDown(&forge);
+    rememberedSet.tearDown(&forge);
+    forge.tearDown();
+}
@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionManagerTarok.hpp"
+#include "LockFreeHeapRegionList.hpp"
+#include "LockingFreeHeapRegionList.hpp"
+#include "StartupManagerTestExample.hpp"
+#include "gcTestHelpers.hpp"
+
+#define REGION_LIST_TEST_REGION_COUNT 1024
+#define REGION_LIST_TEST_TOTAL_OPERATIONS (1 << 20)
+#define REGION_LIST_TEST_MAX_THREADS 128
+
+/* Arbitrary aligned range; the descriptors never touch the memory they describe */
+#define REGION_LIST_TEST_HEAP_BASE ((uintptr_t)1 << 30)
+
+/**
+ * Contention microbenchmark for the single free region list. Every thread repeatedly
+ * takes a region and returns it, which is what mutators refilling size class caches do
+ * against the region pool. The locking and lock-free lists are timed for 1 to 128 threads.
+ */
+class perfTestFreeHeapRegionList : public ::testing::Test
+{
+public:
+	struct WorkerArgs {
+		MM_FreeHeapRegionList *list;
+		uintptr_t operations;
+		volatile uintptr_t *startFlag;
+	};
+
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_HeapRegionManagerTarok *regionManager;
+
+	static int J9THREAD_PROC
+	worker(void *entryArg)
+	{
+		WorkerArgs *args = (WorkerArgs *)entryArg;
+		while (0 == *args->startFlag) {
+			omrthread_yield();
+		}
+		for (uintptr_t i = 0; i < args->operations; i++) {
+			MM_HeapRegionDescriptorSegregated *region = args->list->pop();
+			if (NULL != region) {
+				args->list->push(region);
+			}
+		}
+		return 0;
+	}
+
+	virtual void
+	SetUp()
+	{
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "fvtest/gctest/configuration/gencon_GC_config.xml");
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread"));
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		uintptr_t regionSize = extensions->regionSize;
+		uintptr_t descriptorSize = sizeof(MM_HeapRegionDescriptorSegregated) + sizeof(uintptr_t *) * extensions->arrayletsPerRegion;
+		regionManager = MM_HeapRegionManagerTarok::newInstance(env, regionSize, descriptorSize, MM_HeapRegionDescriptorSegregated::initializer, MM_HeapRegionDescriptorSegregated::destructor);
+		ASSERT_TRUE(NULL != regionManager);
+		void *lowHeapEdge = (void *)REGION_LIST_TEST_HEAP_BASE;
+		void *highHeapEdge = (void *)(REGION_LIST_TEST_HEAP_BASE + (REGION_LIST_TEST_REGION_COUNT * regionSize));
+		ASSERT_TRUE(regionManager->setContiguousHeapRange(env, lowHeapEdge, highHeapEdge));
+	}
+
+	virtual void
+	TearDown()
+	{
+		if (NULL != regionManager) {
+			regionManager->destroyRegionTable(env);
+			regionManager->kill(env);
+			regionManager = NULL;
+		}
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Free(exampleVM->_omrVMThread));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+		exampleVM->_omrVMThread = NULL;
+	}
+
+	void
+	fillList(MM_FreeHeapRegionList *list)
+	{
+		for (uintptr_t i = 0; i < REGION_LIST_TEST_REGION_COUNT; i++) {
+			MM_HeapRegionDescriptorSegregated *region = (MM_HeapRegionDescriptorSegregated *)regionManager->physicalTableDescriptorForIndex(i);
+			region->setRangeCount(1);
+			list->push(region);
+		}
+	}
+
+	/**
+	 * Run the take/return loop on threadCount threads.
+	 * @return elapsed wall time in microseconds
+	 */
+	uint64_t
+	runContended(MM_FreeHeapRegionList *list, uintptr_t threadCount)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+		omrthread_t threads[REGION_LIST_TEST_MAX_THREADS];
+		WorkerArgs args;
+		volatile uintptr_t startFlag = 0;
+		args.list = list;
+		args.operations = REGION_LIST_TEST_TOTAL_OPERATIONS / threadCount;
+		args.startFlag = &startFlag;
+
+		omrthread_attr_t attr = NULL;
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+		for (uintptr_t i = 0; i < threadCount; i++) {
+			EXPECT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&threads[i], &attr, 0, worker, &args));
+		}
+		omrthread_attr_destroy(&attr);
+
+		uint64_t start = omrtime_hires_clock();
+		startFlag = 1;
+		for (uintptr_t i = 0; i < threadCount; i++) {
+			omrthread_join(threads[i]);
+		}
+		return omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	}
+
+public:
+	perfTestFreeHeapRegionList()
+		: exampleVM(&(gcTestEnv->exampleVM))
+		, env(NULL)
+		, regionManager(NULL)
+	{
+	}
+};
+
+TEST_F(perfTestFreeHeapRegionList, contention)
+{
+	MM_FreeHeapRegionList *locking = MM_LockingFreeHeapRegionList::newInstance(env, MM_HeapRegionList::HRL_KIND_FREE, true);
+	MM_FreeHeapRegionList *lockFree = MM_LockFreeHeapRegionList::newInstance(env, MM_HeapRegionList::HRL_KIND_FREE, regionManager);
+	ASSERT_TRUE(NULL != locking);
+	ASSERT_TRUE(NULL != lockFree);
+
+	gcTestEnv->log("%8s %16s %16s\n", "threads", "locking ns/op", "lock-free ns/op");
+	for (uintptr_t threadCount = 1; threadCount <= REGION_LIST_TEST_MAX_THREADS; threadCount *= 2) {
+		uint64_t results[2];
+		MM_FreeHeapRegionList *lists[2] = { locking, lockFree };
+		for (uintptr_t i = 0; i < 2; i++) {
+			fillList(lists[i]);
+			results[i] = runContended(lists[i], threadCount);
+
+			/* every region taken must have been returned exactly once */
+			EXPECT_EQ((uintptr_t)REGION_LIST_TEST_REGION_COUNT, lists[i]->length());
+			EXPECT_EQ((uintptr_t)REGION_LIST_TEST_REGION_COUNT, lists[i]->getTotalRegions());
+			uintptr_t popped = 0;
+			while (NULL != lists[i]->pop()) {
+				popped += 1;
+			}
+			EXPECT_EQ((uintptr_t)REGION_LIST_TEST_REGION_COUNT, popped);
+			EXPECT_TRUE(lists[i]->isEmpty());
+		}
+		gcTestEnv->log("%8zu %16.1f %16.1f\n", threadCount,
+				(double)results[0] * 1000 / REGION_LIST_TEST_TOTAL_OPERATIONS,
+				(double)results[1] * 1000 / REGION_LIST_TEST_TOTAL_OPERATIONS);
+	}
+
+	locking->kill(env);
+	lockFree->kill(env);
+}
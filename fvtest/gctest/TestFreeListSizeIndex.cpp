@@ -0,0 +1,226 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "FreeListSizeIndex.hpp"
+
+#include <gtest/gtest.h>
+
+#define TEST_SLOTS 32
+#define TEST_SLOT_SIZE 4096
+#define TEST_GRANULE 16
+#define TEST_OPERATIONS 20000
+
+/**
+ * An address-ordered free list over a private buffer with one optional free entry per fixed-size slot, mirroring
+ * the operations MM_MemoryPoolAddressOrderedList performs on its size index.
+ */
+class FreeListSimulation
+{
+public:
+	uintptr_t buffer[(TEST_SLOTS * TEST_SLOT_SIZE) / sizeof(uintptr_t)];
+	MM_HeapLinkedFreeHeader *slots[TEST_SLOTS];
+	MM_FreeListSizeIndex index;
+	uintptr_t seed;
+
+	FreeListSimulation()
+		: seed(1)
+	{
+		memset(buffer, 0, sizeof(buffer));
+		memset(slots, 0, sizeof(slots));
+	}
+
+	uintptr_t
+	random(uintptr_t range)
+	{
+		seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+		return (seed >> 8) % range;
+	}
+
+	MM_HeapLinkedFreeHeader *
+	getHead()
+	{
+		for (uintptr_t slot = 0; slot < TEST_SLOTS; slot++) {
+			if (NULL != slots[slot]) {
+				return slots[slot];
+			}
+		}
+		return NULL;
+	}
+
+	MM_HeapLinkedFreeHeader *
+	getPrevious(uintptr_t slot)
+	{
+		while (0 != slot) {
+			slot -= 1;
+			if (NULL != slots[slot]) {
+				return slots[slot];
+			}
+		}
+		return NULL;
+	}
+
+	void
+	link()
+	{
+		MM_HeapLinkedFreeHeader *next = NULL;
+		for (uintptr_t slot = TEST_SLOTS; 0 != slot; slot--) {
+			if (NULL != slots[slot - 1]) {
+				slots[slot - 1]->setNext(next, false);
+				next = slots[slot - 1];
+			}
+		}
+	}
+
+	void
+	add(uintptr_t slot, uintptr_t offset, uintptr_t size)
+	{
+		slots[slot] = MM_HeapLinkedFreeHeader::fillWithHoles((uint8_t *)buffer + (slot * TEST_SLOT_SIZE) + offset, size, false);
+		link();
+	}
+
+	/**
+	 * First fit search for size bytes starting at start, NULL to start from the head.
+	 * @param[out] previous the entry before the one found, or the last entry if none is found
+	 * @param[out] prefixSize the largest entry walked over
+	 */
+	MM_HeapLinkedFreeHeader *
+	search(MM_HeapLinkedFreeHeader *start, uintptr_t size, MM_HeapLinkedFreeHeader **previous, uintptr_t *prefixSize)
+	{
+		MM_HeapLinkedFreeHeader *current = (NULL == start) ? getHead() : start;
+		*previous = NULL;
+		*prefixSize = 0;
+		while ((NULL != current) && (current->getSize() < size)) {
+			*prefixSize = OMR_MAX(*prefixSize, current->getSize());
+			*previous = current;
+			current = current->getNext(false);
+		}
+		return current;
+	}
+
+	/**
+	 * Check every bin is NULL or a free entry with only smaller entries before it, and that bins do not decrease.
+	 */
+	void
+	verify()
+	{
+		for (uintptr_t sizeClass = 0; sizeClass < FREE_LIST_SIZE_INDEX_BINS; sizeClass++) {
+			MM_HeapLinkedFreeHeader *entry = index.getEntry(sizeClass);
+			if (sizeClass > 0) {
+				ASSERT_LE((uintptr_t)index.getEntry(sizeClass - 1), (uintptr_t)entry) << "size class " << sizeClass;
+			}
+			if (NULL != entry) {
+				bool found = false;
+				uintptr_t largest = 0;
+				for (MM_HeapLinkedFreeHeader *current = getHead(); (NULL != current) && !found; current = current->getNext(false)) {
+					found = (current == entry);
+					if (!found) {
+						largest = OMR_MAX(largest, current->getSize());
+					}
+				}
+				ASSERT_TRUE(found) << "size class " << sizeClass << " holds an entry not on the free list";
+				ASSERT_LT(largest, (uintptr_t)1 << sizeClass) << "size class " << sizeClass << " skips an entry of " << largest << " bytes";
+			}
+		}
+	}
+};
+
+TEST(gcFunctionalTestFreeListSizeIndex, rebuildStartsEachSizeClassBeforeItsFirstFit)
+{
+	FreeListSimulation simulation;
+	uintptr_t sizes[] = { 64, 32, 256, 128, 1024 };
+	for (uintptr_t slot = 0; slot < sizeof(sizes) / sizeof(sizes[0]); slot++) {
+		simulation.add(slot, 0, sizes[slot]);
+	}
+	simulation.index.rebuild(simulation.getHead(), false);
+	simulation.verify();
+
+	EXPECT_EQ((MM_HeapLinkedFreeHeader *)NULL, simulation.index.getEntry(6));
+	EXPECT_EQ(simulation.slots[1], simulation.index.getEntry(7));
+	EXPECT_EQ(simulation.slots[1], simulation.index.getEntry(8));
+	EXPECT_EQ((uintptr_t)64, simulation.index.getPrefixSize(8));
+	EXPECT_EQ(simulation.slots[3], simulation.index.getEntry(9));
+	EXPECT_EQ(simulation.slots[3], simulation.index.getEntry(10));
+	EXPECT_EQ((uintptr_t)256, simulation.index.getPrefixSize(10));
+	/* requests larger than any entry start at the last entry and fail without a walk */
+	EXPECT_EQ(simulation.slots[4], simulation.index.getEntry(11));
+	EXPECT_EQ(simulation.slots[4], simulation.index.getEntry(FREE_LIST_SIZE_INDEX_BINS - 1));
+}
+
+TEST(gcFunctionalTestFreeListSizeIndex, maintenanceMatchesFirstFitFromHead)
+{
+	FreeListSimulation simulation;
+	for (uintptr_t slot = 0; slot < TEST_SLOTS; slot += 2) {
+		simulation.add(slot, 0, TEST_GRANULE * (1 + simulation.random(TEST_SLOT_SIZE / TEST_GRANULE)));
+	}
+	simulation.index.rebuild(simulation.getHead(), false);
+
+	uintptr_t indexedSearches = 0;
+	for (uintptr_t operation = 0; operation < TEST_OPERATIONS; operation++) {
+		uintptr_t slot = simulation.random(TEST_SLOTS);
+		MM_HeapLinkedFreeHeader *entry = simulation.slots[slot];
+		uintptr_t action = simulation.random(4);
+
+		if (NULL == entry) {
+			/* recycle a chunk into an empty slot */
+			uintptr_t offset = TEST_GRANULE * simulation.random(TEST_SLOT_SIZE / (2 * TEST_GRANULE));
+			uintptr_t size = TEST_GRANULE * (1 + simulation.random((TEST_SLOT_SIZE - offset) / TEST_GRANULE));
+			simulation.add(slot, offset, size);
+			simulation.index.insert(simulation.getPrevious(slot), simulation.slots[slot], size);
+		} else if (0 == action) {
+			simulation.slots[slot] = NULL;
+			simulation.link();
+			simulation.index.remove(entry);
+		} else if (1 == action) {
+			/* allocate from the front of the entry and keep the remainder */
+			uintptr_t size = entry->getSize();
+			if (size > TEST_GRANULE) {
+				uintptr_t allocated = TEST_GRANULE * (1 + simulation.random((size / TEST_GRANULE) - 1));
+				uintptr_t offset = ((uintptr_t)entry - (uintptr_t)simulation.buffer) - (slot * TEST_SLOT_SIZE);
+				simulation.add(slot, offset + allocated, size - allocated);
+				simulation.index.replace(entry, simulation.slots[slot]);
+			}
+		} else {
+			/* a search from the index finds the same entry as one from the head, and teaches the index */
+			uintptr_t size = TEST_GRANULE * (1 + simulation.random((2 * TEST_SLOT_SIZE) / TEST_GRANULE));
+			MM_HeapLinkedFreeHeader *previous = NULL;
+			uintptr_t prefixSize = 0;
+			MM_HeapLinkedFreeHeader *expected = simulation.search(NULL, size, &previous, &prefixSize);
+			MM_HeapLinkedFreeHeader *start = simulation.index.getEntry(MM_FreeListSizeIndex::getSizeClass(size));
+			if ((NULL != start) && (start->getSize() < size)) {
+				MM_HeapLinkedFreeHeader *indexedPrevious = NULL;
+				uintptr_t indexedPrefixSize = 0;
+				ASSERT_EQ(expected, simulation.search(start, size, &indexedPrevious, &indexedPrefixSize)) << "operation " << operation;
+				indexedSearches += 1;
+			}
+			if ((NULL != expected) && (NULL != previous)) {
+				simulation.index.update(previous, prefixSize);
+			}
+		}
+		simulation.verify();
+		if (HasFatalFailure()) {
+			FAIL() << "operation " << operation;
+		}
+	}
+	EXPECT_LT((uintptr_t)0, indexedSearches);
+}
@@ -0,0 +1,170 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "HeapMapBulkScanner.hpp"
+
+#include <gtest/gtest.h>
+#include "gcTestHelpers.hpp"
+
+#define TEST_BLOCKS 4
+#define TEST_SLOTS (TEST_BLOCKS * MM_HeapMapBulkScanner::SLOTS_PER_CACHE_LINE)
+#define TEST_BITS_IN_SLOT (sizeof(uintptr_t) * 8)
+
+/**
+ * A cache line aligned map of TEST_SLOTS slots, checked against one slot at a time scans for every start slot
+ * inside the first block, so prologues of every length and ranges ending inside and on block boundaries are covered.
+ */
+class HeapMapBulkScannerTest : public ::testing::TestWithParam<MM_HeapMapBulkScanner::Implementation>
+{
+protected:
+	uintptr_t _storage[TEST_SLOTS + (2 * MM_HeapMapBulkScanner::SLOTS_PER_CACHE_LINE)];
+	uintptr_t *_map;
+
+	virtual void
+	SetUp()
+	{
+		uintptr_t aligned = ((uintptr_t)_storage + 64 - 1) & ~(uintptr_t)(64 - 1);
+		_map = (uintptr_t *)aligned;
+		if (!MM_HeapMapBulkScanner::selectImplementation(gcTestEnv->getPortLibrary(), GetParam())) {
+			_map = NULL;
+		}
+	}
+
+	virtual void
+	TearDown()
+	{
+		MM_HeapMapBulkScanner::initialize(gcTestEnv->getPortLibrary());
+	}
+
+	void
+	fill(uintptr_t value)
+	{
+		for (uintptr_t i = 0; i < TEST_SLOTS; i++) {
+			_map[i] = value;
+		}
+	}
+
+	static uintptr_t *
+	expectedSkip(uintptr_t *slot, uintptr_t *slotTop, uintptr_t skipValue)
+	{
+		while ((slot < slotTop) && (skipValue == *slot)) {
+			slot += 1;
+		}
+		return slot;
+	}
+
+	static uintptr_t
+	slotCount(uintptr_t value)
+	{
+		uintptr_t count = 0;
+		for (uintptr_t bit = 0; bit < TEST_BITS_IN_SLOT; bit++) {
+			count += (value >> bit) & 1;
+		}
+		return count;
+	}
+
+	/**
+	 * Scan every [start, top) with start in the first block and top past it, for both run kinds and the count.
+	 */
+	void
+	checkAllRanges(const char *description)
+	{
+		uintptr_t countBefore[TEST_SLOTS + 1];
+		countBefore[0] = 0;
+		for (uintptr_t i = 0; i < TEST_SLOTS; i++) {
+			countBefore[i + 1] = countBefore[i] + slotCount(_map[i]);
+		}
+
+		for (uintptr_t start = 0; start < MM_HeapMapBulkScanner::SLOTS_PER_CACHE_LINE; start++) {
+			for (uintptr_t top = start; top <= TEST_SLOTS; top++) {
+				uintptr_t *slot = _map + start;
+				uintptr_t *slotTop = _map + top;
+				ASSERT_EQ(expectedSkip(slot, slotTop, 0), MM_HeapMapBulkScanner::skipEmptySlots(slot, slotTop))
+					<< description << " empty run [" << start << ", " << top << ")";
+				ASSERT_EQ(expectedSkip(slot, slotTop, UDATA_MAX), MM_HeapMapBulkScanner::skipFullSlots(slot, slotTop))
+					<< description << " full run [" << start << ", " << top << ")";
+				ASSERT_EQ(countBefore[top] - countBefore[start], MM_HeapMapBulkScanner::countSetBits(slot, slotTop))
+					<< description << " count [" << start << ", " << top << ")";
+			}
+		}
+	}
+};
+
+TEST_P(HeapMapBulkScannerTest, uniformMaps)
+{
+	if (NULL == _map) {
+		return;
+	}
+	fill(0);
+	checkAllRanges("all clear");
+	fill(UDATA_MAX);
+	checkAllRanges("all set");
+}
+
+TEST_P(HeapMapBulkScannerTest, singleBitAtSlotAndBlockBoundaries)
+{
+	if (NULL == _map) {
+		return;
+	}
+	/* the lowest and highest bit of slots at the start, middle and end of each block */
+	uintptr_t bits[] = { 0, TEST_BITS_IN_SLOT - 1 };
+	for (uintptr_t block = 0; block < TEST_BLOCKS; block++) {
+		uintptr_t slots[] = { 0, MM_HeapMapBulkScanner::SLOTS_PER_CACHE_LINE / 2, MM_HeapMapBulkScanner::SLOTS_PER_CACHE_LINE - 1 };
+		for (uintptr_t s = 0; s < sizeof(slots) / sizeof(slots[0]); s++) {
+			for (uintptr_t b = 0; b < sizeof(bits) / sizeof(bits[0]); b++) {
+				uintptr_t index = (block * MM_HeapMapBulkScanner::SLOTS_PER_CACHE_LINE) + slots[s];
+
+				fill(0);
+				_map[index] = (uintptr_t)1 << bits[b];
+				checkAllRanges("single set bit");
+
+				fill(UDATA_MAX);
+				_map[index] = ~((uintptr_t)1 << bits[b]);
+				checkAllRanges("single clear bit");
+			}
+		}
+	}
+}
+
+TEST_P(HeapMapBulkScannerTest, runsEndingAtEverySlot)
+{
+	if (NULL == _map) {
+		return;
+	}
+	for (uintptr_t end = 0; end < TEST_SLOTS; end++) {
+		for (uintptr_t i = 0; i < TEST_SLOTS; i++) {
+			_map[i] = (i < end) ? 0 : UDATA_MAX;
+		}
+		uintptr_t *slotTop = _map + TEST_SLOTS;
+		ASSERT_EQ(_map + end, MM_HeapMapBulkScanner::skipEmptySlots(_map, slotTop)) << "empty run to " << end;
+		ASSERT_EQ(_map + TEST_SLOTS, MM_HeapMapBulkScanner::skipFullSlots(_map + end, slotTop)) << "full run from " << end;
+		ASSERT_EQ((TEST_SLOTS - end) * TEST_BITS_IN_SLOT, MM_HeapMapBulkScanner::countSetBits(_map, slotTop)) << "count to " << end;
+	}
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTestHeapMapBulkScanner, HeapMapBulkScannerTest, ::testing::Values(
+	MM_HeapMapBulkScanner::IMPLEMENTATION_SCALAR,
+	MM_HeapMapBulkScanner::IMPLEMENTATION_SSE2,
+	MM_HeapMapBulkScanner::IMPLEMENTATION_AVX2,
+	MM_HeapMapBulkScanner::IMPLEMENTATION_AVX512));
@@ -0,0 +1,205 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+#include "omrport.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ParallelDispatcher.hpp"
+#include "ParallelTask.hpp"
+#include "StartupManagerTestExample.hpp"
+#include "gcTestHelpers.hpp"
+
+#define SYNC_TEST_FUNCTIONAL_ITERATIONS 300
+#define SYNC_TEST_FUNCTIONAL_THREADS 8
+#define SYNC_TEST_PERF_ITERATIONS 3000
+
+/**
+ * Task that does nothing but pass through synchronization points, rotating between the plain,
+ * release main and release single thread variants. Every thread counts its arrival before each
+ * point, so the count seen inside a released section must be exact.
+ */
+class SynchronizeTestTask : public MM_ParallelTask
+{
+private:
+	uintptr_t _iterations;
+	volatile uintptr_t _arrivals;
+	volatile uintptr_t _failures;
+
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PARALLEL_OBJECT_DO; }
+
+	virtual void
+	run(MM_EnvironmentBase *env)
+	{
+		uintptr_t threadCount = getThreadCount();
+		for (uintptr_t i = 0; i < _iterations; i++) {
+			MM_AtomicOperations::add(&_arrivals, 1);
+			uintptr_t expected = (i + 1) * threadCount;
+			switch (i % 3) {
+			case 0:
+				synchronizeGCThreads(env, UNIQUE_ID);
+				/* faster threads may already have counted the next point */
+				if (_arrivals < expected) {
+					MM_AtomicOperations::add(&_failures, 1);
+				}
+				break;
+			case 1:
+				if (synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+					if (_arrivals != expected) {
+						MM_AtomicOperations::add(&_failures, 1);
+					}
+					releaseSynchronizedGCThreads(env);
+				}
+				break;
+			default:
+				if (synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
+					if (_arrivals != expected) {
+						MM_AtomicOperations::add(&_failures, 1);
+					}
+					releaseSynchronizedGCThreads(env);
+				}
+				break;
+			}
+		}
+	}
+
+	uintptr_t getFailures() { return _failures; }
+
+	SynchronizeTestTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, uintptr_t iterations)
+		: MM_ParallelTask(env, dispatcher)
+		, _iterations(iterations)
+		, _arrivals(0)
+		, _failures(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+class ParallelTaskSynchronizeTest : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+
+	virtual void
+	SetUp()
+	{
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "fvtest/gctest/configuration/global_GC_sync_spin_config.xml");
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread"));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread));
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+	}
+
+	virtual void
+	TearDown()
+	{
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownDispatcherThreads(exampleVM->_omrVMThread));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Free(exampleVM->_omrVMThread));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+		exampleVM->_omrVMThread = NULL;
+	}
+
+	/**
+	 * Dispatch a synchronization test task on threadCount threads.
+	 * @param[out] failures number of synchronization points that let a thread through early
+	 * @return elapsed wall time in nanoseconds
+	 */
+	uint64_t
+	runSynchronizeTask(uintptr_t threadCount, uintptr_t iterations, uintptr_t *failures)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+		MM_ParallelDispatcher *dispatcher = env->getExtensions()->dispatcher;
+		SynchronizeTestTask task(env, dispatcher, iterations);
+
+		env->acquireExclusiveVMAccess();
+		uint64_t start = omrtime_hires_clock();
+		dispatcher->run(env, &task, threadCount);
+		uint64_t elapsed = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+		env->releaseExclusiveVMAccess();
+
+		*failures = task.getFailures();
+		return elapsed;
+	}
+
+public:
+	ParallelTaskSynchronizeTest()
+		: exampleVM(&(gcTestEnv->exampleVM))
+		, env(NULL)
+	{
+	}
+};
+
+class gcFunctionalTestParallelTaskSynchronize : public ParallelTaskSynchronizeTest
+{
+};
+
+/**
+ * Barrier latency microbenchmark: the cost of one synchronization point for 1 to
+ * gcthreadCount threads, with the spin phase disabled (park immediately) and enabled.
+ */
+class perfTestParallelTaskSynchronize : public ParallelTaskSynchronizeTest
+{
+};
+
+TEST_F(gcFunctionalTestParallelTaskSynchronize, synchronize)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t threadCount = OMR_MIN(extensions->dispatcher->threadCountMaximum(), (uintptr_t)SYNC_TEST_FUNCTIONAL_THREADS);
+	bool adaptiveSyncSpin = extensions->adaptiveSyncSpin;
+
+	for (uintptr_t spin = 0; spin < 2; spin++) {
+		extensions->adaptiveSyncSpin = (1 == spin);
+		uintptr_t failures = 0;
+		runSynchronizeTask(threadCount, SYNC_TEST_FUNCTIONAL_ITERATIONS, &failures);
+		EXPECT_EQ((uintptr_t)0, failures) << "adaptiveSyncSpin=" << extensions->adaptiveSyncSpin;
+	}
+
+	extensions->adaptiveSyncSpin = adaptiveSyncSpin;
+}
+
+TEST_F(perfTestParallelTaskSynchronize, latency)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t threadCountMaximum = extensions->dispatcher->threadCountMaximum();
+	bool adaptiveSyncSpin = extensions->adaptiveSyncSpin;
+
+	gcTestEnv->log("%8s %16s %16s\n", "threads", "park ns/sync", "spin ns/sync");
+	for (uintptr_t threadCount = 1; threadCount <= threadCountMaximum; threadCount *= 2) {
+		uint64_t results[2];
+		for (uintptr_t spin = 0; spin < 2; spin++) {
+			extensions->adaptiveSyncSpin = (1 == spin);
+			uintptr_t failures = 0;
+			results[spin] = runSynchronizeTask(threadCount, SYNC_TEST_PERF_ITERATIONS, &failures);
+			EXPECT_EQ((uintptr_t)0, failures);
+		}
+		gcTestEnv->log("%8zu %16.1f %16.1f\n", threadCount,
+				(double)results[0] / SYNC_TEST_PERF_ITERATIONS,
+				(double)results[1] / SYNC_TEST_PERF_ITERATIONS);
+	}
+
+	extensions->adaptiveSyncSpin = adaptiveSyncSpin;
+}
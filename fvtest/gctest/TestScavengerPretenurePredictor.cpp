@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "ScavengerPretenurePredictor.hpp"
+
+#include <gtest/gtest.h>
+
+#define TEST_LONG_LIVED_SIZE_CLASS 6
+#define TEST_SHORT_LIVED_SIZE_CLASS 10
+#define TEST_ALLOCATED_BYTES 100000
+#define TEST_SAMPLE_FRACTION 10
+#define TEST_TENURE_AGE 1
+#define TEST_THRESHOLD_PERCENT 90
+#define TEST_SCAVENGES 40
+
+/**
+ * Simulates scavenges of a nursery where everything allocated in TEST_LONG_LIVED_SIZE_CLASS survives to tenure
+ * and a tenth of TEST_SHORT_LIVED_SIZE_CLASS survives its first scavenge. A pretenured size class allocates
+ * nothing in new space. Only a fraction of the allocation is sampled by size class, as on the TLH slow path.
+ */
+class PretenureSimulation
+{
+public:
+	MM_ScavengerPretenurePredictor predictor;
+	uintptr_t previousSurvivedBytes[OMR_ALLOCATION_SIZE_CLASS_BINS];
+
+	PretenureSimulation()
+	{
+		memset(previousSurvivedBytes, 0, sizeof(previousSurvivedBytes));
+	}
+
+	uintptr_t
+	scavenge()
+	{
+		uintptr_t sizeClasses[] = { TEST_LONG_LIVED_SIZE_CLASS, TEST_SHORT_LIVED_SIZE_CLASS };
+		uintptr_t sampledBytes[OMR_ALLOCATION_SIZE_CLASS_BINS];
+		uintptr_t survivedBytes[OBJECT_HEADER_AGE_MAX + 1][OMR_ALLOCATION_SIZE_CLASS_BINS];
+		uintptr_t nurseryBytes = 0;
+
+		memset(sampledBytes, 0, sizeof(sampledBytes));
+		memset(survivedBytes, 0, sizeof(survivedBytes));
+		for (uintptr_t i = 0; i < sizeof(sizeClasses) / sizeof(sizeClasses[0]); i++) {
+			uintptr_t sizeClass = sizeClasses[i];
+			uintptr_t allocatedBytes = 0;
+			if (0 == (predictor.getSizeClassMask() & ((uintptr_t)1 << sizeClass))) {
+				allocatedBytes = TEST_ALLOCATED_BYTES;
+			}
+			nurseryBytes += allocatedBytes;
+			sampledBytes[sizeClass] = allocatedBytes / TEST_SAMPLE_FRACTION;
+			survivedBytes[0][sizeClass] = (TEST_LONG_LIVED_SIZE_CLASS == sizeClass) ? allocatedBytes : (allocatedBytes / 10);
+			survivedBytes[1][sizeClass] = previousSurvivedBytes[sizeClass];
+			previousSurvivedBytes[sizeClass] = survivedBytes[0][sizeClass];
+		}
+
+		return predictor.update(nurseryBytes, sampledBytes, survivedBytes, TEST_TENURE_AGE, TEST_THRESHOLD_PERCENT);
+	}
+};
+
+TEST(gcFunctionalTestScavengerPretenurePredictor, longLivedSizeClassIsPretenuredWithBackoff)
+{
+	PretenureSimulation simulation;
+	bool pretenured[TEST_SCAVENGES];
+
+	for (uintptr_t i = 0; i < TEST_SCAVENGES; i++) {
+		uintptr_t mask = simulation.scavenge();
+		EXPECT_EQ(mask, simulation.predictor.getSizeClassMask());
+		pretenured[i] = (0 != (mask & ((uintptr_t)1 << TEST_LONG_LIVED_SIZE_CLASS)));
+	}
+
+	/* the smoothed survival rates need a few scavenges to reach the threshold */
+	uintptr_t first = 0;
+	while ((first < TEST_SCAVENGES) && !pretenured[first]) {
+		first += 1;
+	}
+	ASSERT_GT(first, (uintptr_t)0);
+	ASSERT_LT(first + 3 * SCAVENGER_PRETENURE_INITIAL_SCAVENGES + 2, (uintptr_t)TEST_SCAVENGES);
+
+	/* pretenured for the initial period, sampled in new space for one scavenge, then pretenured for twice as long */
+	uintptr_t i = first;
+	for (uintptr_t end = i + SCAVENGER_PRETENURE_INITIAL_SCAVENGES; i < end; i++) {
+		EXPECT_TRUE(pretenured[i]) << "scavenge " << i;
+	}
+	EXPECT_FALSE(pretenured[i]) << "scavenge " << i;
+	i += 1;
+	for (uintptr_t end = i + 2 * SCAVENGER_PRETENURE_INITIAL_SCAVENGES; i < end; i++) {
+		EXPECT_TRUE(pretenured[i]) << "scavenge " << i;
+	}
+	EXPECT_FALSE(pretenured[i]) << "scavenge " << i;
+}
+
+TEST(gcFunctionalTestScavengerPretenurePredictor, sampledAllocationIsScaledByNurseryVolume)
+{
+	PretenureSimulation simulation;
+
+	/* measured against its sampled bytes alone the short lived class would appear to survive completely */
+	for (uintptr_t i = 0; i < TEST_SCAVENGES; i++) {
+		uintptr_t mask = simulation.scavenge();
+		EXPECT_EQ((uintptr_t)0, mask & ((uintptr_t)1 << TEST_SHORT_LIVED_SIZE_CLASS)) << "scavenge " << i;
+	}
+}
+
+TEST(gcFunctionalTestScavengerPretenurePredictor, noAllocationKeepsMaskClear)
+{
+	MM_ScavengerPretenurePredictor predictor;
+	uintptr_t sampledBytes[OMR_ALLOCATION_SIZE_CLASS_BINS];
+	uintptr_t survivedBytes[OBJECT_HEADER_AGE_MAX + 1][OMR_ALLOCATION_SIZE_CLASS_BINS];
+
+	memset(sampledBytes, 0, sizeof(sampledBytes));
+	memset(survivedBytes, 0, sizeof(survivedBytes));
+	for (uintptr_t i = 0; i < TEST_SCAVENGES; i++) {
+		EXPECT_EQ((uintptr_t)0, predictor.update(TEST_ALLOCATED_BYTES, sampledBytes, survivedBytes, TEST_TENURE_AGE, TEST_THRESHOLD_PERCENT));
+	}
+}
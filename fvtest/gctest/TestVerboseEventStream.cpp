@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrstdarg.h"
+
+#include "VerboseEventStream.hpp"
+#include "gcTestHelpers.hpp"
+
+#define EVENT_TEST_BUFFER_SIZE 1024
+
+/**
+ * Encode a formatAndOutput() call, render it, and compare the text with what MM_VerboseBuffer formats:
+ * two spaces per indent level, the formatted text and a newline.
+ */
+static void
+expectRenderMatchesFormat(uintptr_t indent, const char *format, ...)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	uint8_t event[EVENT_TEST_BUFFER_SIZE];
+	char expected[EVENT_TEST_BUFFER_SIZE];
+	char rendered[EVENT_TEST_BUFFER_SIZE];
+	va_list args;
+
+	uintptr_t expectedLength = 0;
+	for (uintptr_t i = 0; i < indent; i++) {
+		expectedLength += omrstr_printf(expected + expectedLength, sizeof(expected) - expectedLength, "  ");
+	}
+	va_start(args, format);
+	expectedLength += omrstr_vprintf(expected + expectedLength, sizeof(expected) - expectedLength, format, args);
+	va_end(args);
+	expectedLength += omrstr_printf(expected + expectedLength, sizeof(expected) - expectedLength, "\n");
+
+	va_start(args, format);
+	uintptr_t eventLength = MM_VerboseEventStream::encode(event, sizeof(event), indent, 0, format, args);
+	va_end(args);
+	ASSERT_NE((uintptr_t)0, eventLength) << format;
+	ASSERT_GE(sizeof(event), eventLength) << format;
+	ASSERT_EQ(eventLength, MM_VerboseEventStream::getEventLength(event)) << format;
+
+	/* Encoding without a buffer only measures the event */
+	va_start(args, format);
+	ASSERT_EQ(eventLength, MM_VerboseEventStream::encode(NULL, 0, indent, 0, format, args)) << format;
+	va_end(args);
+
+	uintptr_t renderedLength = MM_VerboseEventStream::render(OMRPORTLIB, event, rendered, sizeof(rendered));
+	EXPECT_EQ(expectedLength, renderedLength) << format;
+	EXPECT_STREQ(expected, rendered) << format;
+
+	/* A buffer that is too small reports the full length and holds a truncated copy */
+	char truncated[8];
+	EXPECT_EQ(expectedLength, MM_VerboseEventStream::render(OMRPORTLIB, event, truncated, sizeof(truncated))) << format;
+	EXPECT_EQ(0, strncmp(expected, truncated, sizeof(truncated) - 1)) << format;
+	EXPECT_EQ('\0', truncated[sizeof(truncated) - 1]) << format;
+}
+
+TEST(gcFunctionalTestVerboseEventStream, renderMatchesFormattedText)
+{
+	char stackString[64];
+	strcpy(stackString, "id=\"12\" type=\"global\" contextid=\"3\"");
+
+	expectRenderMatchesFormat(0, "<warning details=\"clock error detected, following timing may be inaccurate\" />");
+	expectRenderMatchesFormat(0, "<gc-end %s activeThreads=\"%zu\">", stackString, (uintptr_t)4);
+	expectRenderMatchesFormat(1, "<mem type=\"tenure\" free=\"%zu\" total=\"%zu\" percent=\"%zu\" />", (uintptr_t)123456789, (uintptr_t)987654321, (uintptr_t)12);
+	expectRenderMatchesFormat(2, "intervalms=\"%llu.%03llu\"", (uint64_t)1234, (uint64_t)7);
+	expectRenderMatchesFormat(1, "<scavenger-info tenureage=\"%zu\" tenuremask=\"%4zx\" />", (uintptr_t)10, (uintptr_t)0xfe);
+	expectRenderMatchesFormat(0, "<attribute name=\"%s\" value=\"%p\" />", "heapBase", (void *)stackString);
+	expectRenderMatchesFormat(0, "%d%% %u %x %c", -5, 17u, 0xbeefu, 'z');
+	expectRenderMatchesFormat(0, "[%*s] [%.*s] [%-6s]", 8, "right", 3, "truncate", "left");
+	expectRenderMatchesFormat(0, "reason=\"%s\"", (const char *)NULL);
+	expectRenderMatchesFormat(0, "ratio=\"%f\" %lu", 0.625, 42ul);
+	expectRenderMatchesFormat(3, "");
+}
+
+TEST(gcFunctionalTestVerboseEventStream, encodedStringsAreCopies)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	uint8_t event[EVENT_TEST_BUFFER_SIZE];
+	char rendered[EVENT_TEST_BUFFER_SIZE];
+	char stackString[16];
+
+	strcpy(stackString, "before");
+	uintptr_t eventLength = MM_VerboseEventStream::encodeString(event, sizeof(event), 1, MM_VerboseEventStream::EVENT_FLAG_NO_NEWLINE, stackString);
+	ASSERT_GE(sizeof(event), eventLength);
+	strcpy(stackString, "after");
+
+	MM_VerboseEventStream::render(OMRPORTLIB, event, rendered, sizeof(rendered));
+	EXPECT_STREQ("  before", rendered);
+}
+
+static uintptr_t
+encodedLength(const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	uintptr_t length = MM_VerboseEventStream::encode(NULL, 0, 0, 0, format, args);
+	va_end(args);
+	return length;
+}
+
+TEST(gcFunctionalTestVerboseEventStream, positionalArgumentsAreRejected)
+{
+	EXPECT_EQ((uintptr_t)0, encodedLength("%1$s", "positional"));
+	EXPECT_NE((uintptr_t)0, encodedLength("%s", "sequential"));
+}
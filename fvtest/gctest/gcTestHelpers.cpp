@@ -34,6 +34,8 @@ GCTestEnvironment::initParams()
 	for (int i = 1; i < _argc; i++) {
 		if (0 == strcmp(_argv[i], "-keepVerboseLog")) {
 			keepLog = true;
+		} else if (0 == strncmp(_argv[i], "-gcThreadCount=", strlen("-gcThreadCount="))) {
+			gcThreadCount = (uintptr_t)atoi(_argv[i] + strlen("-gcThreadCount="));
 		}
 	}
 }
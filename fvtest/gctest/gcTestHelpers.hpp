@@ -43,6 +43,7 @@ public:
 	OMR_VM_Example exampleVM;
 	std::vector<const char *> params;
 	bool keepLog;
+	uintptr_t gcThreadCount; /**< GC thread count forced on every configuration by -gcThreadCount=<n>, 0 to use the configuration's own */
 
 	/*
 	 * Function members
@@ -60,7 +61,7 @@ public:
 
 public:
 	GCTestEnvironment(int argc, char **argv)
-	: BaseEnvironment(argc, argv), keepLog(false)
+	: BaseEnvironment(argc, argv), keepLog(false), gcThreadCount(0)
 	{
 	}
 };
@@ -203,6 +203,14 @@ TEST(PortVmemTest, vmem_verify_functiontable_slots)
 		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->vmem_supported_page_sizes, is NULL\n");
 	}
 
+	if (NULL == OMRPORTLIB->vmem_advise_huge_pages) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->vmem_advise_huge_pages, is NULL\n");
+	}
+
+	if (NULL == OMRPORTLIB->vmem_get_huge_page_backed_size) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->vmem_get_huge_page_backed_size, is NULL\n");
+	}
+
 	reportTestExit(OMRPORTLIB, testName);
 }
 
@@ -4513,6 +4521,83 @@ TEST(PortVmemTest, vmem_testGetProcessMemorySize)
 	EXPECT_EQ(0u, size) << "value updated when query invalid";
 }
 
+/**
+ * Advise huge page backing for one committed range and against it for the adjacent range, then verify the
+ * backed size reported for each.  The range advised against huge pages must never be reported as backed, and a
+ * range that was successfully collapsed must be.  Whether huge pages are available at all depends on the system
+ * configuration, so the positive check only applies where the collapse succeeded.
+ */
+TEST(PortVmemTest, vmem_testAdviseHugePages)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "vmem_testAdviseHugePages";
+	struct J9PortVmemIdentifier vmemID;
+	uintptr_t pageSize = omrvmem_supported_page_sizes()[0];
+	uintptr_t hugePageSize = 2 * ONE_MB;
+	/* slack so that both ranges can be huge page aligned */
+	uintptr_t byteAmount = 4 * hugePageSize;
+	uint64_t backedSize = 0;
+	int32_t enableRC = 0;
+	int32_t disableRC = 0;
+	int32_t collapseRC = 0;
+	int32_t rc = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	char *memPtr = (char *)omrvmem_reserve_memory(
+					0, byteAmount, &vmemID,
+					OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE | OMRPORT_VMEM_MEMORY_MODE_COMMIT,
+					pageSize, OMRMEM_CATEGORY_PORT_LIBRARY);
+	ASSERT_TRUE(NULL != memPtr) << "unable to reserve and commit memory";
+
+	char *hugeRange = (char *)(((uintptr_t)memPtr + hugePageSize - 1) & ~(hugePageSize - 1));
+	char *smallRange = hugeRange + hugePageSize;
+
+	enableRC = omrvmem_advise_huge_pages(hugeRange, hugePageSize, OMRPORT_VMEM_HUGE_PAGE_ADVICE_ENABLE);
+	disableRC = omrvmem_advise_huge_pages(smallRange, hugePageSize, OMRPORT_VMEM_HUGE_PAGE_ADVICE_DISABLE);
+#if defined(LINUX)
+	EXPECT_TRUE((0 == enableRC) || (OMRPORT_ERROR_VMEM_NOT_SUPPORTED == enableRC)) << "OMRPORT_VMEM_HUGE_PAGE_ADVICE_ENABLE failed";
+	EXPECT_TRUE((0 == disableRC) || (OMRPORT_ERROR_VMEM_NOT_SUPPORTED == disableRC)) << "OMRPORT_VMEM_HUGE_PAGE_ADVICE_DISABLE failed";
+#else /* defined(LINUX) */
+	EXPECT_EQ(OMRPORT_ERROR_VMEM_NOT_SUPPORTED, enableRC) << "huge page advice should not be supported";
+	EXPECT_EQ(OMRPORT_ERROR_VMEM_NOT_SUPPORTED, disableRC) << "huge page advice should not be supported";
+#endif /* defined(LINUX) */
+	memset(hugeRange, 0xA5, 2 * hugePageSize);
+
+	if (0 == enableRC) {
+		collapseRC = omrvmem_advise_huge_pages(hugeRange, hugePageSize, OMRPORT_VMEM_HUGE_PAGE_ADVICE_COLLAPSE);
+		EXPECT_TRUE((0 == collapseRC) || (OMRPORT_ERROR_VMEM_NOT_SUPPORTED == collapseRC) || (OMRPORT_ERROR_VMEM_OPFAILED == collapseRC))
+			<< "unexpected OMRPORT_VMEM_HUGE_PAGE_ADVICE_COLLAPSE result " << collapseRC;
+	}
+
+	rc = omrvmem_get_huge_page_backed_size(hugeRange, hugePageSize, &backedSize);
+#if defined(LINUX)
+	ASSERT_EQ(0, rc) << "omrvmem_get_huge_page_backed_size failed";
+	EXPECT_LE(backedSize, (uint64_t)hugePageSize) << "more bytes backed by huge pages than requested";
+	if ((0 == enableRC) && (0 == collapseRC)) {
+		EXPECT_GT(backedSize, (uint64_t)0) << "collapsed range is not reported as huge page backed";
+	}
+	portTestEnv->log("0x%zx of 0x%zx advised bytes backed by huge pages (collapse rc %d)\n", (uintptr_t)backedSize, hugePageSize, collapseRC);
+#else /* defined(LINUX) */
+	EXPECT_EQ(OMRPORT_ERROR_VMEM_NOT_SUPPORTED, rc) << "huge page backed size should not be supported";
+#endif /* defined(LINUX) */
+
+#if defined(LINUX)
+	if (0 == disableRC) {
+		backedSize = UINT64_MAX;
+		rc = omrvmem_get_huge_page_backed_size(smallRange, hugePageSize, &backedSize);
+		ASSERT_EQ(0, rc) << "omrvmem_get_huge_page_backed_size failed";
+		EXPECT_EQ((uint64_t)0, backedSize) << "range advised against huge pages is reported as huge page backed";
+	}
+
+	rc = omrvmem_advise_huge_pages(hugeRange, hugePageSize, 0);
+	EXPECT_EQ(OMRPORT_ERROR_VMEM_OPFAILED, rc) << "invalid advice not detected";
+#endif /* defined(LINUX) */
+
+	omrvmem_free_memory(memPtr, byteAmount, &vmemID);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
 /**
  * Sanity test of function to obtain available physical memory.
  */
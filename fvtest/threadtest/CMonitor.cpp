@@ -152,6 +152,10 @@ CMonitor::numBlocking(void)
 		q = q->next;
 	}
 	MONITOR_UNLOCK(m_monitor);
+#if defined(OMR_THR_FUTEX_LOCKS)
+	/* threads sleeping on the spinlock futex are counted rather than queued */
+	count += (unsigned int)mon->futexWaiters;
+#endif /* defined(OMR_THR_FUTEX_LOCKS) */
 	return count;
 }
 
@@ -173,6 +177,14 @@ CMonitor::isThreadBlocking(CThread& thread)
 	}
 
 	MONITOR_UNLOCK(m_monitor);
+#if defined(OMR_THR_FUTEX_LOCKS)
+	if (!found) {
+		/* a thread sleeping on the spinlock futex is only marked blocked on the monitor */
+		THREAD_LOCK(jthread, 0);
+		found = (m_monitor == jthread->monitor) && OMR_ARE_ALL_BITS_SET(jthread->flags, J9THREAD_FLAG_BLOCKED);
+		THREAD_UNLOCK(jthread);
+	}
+#endif /* defined(OMR_THR_FUTEX_LOCKS) */
 	return found;
 }
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
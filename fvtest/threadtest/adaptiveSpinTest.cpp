@@ -0,0 +1,139 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Tests for adaptive spin tuning: sampled hold times above adaptSpinHoldtime shrink a monitor's
+ * spin counts, and short hold times grow them back to the defaults.
+ */
+
+#include "omrcfg.h"
+#include "omrutilbase.h"
+#include "threadTestLib.hpp"
+#include "omrTest.h"
+
+#if defined(OMR_THR_ADAPTIVE_SPIN) && defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_JLM_HOLD_TIMES)
+
+#define LONG_HOLD_MILLIS 5
+#define TUNING_ITERATIONS 40
+
+class AdaptiveSpinTest : public ::testing::Test
+{
+protected:
+	CMonitor *mon;
+	omrthread_monitor_t monitor;
+	uintptr_t *holdtime;
+	uintptr_t *sampleThreshold;
+	uintptr_t savedHoldtime;
+	uintptr_t savedSampleThreshold;
+	uintptr_t savedLibFlags;
+
+	virtual void
+	SetUp()
+	{
+		/* The hold time threshold is in timebase ticks: make it about a millisecond. */
+		uint64_t start = getTimebase();
+		omrthread_sleep(10);
+		uint64_t ticksPerMilli = (getTimebase() - start) / 10;
+
+		holdtime = *(uintptr_t **)omrthread_global((char *)"adaptSpinHoldtime");
+		sampleThreshold = *(uintptr_t **)omrthread_global((char *)"adaptSpinSampleThreshold");
+		savedHoldtime = *holdtime;
+		savedSampleThreshold = *sampleThreshold;
+		savedLibFlags = omrthread_lib_get_flags();
+		*holdtime = (uintptr_t)ticksPerMilli;
+		/* sample every enter */
+		*sampleThreshold = 0;
+
+		*omrthread_global((char *)"adaptSpinTuneEnable") = 1;
+		ASSERT_EQ(0, jlm_adaptive_spin_init());
+		ASSERT_TRUE(OMR_ARE_ALL_BITS_SET(omrthread_lib_get_flags(), J9THREAD_LIB_FLAG_ADAPTIVE_SPIN_TUNING_ENABLED));
+		mon = new CMonitor(0, "adaptiveSpinTest");
+		monitor = mon->GetMonitor();
+	}
+
+	virtual void
+	TearDown()
+	{
+		delete mon;
+		*omrthread_global((char *)"adaptSpinTuneEnable") = 0;
+		omrthread_lib_clear_flags((J9THREAD_LIB_FLAG_ADAPTIVE_SPIN_TUNING_ENABLED | J9THREAD_LIB_FLAG_JLM_HOLDTIME_SAMPLING_ENABLED) & ~savedLibFlags);
+		*holdtime = savedHoldtime;
+		*sampleThreshold = savedSampleThreshold;
+	}
+
+	/**
+	 * Sampling starts on the first slow enter, so block another thread on the monitor once.
+	 */
+	void
+	startSampling()
+	{
+		mon->Enter();
+		CEnterExit contender(*mon, 0);
+		contender.Start();
+		while (0 == mon->numBlocking()) {
+			omrthread_sleep(1);
+		}
+		mon->Exit();
+		while (!contender.Terminated()) {
+			omrthread_sleep(1);
+		}
+		ASSERT_EQ((uintptr_t)0, (monitor->flags & J9THREAD_MONITOR_STOP_SAMPLING));
+	}
+
+	void
+	holdMonitor(uintptr_t count, int64_t millis)
+	{
+		for (uintptr_t i = 0; i < count; i++) {
+			omrthread_monitor_enter(monitor);
+			if (0 != millis) {
+				omrthread_sleep(millis);
+			}
+			omrthread_monitor_exit(monitor);
+		}
+	}
+};
+
+TEST_F(AdaptiveSpinTest, LongHoldsShrinkSpinning)
+{
+	ASSERT_NO_FATAL_FAILURE(startSampling());
+
+	holdMonitor(TUNING_ITERATIONS, LONG_HOLD_MILLIS);
+	EXPECT_EQ((uintptr_t)1, monitor->spinCount2);
+	EXPECT_EQ((uintptr_t)1, monitor->spinCount3);
+	EXPECT_EQ((uintptr_t)0, (monitor->flags & J9THREAD_MONITOR_STOP_SAMPLING)) << "tuning must keep sampling";
+}
+
+TEST_F(AdaptiveSpinTest, ShortHoldsRestoreSpinning)
+{
+	omrthread_library_t lib = omrthread_self()->library;
+	ASSERT_NO_FATAL_FAILURE(startSampling());
+
+	holdMonitor(TUNING_ITERATIONS, LONG_HOLD_MILLIS);
+	ASSERT_EQ((uintptr_t)1, monitor->spinCount3);
+
+	/* Uncontended short holds grow the counts back to the defaults, but not past them. */
+	holdMonitor(10 * TUNING_ITERATIONS, 0);
+	EXPECT_EQ(lib->defaultMonitorSpinCount2, monitor->spinCount2);
+	EXPECT_EQ(lib->defaultMonitorSpinCount3, monitor->spinCount3);
+}
+
+#endif /* defined(OMR_THR_ADAPTIVE_SPIN) && defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_JLM_HOLD_TIMES) */
@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Tests for the sampling contention profiler: blocking monitor enters are recorded with their
+ * call stacks and dumped in collapsed-stack format.
+ */
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "contentionprofiler.h"
+#include "threadTestLib.hpp"
+#include "omrTest.h"
+
+#if defined(OMR_THR_JLM) && defined(OMR_THR_THREE_TIER_LOCKING)
+
+#define PROFILER_MAX_SAMPLES 64
+#define PROFILER_HOLD_MILLIS 20
+#define PROFILER_DUMP_FILE "contentionProfilerTest.collapsed"
+#define PROFILER_MONITOR_NAME "contentionProfilerTest monitor"
+
+class ContentionProfilerTest : public ::testing::Test
+{
+protected:
+	OMRContentionProfiler *profiler;
+	CMonitor *mon;
+
+	virtual void
+	SetUp()
+	{
+		profiler = contentionProfilerNew(omrTestEnv->getPortLibrary(), PROFILER_MAX_SAMPLES);
+		ASSERT_TRUE(NULL != profiler);
+		mon = new CMonitor(0, PROFILER_MONITOR_NAME);
+	}
+
+	virtual void
+	TearDown()
+	{
+		contentionProfilerStop(profiler);
+		contentionProfilerFree(profiler);
+		delete mon;
+	}
+
+	/**
+	 * Hold the monitor while another thread blocks trying to enter it.
+	 */
+	void
+	contendMonitor()
+	{
+		mon->Enter();
+		CEnterExit contender(*mon, 0);
+		contender.Start();
+		while (0 == mon->numBlocking()) {
+			omrthread_sleep(1);
+		}
+		omrthread_sleep(PROFILER_HOLD_MILLIS);
+		mon->Exit();
+		while (!contender.Terminated()) {
+			omrthread_sleep(1);
+		}
+	}
+};
+
+TEST_F(ContentionProfilerTest, SamplesBlockedEnters)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	char dump[4096];
+
+	ASSERT_EQ(0, contentionProfilerStart(profiler, 1));
+	ASSERT_NO_FATAL_FAILURE(contendMonitor());
+	/* Other monitors may also have been contended, e.g. while starting the thread. */
+	OMRContentionSample *sample = NULL;
+	for (uintptr_t i = 0; i < contentionProfilerGetSampleCount(profiler); i++) {
+		if (0 == strcmp(PROFILER_MONITOR_NAME, profiler->samples[i].monitorName)) {
+			ASSERT_TRUE(NULL == sample) << "the contender blocked once";
+			sample = &profiler->samples[i];
+		}
+	}
+	ASSERT_TRUE(NULL != sample);
+#if defined(LINUX) || defined(OSX) || defined(OMR_OS_WINDOWS)
+	EXPECT_LT((uintptr_t)0, sample->frameCount);
+#endif /* defined(LINUX) || defined(OSX) || defined(OMR_OS_WINDOWS) */
+
+	intptr_t fd = omrfile_open(PROFILER_DUMP_FILE, EsOpenCreate | EsOpenWrite | EsOpenTruncate, 0666);
+	ASSERT_NE(-1, fd);
+	ASSERT_EQ(0, contentionProfilerDump(profiler, fd));
+	omrfile_close(fd);
+
+	fd = omrfile_open(PROFILER_DUMP_FILE, EsOpenRead, 0444);
+	ASSERT_NE(-1, fd);
+	intptr_t length = omrfile_read(fd, dump, sizeof(dump) - 1);
+	omrfile_close(fd);
+	omrfile_unlink(PROFILER_DUMP_FILE);
+	ASSERT_LT(0, length);
+	dump[length] = '\0';
+	omrTestEnv->log(LEVEL_INFO, "%s", dump);
+
+	/* Frames, then the monitor name as the leaf, then the blocked microseconds. */
+	char *leaf = strstr(dump, ";" PROFILER_MONITOR_NAME " ");
+	ASSERT_TRUE(NULL != leaf) << dump;
+	char *end = NULL;
+	uint64_t blockedMicros = strtoull(leaf + strlen(";" PROFILER_MONITOR_NAME " "), &end, 10);
+	EXPECT_EQ('\n', *end);
+	/* The contender blocked for about PROFILER_HOLD_MILLIS. */
+	EXPECT_LE((uint64_t)(PROFILER_HOLD_MILLIS * 1000 / 2), blockedMicros);
+}
+
+TEST_F(ContentionProfilerTest, StopEndsSampling)
+{
+	ASSERT_EQ(0, contentionProfilerStart(profiler, 1));
+	ASSERT_NO_FATAL_FAILURE(contendMonitor());
+	uintptr_t sampleCount = contentionProfilerGetSampleCount(profiler);
+	ASSERT_LT((uintptr_t)0, sampleCount);
+
+	contentionProfilerStop(profiler);
+	ASSERT_NO_FATAL_FAILURE(contendMonitor());
+	EXPECT_EQ(sampleCount, contentionProfilerGetSampleCount(profiler));
+}
+
+#endif /* defined(OMR_THR_JLM) && defined(OMR_THR_THREE_TIER_LOCKING) */
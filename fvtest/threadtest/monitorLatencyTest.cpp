@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Microbenchmark of omrthread_monitor_enter/exit latency: uncontended, lightly contended (two threads
+ * with work outside the monitor) and heavily contended (many threads, empty critical section).
+ * Each case also checks that the monitor kept the increments made inside it exact.
+ * Run with -logLevel=info to see the measured latencies.
+ */
+
+#include "omrport.h"
+#include "omrTest.h"
+#include "testHelper.hpp"
+#include "thread_api.h"
+
+#define UNCONTENDED_ITERATIONS 1000000
+#define LIGHT_THREADS 2
+#define LIGHT_ITERATIONS 100000
+#define LIGHT_WORK 200
+#define HEAVY_THREADS 8
+#define HEAVY_ITERATIONS 20000
+#define MAX_THREADS 8
+
+typedef struct MonitorLatencyInfo {
+	omrthread_monitor_t monitor; /* monitor being measured */
+	omrthread_monitor_t control; /* releases the measuring threads together */
+	uintptr_t iterations;
+	uintptr_t work;
+	volatile uintptr_t counter;
+	uintptr_t started;
+	BOOLEAN go;
+} MonitorLatencyInfo;
+
+static void
+enterExitLoop(MonitorLatencyInfo *info)
+{
+	for (uintptr_t i = 0; i < info->iterations; i++) {
+		omrthread_monitor_enter(info->monitor);
+		info->counter += 1;
+		omrthread_monitor_exit(info->monitor);
+		for (volatile uintptr_t w = 0; w < info->work; w++) {
+		}
+	}
+}
+
+static int J9THREAD_PROC
+enterExitThread(void *entryArg)
+{
+	MonitorLatencyInfo *info = (MonitorLatencyInfo *)entryArg;
+
+	omrthread_monitor_enter(info->control);
+	info->started += 1;
+	omrthread_monitor_notify_all(info->control);
+	while (!info->go) {
+		omrthread_monitor_wait(info->control);
+	}
+	omrthread_monitor_exit(info->control);
+
+	enterExitLoop(info);
+	return 0;
+}
+
+/**
+ * Run enter/exit pairs on threadCount new threads, all released at once.
+ * @param[out] nsPerPair nanoseconds per enter/exit pair, across all threads
+ * @param[out] counter increments made inside the monitor
+ */
+static void
+measureEnterExit(uintptr_t threadCount, uintptr_t iterations, uintptr_t work, double *nsPerPair, uintptr_t *counter)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	omrthread_t threads[MAX_THREADS];
+	MonitorLatencyInfo info;
+	memset(&info, 0, sizeof(info));
+	info.iterations = iterations;
+	info.work = work;
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&info.monitor, 0, "monitorLatencyTest monitor"));
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&info.control, 0, "monitorLatencyTest control"));
+
+	ASSERT_LE(threadCount, (uintptr_t)MAX_THREADS);
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		omrthread_attr_t attr = NULL;
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&threads[i], &attr, 0, enterExitThread, &info));
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_destroy(&attr));
+	}
+
+	omrthread_monitor_enter(info.control);
+	while (info.started < threadCount) {
+		omrthread_monitor_wait(info.control);
+	}
+	uint64_t start = omrtime_hires_clock();
+	info.go = TRUE;
+	omrthread_monitor_notify_all(info.control);
+	omrthread_monitor_exit(info.control);
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_join(threads[i]));
+	}
+	uint64_t elapsed = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+
+	omrthread_monitor_destroy(info.control);
+	omrthread_monitor_destroy(info.monitor);
+	*nsPerPair = (double)elapsed / (double)(threadCount * iterations);
+	*counter = info.counter;
+}
+
+TEST(MonitorLatencyTest, Uncontended)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	MonitorLatencyInfo info;
+	memset(&info, 0, sizeof(info));
+	info.iterations = UNCONTENDED_ITERATIONS;
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&info.monitor, 0, "monitorLatencyTest monitor"));
+
+	uint64_t start = omrtime_hires_clock();
+	enterExitLoop(&info);
+	uint64_t elapsed = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+
+	omrthread_monitor_destroy(info.monitor);
+	ASSERT_EQ((uintptr_t)UNCONTENDED_ITERATIONS, info.counter);
+	omrTestEnv->log(LEVEL_INFO, "uncontended: %.1f ns per enter/exit\n", (double)elapsed / UNCONTENDED_ITERATIONS);
+}
+
+TEST(MonitorLatencyTest, LightlyContended)
+{
+	uintptr_t counter = 0;
+	double latency = 0.0;
+	ASSERT_NO_FATAL_FAILURE(measureEnterExit(LIGHT_THREADS, LIGHT_ITERATIONS, LIGHT_WORK, &latency, &counter));
+	ASSERT_EQ((uintptr_t)(LIGHT_THREADS * LIGHT_ITERATIONS), counter);
+	omrTestEnv->log(LEVEL_INFO, "lightly contended (%d threads): %.1f ns per enter/exit\n", LIGHT_THREADS, latency);
+}
+
+TEST(MonitorLatencyTest, HeavilyContended)
+{
+	uintptr_t counter = 0;
+	double latency = 0.0;
+	ASSERT_NO_FATAL_FAILURE(measureEnterExit(HEAVY_THREADS, HEAVY_ITERATIONS, 0, &latency, &counter));
+	ASSERT_EQ((uintptr_t)(HEAVY_THREADS * HEAVY_ITERATIONS), counter);
+	omrTestEnv->log(LEVEL_INFO, "heavily contended (%d threads): %.1f ns per enter/exit\n", HEAVY_THREADS, latency);
+}
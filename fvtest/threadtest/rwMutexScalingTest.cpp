@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Read scaling microbenchmark of omrthread_rwmutex: 1 to 128 reader threads entering and exiting
+ * the same mutex for read, with a few concurrent writes, for the default and the reader-biased
+ * mutex. Readers check that they never see a write in progress.
+ * Run with -logLevel=info to see the measured latencies.
+ */
+
+#include "omrport.h"
+#include "omrTest.h"
+#include "testHelper.hpp"
+#include "thread_api.h"
+
+#define SCALING_MAX_READERS 128
+#define SCALING_READ_ITERATIONS 10000
+#define SCALING_WRITES 10
+
+typedef struct RWMutexScalingInfo {
+	omrthread_rwmutex_t mutex; /* mutex being measured */
+	omrthread_monitor_t control; /* releases the reader threads together */
+	uintptr_t iterations;
+	volatile uintptr_t first; /* first and second are only different while a write is in progress */
+	volatile uintptr_t second;
+	volatile uintptr_t torn;
+	uintptr_t started;
+	BOOLEAN go;
+} RWMutexScalingInfo;
+
+static int J9THREAD_PROC
+readerThread(void *entryArg)
+{
+	RWMutexScalingInfo *info = (RWMutexScalingInfo *)entryArg;
+	uintptr_t torn = 0;
+
+	omrthread_monitor_enter(info->control);
+	info->started += 1;
+	omrthread_monitor_notify_all(info->control);
+	while (!info->go) {
+		omrthread_monitor_wait(info->control);
+	}
+	omrthread_monitor_exit(info->control);
+
+	for (uintptr_t i = 0; i < info->iterations; i++) {
+		omrthread_rwmutex_enter_read(info->mutex);
+		if (info->first != info->second) {
+			torn += 1;
+		}
+		omrthread_rwmutex_exit_read(info->mutex);
+	}
+
+	if (0 != torn) {
+		omrthread_monitor_enter(info->control);
+		info->torn += torn;
+		omrthread_monitor_exit(info->control);
+	}
+	return 0;
+}
+
+/**
+ * Run SCALING_READ_ITERATIONS reads on each of readerCount new threads, all released at once,
+ * while this thread makes SCALING_WRITES writes.
+ * @param[out] nsPerRead nanoseconds per enter/exit read pair, across all readers
+ * @param[out] torn number of reads that saw a write in progress
+ */
+static void
+measureReads(uintptr_t flags, uintptr_t readerCount, double *nsPerRead, uintptr_t *torn)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	omrthread_t threads[SCALING_MAX_READERS];
+	RWMutexScalingInfo info;
+	memset(&info, 0, sizeof(info));
+	info.iterations = SCALING_READ_ITERATIONS;
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_init(&info.mutex, flags, "rwMutexScalingTest mutex"));
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&info.control, 0, "rwMutexScalingTest control"));
+
+	ASSERT_LE(readerCount, (uintptr_t)SCALING_MAX_READERS);
+	for (uintptr_t i = 0; i < readerCount; i++) {
+		omrthread_attr_t attr = NULL;
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&threads[i], &attr, 0, readerThread, &info));
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_destroy(&attr));
+	}
+
+	omrthread_monitor_enter(info.control);
+	while (info.started < readerCount) {
+		omrthread_monitor_wait(info.control);
+	}
+	uint64_t start = omrtime_hires_clock();
+	info.go = TRUE;
+	omrthread_monitor_notify_all(info.control);
+	omrthread_monitor_exit(info.control);
+
+	for (uintptr_t i = 0; i < SCALING_WRITES; i++) {
+		omrthread_rwmutex_enter_write(info.mutex);
+		info.first += 1;
+		omrthread_yield();
+		info.second += 1;
+		omrthread_rwmutex_exit_write(info.mutex);
+		omrthread_yield();
+	}
+	for (uintptr_t i = 0; i < readerCount; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_join(threads[i]));
+	}
+	uint64_t elapsed = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+
+	omrthread_monitor_destroy(info.control);
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_destroy(info.mutex));
+	*nsPerRead = (double)elapsed / (double)(readerCount * SCALING_READ_ITERATIONS);
+	*torn = info.torn;
+}
+
+TEST(RWMutexScalingTest, Readers)
+{
+	omrTestEnv->log(LEVEL_INFO, "%8s %20s %20s\n", "readers", "default ns/read", "reader-biased ns/read");
+	for (uintptr_t readerCount = 1; readerCount <= SCALING_MAX_READERS; readerCount *= 2) {
+		double defaultLatency = 0.0;
+		double biasedLatency = 0.0;
+		uintptr_t torn = 0;
+		ASSERT_NO_FATAL_FAILURE(measureReads(0, readerCount, &defaultLatency, &torn));
+		ASSERT_EQ((uintptr_t)0, torn) << "default rwmutex, " << readerCount << " readers";
+		ASSERT_NO_FATAL_FAILURE(measureReads(J9THREAD_RWMUTEX_READER_BIASED, readerCount, &biasedLatency, &torn));
+		ASSERT_EQ((uintptr_t)0, torn) << "reader-biased rwmutex, " << readerCount << " readers";
+		omrTestEnv->log(LEVEL_INFO, "%8zu %20.1f %20.1f\n", readerCount, defaultLatency, biasedLatency);
+	}
+}
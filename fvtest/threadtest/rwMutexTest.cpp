@@ -91,10 +91,11 @@ runRequest(SupportThreadInfo *info)
  * @param functionsToRun an array of functions pointers. Each function will be run one in sequence synchronized
  *        using the monitor within the SupporThreadInfo
  * @param numberFunctions the number of functions in the functionsToRun array
+ * @param rwmutexFlags flags for the rwmutex
  * @returns a pointer to the newly created SupporThreadInfo
  */
 SupportThreadInfo *
-createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t numberFunctions)
+createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t numberFunctions, uintptr_t rwmutexFlags = 0)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
 	SupportThreadInfo *info = (SupportThreadInfo *)omrmem_allocate_memory(sizeof(SupportThreadInfo), OMRMEM_CATEGORY_THREADS);
@@ -103,7 +104,7 @@ createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t number
 	info->functionsToRun = functionsToRun;
 	info->numberFunctions = numberFunctions;
 	info->done = FALSE;
-	omrthread_rwmutex_init((omrthread_rwmutex_t *)&info->handle, 0, "supportThreadInfo rwmutex");
+	omrthread_rwmutex_init((omrthread_rwmutex_t *)&info->handle, rwmutexFlags, "supportThreadInfo rwmutex");
 	omrthread_monitor_init_with_name(&info->synchronization, 0, "supportThreadAInfo monitor");
 	return info;
 }
@@ -1136,3 +1137,133 @@ TEST(RWMutex, WritersExcludedByWriterNonBlockTest)
 	triggerNextStepDone(info);
 	freeSupportThreadInfo(info);
 }
+
+/**
+ * Validate recursive and nested entries of a reader-biased RWMutex
+ */
+TEST(RWMutex, ReaderBiasedEnterExitTest)
+{
+	intptr_t result;
+	omrthread_rwmutex_t handle;
+	const char *mutexName = "test_mutex";
+
+	result = omrthread_rwmutex_init(&handle, J9THREAD_RWMUTEX_READER_BIASED, mutexName);
+	ASSERT_TRUE(0 == result);
+
+	/* recursive read */
+	ASSERT_TRUE(0 == omrthread_rwmutex_enter_read(handle));
+	ASSERT_TRUE(0 == omrthread_rwmutex_enter_read(handle));
+	ASSERT_TRUE(FALSE == omrthread_rwmutex_is_writelocked(handle));
+	ASSERT_TRUE(J9THREAD_RWMUTEX_WOULDBLOCK == omrthread_rwmutex_try_enter_write(handle));
+	ASSERT_TRUE(0 == omrthread_rwmutex_exit_read(handle));
+	ASSERT_TRUE(0 == omrthread_rwmutex_exit_read(handle));
+
+	/* recursive write, and read while holding write */
+	ASSERT_TRUE(0 == omrthread_rwmutex_enter_write(handle));
+	ASSERT_TRUE(0 == omrthread_rwmutex_try_enter_write(handle));
+	ASSERT_TRUE(0 == omrthread_rwmutex_enter_read(handle));
+	ASSERT_TRUE(TRUE == omrthread_rwmutex_is_writelocked(handle));
+	ASSERT_TRUE(0 == omrthread_rwmutex_exit_read(handle));
+	ASSERT_TRUE(0 == omrthread_rwmutex_exit_write(handle));
+	ASSERT_TRUE(0 == omrthread_rwmutex_exit_write(handle));
+	ASSERT_TRUE(FALSE == omrthread_rwmutex_is_writelocked(handle));
+
+	/* the readers drained, so a writer can enter again */
+	ASSERT_TRUE(0 == omrthread_rwmutex_try_enter_write(handle));
+	ASSERT_TRUE(0 == omrthread_rwmutex_exit_write(handle));
+
+	/* clean up */
+	result = omrthread_rwmutex_destroy(handle);
+	ASSERT_TRUE(0 == result);
+}
+
+TEST(RWMutex, ReaderBiasedMultipleReadersTest)
+{
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+	info = createSupportThreadInfo(functionsToRun, 2, J9THREAD_RWMUTEX_READER_BIASED);
+	startConcurrentThread(info);
+
+	/* the concurrent thread holds the rwmutex for read, which must not block this reader */
+	ASSERT_TRUE(1 == info->readCounter);
+	omrthread_rwmutex_enter_read(info->handle);
+	ASSERT_TRUE(1 == info->readCounter);
+	omrthread_rwmutex_exit_read(info->handle);
+
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->readCounter);
+	freeSupportThreadInfo(info);
+}
+
+/**
+ * validates the following for a reader-biased rwmutex
+ *
+ * readers are excluded while another thread holds the rwmutex for write
+ * once writer exits, reader can enter
+ */
+TEST(RWMutex, ReaderBiasedReadersExcludedTest)
+{
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+	info = createSupportThreadInfo(functionsToRun, 2, J9THREAD_RWMUTEX_READER_BIASED);
+
+	ASSERT_TRUE(0 == info->readCounter);
+	omrthread_rwmutex_enter_write(info->handle);
+
+	startConcurrentThread(info);
+	ASSERT_TRUE(0 == info->readCounter);
+
+	omrthread_monitor_enter(info->synchronization);
+	omrthread_rwmutex_exit_write(info->handle);
+	omrthread_monitor_wait_interruptable(info->synchronization, MILLI_TIMEOUT, NANO_TIMEOUT);
+	omrthread_monitor_exit(info->synchronization);
+	ASSERT_TRUE(1 == info->readCounter);
+
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->readCounter);
+	freeSupportThreadInfo(info);
+}
+
+/**
+ * validates the following for a reader-biased rwmutex
+ *
+ * writer is excluded while another thread holds the rwmutex for read,
+ * and try_enter_write does not block
+ * once reader exits writer can enter
+ */
+TEST(RWMutex, ReaderBiasedWritersExcludedTest)
+{
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_write;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_write;
+	info = createSupportThreadInfo(functionsToRun, 2, J9THREAD_RWMUTEX_READER_BIASED);
+
+	ASSERT_TRUE(0 == info->writeCounter);
+	omrthread_rwmutex_enter_read(info->handle);
+
+	startConcurrentThread(info);
+	ASSERT_TRUE(0 == info->writeCounter);
+
+	/* the writer is draining: this thread can still re-enter for read */
+	omrthread_rwmutex_enter_read(info->handle);
+	omrthread_rwmutex_exit_read(info->handle);
+	ASSERT_TRUE(0 == info->writeCounter);
+
+	omrthread_monitor_enter(info->synchronization);
+	omrthread_rwmutex_exit_read(info->handle);
+	omrthread_monitor_wait_interruptable(info->synchronization, MILLI_TIMEOUT, NANO_TIMEOUT);
+	omrthread_monitor_exit(info->synchronization);
+	ASSERT_TRUE(1 == info->writeCounter);
+
+	/* the concurrent thread holds the rwmutex for write */
+	ASSERT_TRUE(J9THREAD_RWMUTEX_WOULDBLOCK == omrthread_rwmutex_try_enter_write(info->handle));
+
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->writeCounter);
+	freeSupportThreadInfo(info);
+}
@@ -75,6 +75,7 @@ protected:
 	bool  _collectAndClimb;
 	bool  _climb;				/* indicates that current attempt to allocate should try parent, if current subspace failed */
 	bool  _completedFromTlh;
+	uintptr_t _allocationSite; /**< language-defined allocation site reported with allocation samples (0 if unknown) */
 
 public:
 
@@ -89,6 +90,8 @@ public:
 
 	MMINLINE uint32_t getObjectFlags() { return _objectFlags; }
 	MMINLINE bool getTenuredFlag() { return (_allocateFlags & OMR_GC_ALLOCATE_OBJECT_TENURED) == OMR_GC_ALLOCATE_OBJECT_TENURED; }
+	MMINLINE void setTenuredFlag() { _allocateFlags |= OMR_GC_ALLOCATE_OBJECT_TENURED; }
+	MMINLINE void clearTenuredFlag() { _allocateFlags &= ~(uintptr_t)OMR_GC_ALLOCATE_OBJECT_TENURED; }
 	MMINLINE bool getPreHashFlag() { return OMR_GC_ALLOCATE_OBJECT_HASHED == (_allocateFlags & OMR_GC_ALLOCATE_OBJECT_HASHED); }
 
 	/* NON_ZERO_TLH flag set means JIT requested to skip zero in it (not what its name suggests to allocate from non zero TLH).
@@ -99,6 +102,13 @@ public:
 
 	MMINLINE void setObjectFlags(uint32_t objectFlags) { _objectFlags = objectFlags; }
 
+	/**
+	 * The allocation site is opaque to the GC (e.g. a bytecode PC or a call site id). It is only
+	 * used to attribute allocation samples (see J9HOOK_MM_OMR_ALLOCATION_SAMPLE).
+	 */
+	MMINLINE uintptr_t getAllocationSite() { return _allocationSite; }
+	MMINLINE void setAllocationSite(uintptr_t allocationSite) { _allocationSite = allocationSite; }
+
 
 	void setSpineBytes(uintptr_t sb) { _spineBytes = sb; }
 	uintptr_t getNumArraylets() { return _numArraylets; }
@@ -249,6 +259,7 @@ public:
 		, _collectAndClimb(collectAndClimb)
 		, _climb(false)
 		, _completedFromTlh(false)
+		, _allocationSite(0)
 	{}
 };
 
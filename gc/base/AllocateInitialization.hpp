@@ -224,6 +224,9 @@ public:
 					MM_AtomicOperations::writeBarrier();
 					/* reflect the current OMR flags in the object header back into allocate description */
 					_allocateDescription.setObjectFlags((uint32_t)objectModel->getObjectFlags(objectPtr));
+					if (0 != env->getExtensions()->allocationSamplingInterval) {
+						env->_objectAllocationInterface->sampleAllocation(env, &_allocateDescription, objectPtr);
+					}
 #if defined(OMR_GC_ALLOCATION_TAX)
 					/* if concurrent mark is enabled thread might have to pay tax - must save/restore allocated object in case of GC */
 					env->saveObjects(objectPtr);
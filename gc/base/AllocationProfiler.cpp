@@ -0,0 +1,280 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "AllocationProfiler.hpp"
+
+#include "mmomrhook.h"
+#include "omrport.h"
+#include "omrutil.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+MM_AllocationProfiler *
+MM_AllocationProfiler::newInstance(MM_EnvironmentBase *env, const char *fileName)
+{
+	MM_AllocationProfiler *profiler = (MM_AllocationProfiler *)env->getForge()->allocate(sizeof(MM_AllocationProfiler), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != profiler) {
+		new(profiler) MM_AllocationProfiler();
+		if (!profiler->initialize(env, fileName)) {
+			profiler->kill(env);
+			profiler = NULL;
+		}
+	}
+	return profiler;
+}
+
+bool
+MM_AllocationProfiler::initialize(MM_EnvironmentBase *env, const char *fileName)
+{
+	OMR::GC::Forge *forge = env->getForge();
+
+	if (NULL != fileName) {
+		_fileName = (char *)forge->allocate(strlen(fileName) + 1, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _fileName) {
+			return false;
+		}
+		strcpy(_fileName, fileName);
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_mutex, 0, "MM_AllocationProfiler::_mutex")) {
+		return false;
+	}
+
+	J9HookInterface** omrHooks = env->getExtensions()->getOmrHookInterface();
+	if (0 != (*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_ALLOCATION_SAMPLE, hookAllocationSample, OMR_GET_CALLSITE(), (void *)this)) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_AllocationProfiler::tearDown(MM_EnvironmentBase *env)
+{
+	OMR::GC::Forge *forge = env->getForge();
+
+	J9HookInterface** omrHooks = env->getExtensions()->getOmrHookInterface();
+	(*omrHooks)->J9HookUnregister(omrHooks, J9HOOK_MM_OMR_ALLOCATION_SAMPLE, hookAllocationSample, (void *)this);
+
+	MM_ThreadAllocationProfile *profile = _profiles;
+	while (NULL != profile) {
+		MM_ThreadAllocationProfile *next = profile->_next;
+		profile->_lock.tearDown();
+		forge->free(profile);
+		profile = next;
+	}
+	_profiles = NULL;
+
+	if (NULL != _mutex) {
+		omrthread_monitor_destroy(_mutex);
+		_mutex = NULL;
+	}
+	if (NULL != _fileName) {
+		forge->free(_fileName);
+		_fileName = NULL;
+	}
+}
+
+void
+MM_AllocationProfiler::kill(MM_EnvironmentBase *env)
+{
+	if ((NULL != _fileName) && (NULL != _mutex)) {
+		drain(env, _fileName);
+	}
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+void
+MM_AllocationProfiler::hookAllocationSample(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	MM_AllocationSampleEvent *event = (MM_AllocationSampleEvent *)eventData;
+	MM_AllocationProfiler *profiler = (MM_AllocationProfiler *)userData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+
+	profiler->recordSample(env, event->allocationSite, event->sizeClass, event->sampledBytes);
+}
+
+MM_ThreadAllocationProfile *
+MM_AllocationProfiler::getThreadProfile(MM_EnvironmentBase *env)
+{
+	MM_ThreadAllocationProfile *profile = env->_allocationProfile;
+	if (NULL == profile) {
+		OMR_VMThread *thread = env->getOmrVMThread();
+		uintptr_t threadId = omrthread_get_osId(thread->_os_thread);
+		char threadName[ALLOCATION_PROFILER_THREAD_NAME_LENGTH];
+		/* the thread name is locked by its own mutex, so it is read before entering the profiler monitor */
+		copyThreadName(thread, threadName);
+
+		omrthread_monitor_enter(_mutex);
+		for (profile = _profiles; NULL != profile; profile = profile->_next) {
+			if (threadId == profile->_threadId) {
+				break;
+			}
+		}
+		if (NULL == profile) {
+			profile = (MM_ThreadAllocationProfile *)env->getForge()->allocate(sizeof(MM_ThreadAllocationProfile), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+			if (NULL != profile) {
+				new(profile) MM_ThreadAllocationProfile(threadId);
+				if (profile->_lock.initialize(env, &env->getExtensions()->lnrlOptions, "MM_ThreadAllocationProfile:_lock")) {
+					memset(profile->_table, 0, sizeof(profile->_table));
+					profile->_next = _profiles;
+					_profiles = profile;
+				} else {
+					env->getForge()->free(profile);
+					profile = NULL;
+				}
+			}
+		}
+		if (NULL != profile) {
+			/* the OS may have reused the id of a thread that has exited, report the profile under the latest name */
+			profile->_lock.acquire();
+			strcpy(profile->_threadName, threadName);
+			profile->_lock.release();
+		}
+		omrthread_monitor_exit(_mutex);
+
+		env->_allocationProfile = profile;
+	}
+	return profile;
+}
+
+void
+MM_AllocationProfiler::recordSample(MM_EnvironmentBase *env, uintptr_t allocationSite, uintptr_t sizeClass, uintptr_t sampledBytes)
+{
+	MM_ThreadAllocationProfile *profile = getThreadProfile(env);
+	if (NULL == profile) {
+		MM_AtomicOperations::add(&_droppedSampleCount, 1);
+		MM_AtomicOperations::add(&_droppedSampledBytes, sampledBytes);
+		return;
+	}
+
+	uintptr_t hash = ((allocationSite >> 2) * 31) + sizeClass;
+	uintptr_t index = (hash ^ (hash >> 16)) & (ALLOCATION_PROFILER_TABLE_SIZE - 1);
+
+	profile->_lock.acquire();
+	for (uintptr_t probe = 0; probe < ALLOCATION_PROFILER_TABLE_SIZE; probe++) {
+		MM_ThreadAllocationProfile::Entry *entry = &profile->_table[(index + probe) & (ALLOCATION_PROFILER_TABLE_SIZE - 1)];
+		if (0 == entry->sampleCount) {
+			/* keep a quarter of the table free so that probe sequences stay short */
+			if (profile->_entryCount >= ((ALLOCATION_PROFILER_TABLE_SIZE / 4) * 3)) {
+				break;
+			}
+			entry->allocationSite = allocationSite;
+			entry->sizeClass = sizeClass;
+			describeAllocationSite(env, allocationSite, entry->siteName);
+			profile->_entryCount += 1;
+		} else if ((allocationSite != entry->allocationSite) || (sizeClass != entry->sizeClass)) {
+			continue;
+		}
+		entry->sampleCount += 1;
+		entry->sampledBytes += sampledBytes;
+		profile->_lock.release();
+		return;
+	}
+	profile->_droppedSampleCount += 1;
+	profile->_droppedSampledBytes += sampledBytes;
+	profile->_lock.release();
+}
+
+void
+MM_AllocationProfiler::describeAllocationSite(MM_EnvironmentBase *env, uintptr_t allocationSite, char *siteName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	if ((0 == allocationSite) || !env->describeAllocationSite(allocationSite, siteName, ALLOCATION_PROFILER_SITE_NAME_LENGTH)) {
+		omrstr_printf(siteName, ALLOCATION_PROFILER_SITE_NAME_LENGTH, "[unknown site]");
+	}
+
+	/* frames are separated by ';', so only spaces (the weight separator) are significant here */
+	for (char *cursor = siteName; '\0' != *cursor; cursor++) {
+		if (' ' == *cursor) {
+			*cursor = '_';
+		}
+	}
+}
+
+void
+MM_AllocationProfiler::copyThreadName(OMR_VMThread *thread, char *name)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(thread->_vm);
+	char *threadName = getOMRVMThreadName(thread);
+	if (NULL != threadName) {
+		omrstr_printf(name, ALLOCATION_PROFILER_THREAD_NAME_LENGTH, "%s", threadName);
+	} else {
+		omrstr_printf(name, ALLOCATION_PROFILER_THREAD_NAME_LENGTH, "OMR_VMThread [%p]", thread);
+	}
+	releaseOMRVMThreadName(thread);
+
+	for (char *cursor = name; '\0' != *cursor; cursor++) {
+		if ((';' == *cursor) || (' ' == *cursor)) {
+			*cursor = '_';
+		}
+	}
+}
+
+bool
+MM_AllocationProfiler::drain(MM_EnvironmentBase *env, const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	intptr_t fd = omrfile_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		return false;
+	}
+
+	omrthread_monitor_enter(_mutex);
+	uintptr_t droppedSampleCount = _droppedSampleCount;
+	uintptr_t droppedSampledBytes = _droppedSampledBytes;
+	MM_AtomicOperations::subtract(&_droppedSampleCount, droppedSampleCount);
+	MM_AtomicOperations::subtract(&_droppedSampledBytes, droppedSampledBytes);
+	for (MM_ThreadAllocationProfile *profile = _profiles; NULL != profile; profile = profile->_next) {
+		profile->_lock.acquire();
+		for (uintptr_t i = 0; i < ALLOCATION_PROFILER_TABLE_SIZE; i++) {
+			MM_ThreadAllocationProfile::Entry *entry = &profile->_table[i];
+			if (0 != entry->sampleCount) {
+				uintptr_t sizeLow = (uintptr_t)1 << entry->sizeClass;
+				omrfile_printf(fd, "%s_[tid_%zu];%s;%zu-%zuB %zu\n",
+						profile->_threadName, profile->_threadId, entry->siteName, sizeLow, (sizeLow << 1) - 1, entry->sampledBytes);
+			}
+		}
+		droppedSampleCount += profile->_droppedSampleCount;
+		droppedSampledBytes += profile->_droppedSampledBytes;
+
+		memset(profile->_table, 0, sizeof(profile->_table));
+		profile->_entryCount = 0;
+		profile->_droppedSampleCount = 0;
+		profile->_droppedSampledBytes = 0;
+		profile->_lock.release();
+	}
+	omrthread_monitor_exit(_mutex);
+
+	if (0 != droppedSampleCount) {
+		omrfile_printf(fd, "[dropped samples] %zu\n", droppedSampledBytes);
+	}
+
+	omrfile_close(fd);
+	return true;
+}
@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(ALLOCATIONPROFILER_HPP_)
+#define ALLOCATIONPROFILER_HPP_
+
+#include "omrcfg.h"
+#include "modronbase.h"
+#include "omrhookable.h"
+#include "omrthread.h"
+
+#include "BaseNonVirtual.hpp"
+#include "BaseVirtual.hpp"
+#include "LightweightNonReentrantLock.hpp"
+
+class MM_EnvironmentBase;
+struct OMR_VMThread;
+
+#define ALLOCATION_PROFILER_TABLE_SIZE 256
+#define ALLOCATION_PROFILER_THREAD_NAME_LENGTH 64
+#define ALLOCATION_PROFILER_SITE_NAME_LENGTH 128
+
+/**
+ * The allocation samples of one thread, identified by its OS thread id, aggregated by allocation site
+ * and size class in a fixed size open addressed table. Only the sampled thread adds to the table, so
+ * its lock is only contended while the profile is being drained.
+ * @ingroup GC_Base
+ */
+class MM_ThreadAllocationProfile : public MM_BaseNonVirtual
+{
+/*
+ * Data members
+ */
+public:
+	struct Entry {
+		uintptr_t allocationSite; /**< language-defined allocation site */
+		uintptr_t sizeClass; /**< floor(log2(size)) of the sampled objects */
+		uintptr_t sampleCount; /**< number of samples aggregated in this entry (0 if the entry is unused) */
+		uintptr_t sampledBytes; /**< bytes represented by the samples in this entry */
+		char siteName[ALLOCATION_PROFILER_SITE_NAME_LENGTH]; /**< collapsed stack frames of the site, described when first sampled */
+	};
+
+	MM_ThreadAllocationProfile *_next; /**< next profile in the list owned by the profiler */
+	uintptr_t _threadId; /**< OS id of the sampled thread */
+	char _threadName[ALLOCATION_PROFILER_THREAD_NAME_LENGTH]; /**< name of the thread when last attached (threads may be gone when the profile is written) */
+	MM_LightweightNonReentrantLock _lock; /**< protects the table and counters against a concurrent drain */
+	uintptr_t _entryCount; /**< number of used entries in _table */
+	uintptr_t _droppedSampleCount; /**< samples that did not fit in _table */
+	uintptr_t _droppedSampledBytes; /**< bytes represented by the dropped samples */
+	Entry _table[ALLOCATION_PROFILER_TABLE_SIZE];
+
+/*
+ * Function members
+ */
+public:
+	MM_ThreadAllocationProfile(uintptr_t threadId)
+		: MM_BaseNonVirtual()
+		, _next(NULL)
+		, _threadId(threadId)
+		, _lock()
+		, _entryCount(0)
+		, _droppedSampleCount(0)
+		, _droppedSampledBytes(0)
+	{
+		_typeId = __FUNCTION__;
+		_threadName[0] = '\0';
+	}
+};
+
+/**
+ * Aggregates the allocation samples reported through J9HOOK_MM_OMR_ALLOCATION_SAMPLE
+ * (see GCExtensionsBase::allocationSamplingInterval) by thread, allocation site and
+ * size class, and writes them out as collapsed stacks ("thread;site frames;size bytes")
+ * that flame graph tools consume directly.
+ *
+ * Each sampled thread records into its own MM_ThreadAllocationProfile, found through its
+ * environment, so taking a sample takes no global lock. The profiler monitor is only entered
+ * the first time a thread is sampled, to find or create its profile, and while draining.
+ * Allocation sites are described by the language (MM_EnvironmentBase::describeAllocationSite())
+ * the first time a thread samples them.
+ * @ingroup GC_Base
+ */
+class MM_AllocationProfiler : public MM_BaseVirtual
+{
+/*
+ * Data members
+ */
+private:
+	MM_ThreadAllocationProfile *_profiles; /**< profiles of every thread sampled so far */
+	volatile uintptr_t _droppedSampleCount; /**< samples lost because no thread profile could be allocated */
+	volatile uintptr_t _droppedSampledBytes; /**< bytes represented by those samples */
+	omrthread_monitor_t _mutex; /**< protects the list of thread profiles */
+	char *_fileName; /**< file the profile is written to when the profiler is killed (may be NULL) */
+
+protected:
+public:
+
+/*
+ * Function members
+ */
+private:
+	bool initialize(MM_EnvironmentBase *env, const char *fileName);
+	void tearDown(MM_EnvironmentBase *env);
+
+	static void hookAllocationSample(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+
+	/**
+	 * Add a sample to the entry for (allocationSite, sizeClass) in the profile of the thread of env,
+	 * creating the entry if required.
+	 */
+	void recordSample(MM_EnvironmentBase *env, uintptr_t allocationSite, uintptr_t sizeClass, uintptr_t sampledBytes);
+
+	/**
+	 * Find the profile of the thread of env, creating it the first time the thread is sampled.
+	 * A thread that detaches and attaches again keeps its profile.
+	 * @return the profile, or NULL if it could not be allocated
+	 */
+	MM_ThreadAllocationProfile *getThreadProfile(MM_EnvironmentBase *env);
+
+	/**
+	 * Describe an allocation site as collapsed stack frames into siteName.
+	 */
+	void describeAllocationSite(MM_EnvironmentBase *env, uintptr_t allocationSite, char *siteName);
+
+	/**
+	 * Copy the name of thread into name, replacing characters that are significant in the collapsed stack format.
+	 */
+	void copyThreadName(OMR_VMThread *thread, char *name);
+
+protected:
+public:
+	static MM_AllocationProfiler *newInstance(MM_EnvironmentBase *env, const char *fileName);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Write the samples aggregated so far to fileName in collapsed stack format, one line per
+	 * (thread, allocation site, size class) weighted by the sampled bytes, and reset the profile.
+	 * @param fileName the file to write (overwritten if it exists)
+	 * @return true if the profile was written, false if the file could not be written
+	 */
+	bool drain(MM_EnvironmentBase *env, const char *fileName);
+
+	MM_AllocationProfiler()
+		: MM_BaseVirtual()
+		, _profiles(NULL)
+		, _droppedSampleCount(0)
+		, _droppedSampledBytes(0)
+		, _mutex(NULL)
+		, _fileName(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* ALLOCATIONPROFILER_HPP_ */
@@ -407,7 +407,6 @@ MM_Configuration::initializeRegionSize(MM_EnvironmentBase* env)
 	if (0 == regionSize) {
 		regionSize = _defaultRegionSize;
 	}
-
 	uintptr_t shift = calculatePowerOfTwoShift(env, regionSize);
 	if (0 == shift) {
 		result = false;
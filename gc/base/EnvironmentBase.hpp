@@ -51,6 +51,7 @@ class MM_MemorySpace;
 class MM_ObjectAllocationInterface;
 class MM_SegregatedAllocationTracker;
 class MM_Task;
+class MM_ThreadAllocationProfile;
 class MM_Validator;
 
 /* Allocation color values -- also used in bit in Metronome -- see Metronome.hpp */
@@ -66,7 +67,8 @@ typedef enum {
 	WRITE_BARRIER_THREAD,
 	CON_MARK_HELPER_THREAD,
 	GC_WORKER_THREAD,
-	GC_MAIN_THREAD
+	GC_MAIN_THREAD,
+	CON_SWEEP_HELPER_THREAD
 } ThreadType;
 
 /**
@@ -163,6 +165,7 @@ public:
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SegregatedAllocationTracker* _allocationTracker; /**< tracks bytes allocated per thread and periodically flushes allocation data to MM_MemoryPoolSegregated */
 #endif /* OMR_GC_SEGREGATED_HEAP */
+	MM_ThreadAllocationProfile *_allocationProfile; /**< allocation samples of this thread, created at its first sample (see MM_AllocationProfiler) */
 
 	volatile uint32_t _allocationColor; /**< Flag field to indicate whether premarking is enabled on the thread */
 
@@ -426,6 +429,11 @@ public:
 	 */
 	bool objectAllocationNotify(omrobjectptr_t omrObject) { return _delegate.objectAllocationNotify(omrObject); }
 
+	/**
+	 * Describe a language allocation site for allocation profiles (see MM_EnvironmentDelegate::describeAllocationSite()).
+	 */
+	bool describeAllocationSite(uintptr_t allocationSite, char *buffer, uintptr_t bufferSize) { return _delegate.describeAllocationSite(allocationSite, buffer, bufferSize); }
+
 	/**
 	 *	Verbose: allocation Failure Start Report if required
 	 *	set flag allocation Failure Start Report required
@@ -739,6 +747,7 @@ public:
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_allocationTracker(NULL)
 #endif /* OMR_GC_SEGREGATED_HEAP */
+		,_allocationProfile(NULL)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		,_hotFieldCopyDepthCount(0)
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
@@ -796,6 +805,7 @@ public:
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_allocationTracker(NULL)
 #endif /* OMR_GC_SEGREGATED_HEAP */
+		,_allocationProfile(NULL)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		,_hotFieldCopyDepthCount(0)
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
@@ -0,0 +1,235 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(FREELISTSIZEINDEX_HPP_)
+#define FREELISTSIZEINDEX_HPP_
+
+#include "omrcomp.h"
+
+#include "BaseNonVirtual.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "Math.hpp"
+
+/* One size index bin per power of two free entry size */
+#define FREE_LIST_SIZE_INDEX_BINS (sizeof(uintptr_t) * 8)
+
+/**
+ * Size-segregated starting points for a walk of an address-ordered free list.
+ *
+ * Bin k holds a free entry such that every entry before it is smaller than 2^k, so a search for 2^k bytes or
+ * more may start there (the entry itself must still be checked, since it may have grown by coalescing). Bin
+ * entries never decrease in address as k increases, so the bins holding a given entry are contiguous and are
+ * found by a binary search rather than a scan of every bin.
+ *
+ * The index only chooses where a walk starts; it does not make the search logarithmic. The walk still visits,
+ * one at a time, every entry between the bin entry and the first fit, which on a list of many entries just
+ * below the request size is linear in the length of the list.
+ *
+ * Entries before the head of the free list are stale and must be ignored by the caller.
+ * @ingroup GC_Base_Core
+ */
+class MM_FreeListSizeIndex : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+private:
+	MM_HeapLinkedFreeHeader *_entry[FREE_LIST_SIZE_INDEX_BINS]; /**< starting entry for each size class, NULL to start from the head */
+	uintptr_t _prefixSize[FREE_LIST_SIZE_INDEX_BINS]; /**< upper bound of the size of the entries before the corresponding _entry */
+
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * @return the first bin whose entry is at or beyond freeEntry (or strictly beyond it if inclusive is false),
+	 * FREE_LIST_SIZE_INDEX_BINS if there is none
+	 */
+	MMINLINE uintptr_t
+	findFirstBin(MM_HeapLinkedFreeHeader *freeEntry, bool inclusive)
+	{
+		uintptr_t low = 0;
+		uintptr_t high = FREE_LIST_SIZE_INDEX_BINS;
+		while (low < high) {
+			uintptr_t middle = (low + high) / 2;
+			if ((_entry[middle] < freeEntry) || (!inclusive && (_entry[middle] == freeEntry))) {
+				low = middle + 1;
+			} else {
+				high = middle;
+			}
+		}
+		return low;
+	}
+
+	/**
+	 * @return the lowest size class all of whose requests are larger than size
+	 */
+	MMINLINE static uintptr_t
+	getSizeClassAbove(uintptr_t size)
+	{
+		return (0 == size) ? 0 : (MM_Math::floorLog2(size) + 1);
+	}
+
+public:
+	/**
+	 * @return the size class of a request for the given number of bytes
+	 */
+	MMINLINE static uintptr_t getSizeClass(uintptr_t size) { return MM_Math::floorLog2(size); }
+
+	/**
+	 * @return the entry a search in the given size class may start from, or NULL to start from the head
+	 */
+	MMINLINE MM_HeapLinkedFreeHeader *getEntry(uintptr_t sizeClass) { return _entry[sizeClass]; }
+
+	/**
+	 * @return an upper bound of the size of the entries before getEntry(sizeClass)
+	 */
+	MMINLINE uintptr_t getPrefixSize(uintptr_t sizeClass) { return _prefixSize[sizeClass]; }
+
+	/**
+	 * Empty the index so every search starts from the head.
+	 */
+	MMINLINE void
+	clear()
+	{
+		for (uintptr_t sizeClass = 0; sizeClass < FREE_LIST_SIZE_INDEX_BINS; sizeClass++) {
+			_entry[sizeClass] = NULL;
+			_prefixSize[sizeClass] = 0;
+		}
+	}
+
+	/**
+	 * Record the result of a free list walk: every entry up to and including previousFreeEntry is at most
+	 * prefixSize bytes, so previousFreeEntry is a starting point for every size class above prefixSize.
+	 */
+	MMINLINE void
+	update(MM_HeapLinkedFreeHeader *previousFreeEntry, uintptr_t prefixSize)
+	{
+		for (uintptr_t sizeClass = getSizeClassAbove(prefixSize); (sizeClass < FREE_LIST_SIZE_INDEX_BINS) && (_entry[sizeClass] < previousFreeEntry); sizeClass++) {
+			_entry[sizeClass] = previousFreeEntry;
+			_prefixSize[sizeClass] = prefixSize;
+		}
+	}
+
+	/**
+	 * A free entry was split and the remainder starts at newFreeEntry, which lies before the next entry.
+	 */
+	MMINLINE void
+	replace(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry)
+	{
+		for (uintptr_t sizeClass = findFirstBin(oldFreeEntry, true); (sizeClass < FREE_LIST_SIZE_INDEX_BINS) && (_entry[sizeClass] == oldFreeEntry); sizeClass++) {
+			_entry[sizeClass] = newFreeEntry;
+		}
+	}
+
+	/**
+	 * A free entry was removed from the list. Bins holding it fall back to the entry of the bin below.
+	 */
+	MMINLINE void
+	remove(MM_HeapLinkedFreeHeader *freeEntry)
+	{
+		uintptr_t sizeClass = findFirstBin(freeEntry, true);
+		MM_HeapLinkedFreeHeader *replacement = NULL;
+		uintptr_t replacementPrefixSize = 0;
+		if (0 != sizeClass) {
+			replacement = _entry[sizeClass - 1];
+			replacementPrefixSize = _prefixSize[sizeClass - 1];
+		}
+		for (; (sizeClass < FREE_LIST_SIZE_INDEX_BINS) && (_entry[sizeClass] == freeEntry); sizeClass++) {
+			_entry[sizeClass] = replacement;
+			_prefixSize[sizeClass] = replacementPrefixSize;
+		}
+	}
+
+	/**
+	 * A free entry of the given size was inserted, or grew by coalescing, at freeEntry following previousFreeEntry
+	 * (NULL if it is the head). Size classes it can satisfy, and bins that now point inside it, fall back to
+	 * previousFreeEntry.
+	 */
+	MMINLINE void
+	insert(MM_HeapLinkedFreeHeader *previousFreeEntry, MM_HeapLinkedFreeHeader *freeEntry, uintptr_t size)
+	{
+		uintptr_t lastSizeClass = getSizeClass(size);
+		MM_HeapLinkedFreeHeader *freeEntryEnd = (MM_HeapLinkedFreeHeader *)((uintptr_t)freeEntry + size);
+		for (uintptr_t sizeClass = findFirstBin(previousFreeEntry, false); (sizeClass < FREE_LIST_SIZE_INDEX_BINS) && ((sizeClass <= lastSizeClass) || (_entry[sizeClass] < freeEntryEnd)); sizeClass++) {
+			_entry[sizeClass] = previousFreeEntry;
+			if (NULL == previousFreeEntry) {
+				_prefixSize[sizeClass] = 0;
+			}
+		}
+	}
+
+	/**
+	 * Entries of unknown size were added after freeEntry, so no size class may start beyond it.
+	 */
+	MMINLINE void
+	truncate(MM_HeapLinkedFreeHeader *freeEntry)
+	{
+		for (uintptr_t sizeClass = findFirstBin(freeEntry, false); sizeClass < FREE_LIST_SIZE_INDEX_BINS; sizeClass++) {
+			_entry[sizeClass] = freeEntry;
+		}
+	}
+
+	/**
+	 * Rebuild the index from a single walk of the free list.
+	 * Size classes which no free entry reaches start at the last entry, so searches that cannot be satisfied
+	 * fail without a walk.
+	 */
+	void
+	rebuild(MM_HeapLinkedFreeHeader *freeListHead, bool compressed)
+	{
+		MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
+		uintptr_t prefixSize = 0;
+		uintptr_t nextSizeClass = 0;
+		MM_HeapLinkedFreeHeader *currentFreeEntry = freeListHead;
+		while ((NULL != currentFreeEntry) && (nextSizeClass < FREE_LIST_SIZE_INDEX_BINS)) {
+			uintptr_t currentFreeEntrySize = currentFreeEntry->getSize();
+			uintptr_t sizeClass = getSizeClass(currentFreeEntrySize);
+			for (; nextSizeClass <= sizeClass; nextSizeClass++) {
+				_entry[nextSizeClass] = previousFreeEntry;
+				_prefixSize[nextSizeClass] = prefixSize;
+			}
+			if (currentFreeEntrySize > prefixSize) {
+				prefixSize = currentFreeEntrySize;
+			}
+			previousFreeEntry = currentFreeEntry;
+			currentFreeEntry = currentFreeEntry->getNext(compressed);
+		}
+		for (; nextSizeClass < FREE_LIST_SIZE_INDEX_BINS; nextSizeClass++) {
+			_entry[nextSizeClass] = previousFreeEntry;
+			_prefixSize[nextSizeClass] = prefixSize;
+		}
+	}
+
+	/**
+	 * Create an empty index.
+	 */
+	MM_FreeListSizeIndex()
+		: MM_BaseNonVirtual()
+	{
+		_typeId = __FUNCTION__;
+		clear();
+	}
+};
+
+#endif /* FREELISTSIZEINDEX_HPP_ */
@@ -30,6 +30,7 @@
 
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
+#include "HeapMapBulkScanner.hpp"
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #include "Scavenger.hpp"
 #endif /* OMR_GC_MODRON_SCAVENGER */
@@ -120,6 +121,8 @@ MM_GCExtensionsBase::initialize(MM_EnvironmentBase* env)
 	 */
 	usablePhysicalMemory = omrsysinfo_get_addressable_physical_memory();
 
+	MM_HeapMapBulkScanner::initialize(env->getPortLibrary());
+
 	computeDefaultMaxHeap(env);
 
 	maxSizeDefaultMemorySpace = memoryMax;
@@ -47,6 +47,7 @@
 #include "ScavengerStats.hpp"
 #include "SublistPool.hpp"
 
+class MM_AllocationProfiler;
 class MM_CardTable;
 class MM_ClassLoaderRememberedSet;
 class MM_CollectorLanguageInterface;
@@ -102,6 +103,9 @@ class HeapRegionStateTable;
 #define DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE 512
 #define DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE 16384
 
+/* The number of entries in each per-thread marking deque when work stealing is enabled. */
+#define DEFAULT_MARKING_WORK_STEALING_DEQUE_SIZE 4096
+
 #define DEFAULT_SCAN_CACHE_MAXIMUM_SIZE (128 * 1024)
 #define DEFAULT_SCAN_CACHE_MINIMUM_SIZE (8 * 1024)
 
@@ -271,10 +275,17 @@ public:
 	/* Temporary move from the leaf implementation */
 	bool concurrentSweep;
 #endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	uintptr_t concurrentSweepBackground; /**< number of background helper threads sweeping while mutators run */
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 
 	bool largePageWarnOnError;
 	bool largePageFailOnError;
 	bool largePageFailedToSatisfy;
+	bool hugePageAdvise; /**< if true, each heap subspace is advised for or against transparent huge page backing on commit (-Xgc:hugePageAdvise=) */
+	uintptr_t hugePageMemoryTypes; /**< MEMORY_TYPE_NEW and/or MEMORY_TYPE_OLD subspaces to back with transparent huge pages when hugePageAdvise is set, other subspaces are advised against it */
+	bool hugePageCollapse; /**< if true, huge page advised ranges are collapsed into huge pages synchronously after commit rather than waiting for khugepaged (-Xgc:hugePageCollapse) */
+	uintptr_t hugePageAlignment; /**< if non-zero, alignment of the heap reservation so that the heap starts on a huge page boundary (-Xgc:hugePageAlignment=) */
 #if defined(OMR_GC_DOUBLE_MAP_ARRAYLETS)
 	bool isArrayletDoubleMapRequested;
 	bool isArrayletDoubleMapAvailable;
@@ -318,6 +329,8 @@ public:
 	uintptr_t frequentObjectAllocationSamplingRate; /**< # bytes to sample / # bytes allocated */
 	MM_FrequentObjectsStats* frequentObjectsStats;
 	uint32_t frequentObjectAllocationSamplingDepth; /**< # of frequent objects we'd like to report */
+	uintptr_t allocationSamplingInterval; /**< Mean number of bytes allocated per thread between allocation samples (0 disables allocation sampling) */
+	MM_AllocationProfiler* allocationProfiler; /**< Aggregates allocation samples by thread, allocation site and size class (NULL unless allocation sampling is enabled) */
 
 	uint32_t estimateFragmentation; /**< Enable estimate fragmentation, NO_ESTIMATE_FRAGMENTATION, LOCALGC_ESTIMATE_FRAGMENTATION, GLOBALGC_ESTIMATE_FRAGMENTATION(default) */
 	bool processLargeAllocateStats; /**< Enable process LargeObjectAllocateStats */
@@ -409,6 +422,9 @@ public:
 
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
+	bool markingWorkStealing; /**< if true, completeScan distributes work through per-thread work-stealing deques rather than the shared packet lists (-Xgc:markingWorkStealing) */
+	uintptr_t markingWorkStealingDequeSize; /**< number of entries in each per-thread marking deque, overflowing into work packets when full (-Xgc:markingWorkStealingDequeSize=) */
+	uintptr_t slotPrefetchDepth; /**< number of slots the mark and scavenge scan loops prefetch ahead of processing, 0 disables prefetching (-Xgc:slotPrefetchDepth=) */
 
 	bool rootScannerStatsEnabled; /**< Enable/disable recording of performance statistics for the root scanner.  Defaults to false. */
 	bool rootScannerStatsUsed; /**< Flag that indicates if rootScannerStats are used for in the last increment (by any thread, for any of its roots) */
@@ -464,6 +480,16 @@ public:
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
 	uintptr_t dispatcherHybridNotifyThreadBound; /** Bound for determining hybrid notification type (Individual notifies for count < MIN(bound, maxThreads/2), otherwise notify_all) */
+	bool adaptiveSyncSpin; /**< if true, GC threads waiting at a task synchronization point spin for up to the observed arrival skew before parking (-Xgc:adaptiveSyncSpin) */
+	uintptr_t adaptiveSyncSpinMaximum; /**< upper bound, in microseconds, of the spin phase of a synchronization point (-Xgc:adaptiveSyncSpinMaximum=) */
+
+	/* Start of variables relating to Adaptive Threading */
+	bool adaptiveGCThreading; /**< Flag to indicate whether the Scavenger Adaptive Threading Optimization is enabled*/
+	float adaptiveThreadingSensitivityFactor; /**<  Used by Adaptive Model to determine sensitivity/tolerance to stalling, higher number translates to less stall being tolerated (set through adaptiveThreadingSensitivityFactor=) */
+	float adaptiveThreadingWeightActiveThreads; /**< Weight given to current active threads when averaging projected threads with current active threads (set through adaptiveThreadingWeightActiveThreads=) */
+	float adaptiveThreadBooster; /**< Used to boost calculated thread count, gives opportunity for low thread count to grow. */
+	bool adaptiveGlobalGCThreading; /**< Flag to indicate whether the global collector adapts the thread count of its mark and sweep phases with the same model (set through -Xgc:adaptiveGlobalGCThreading) */
+	/* End of variables relating to Adaptive Threading */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
@@ -501,6 +527,8 @@ public:
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool scavengerNUMAAware; /**< if true, scan cache lists are partitioned by NUMA node and threads prefer caches of their own node (-Xgc:scavengerNUMAAware) */
+	uintptr_t scavengerNUMACopyChunkSize; /**< size of the per-node chunks NUMA-aware scavenger threads carve their copy caches from (-Xgc:scavengerNUMACopyChunkSize=) */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool softwareRangeCheckReadBarrier; /**< enable software read barrier instead of hardware guarded loads when running with CS, complimentary to concurrentScavengerHWSupport with CS active */
 	bool softwareRangeCheckReadBarrierForced; /**< true if usage of softwareRangeCheckReadBarrier is requested explicitly */
@@ -519,6 +547,10 @@ public:
 	uintptr_t scvArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in the scavenger */
 	uintptr_t scavengerScanCacheMaximumSize; /**< maximum size of scan and copy caches before rounding, zero (default) means calculate them */
 	uintptr_t scavengerScanCacheMinimumSize; /**< minimum size of scan and copy caches before rounding, zero (default) means calculate them */
+	bool adaptiveScanCacheSizing; /**< if true, each scavenger thread's upper bound for copy cache size is tuned between scavenges from its measured stall and copy rate (-Xgc:adaptiveScanCacheSizing) */
+	bool scavengerPretenuring; /**< if true, new space allocations of size classes predicted to survive to tenure age are allocated directly in tenure space (-Xgc:scavengerPretenuring). The language must apply the generational write barrier to stores into newly allocated objects. */
+	uintptr_t scavengerPretenureThreshold; /**< predicted percentage of allocated bytes surviving to tenure age at which a size class is pretenured (-Xgc:scavengerPretenureThreshold=) */
+	uintptr_t scavengerPretenureSizeClassMask; /**< bit n set if allocations in size class n are currently pretenured, maintained by the scavenger */
 	bool tiltedScavenge;
 	bool debugTiltedScavenge;
 	double survivorSpaceMinimumSizeRatio;
@@ -544,13 +576,6 @@ public:
 	bool enableSplitHeap; /**< true if we are using gencon with -Xgc:splitheap (we will fail to boostrap if we can't allocate both ranges) */
 	double aliasInhibitingThresholdPercentage; /**< percentage of threads that can be blocked before copy cache aliasing is inhibited (set through aliasInhibitingThresholdPercentage=) */
 
-	/* Start of variables relating to Adaptive Threading */
-	bool adaptiveGCThreading; /**< Flag to indicate whether the Scavenger Adaptive Threading Optimization is enabled*/
-	float adaptiveThreadingSensitivityFactor; /**<  Used by Adaptive Model to determine sensitivity/tolerance to stalling, higher number translates to less stall being tolerated (set through adaptiveThreadingSensitivityFactor=) */
-	float adaptiveThreadingWeightActiveThreads; /**< Weight given to current active threads when averaging projected threads with current active threads (set through adaptiveThreadingWeightActiveThreads=) */
-	float adaptiveThreadBooster; /**< Used to boost calculated thread count, gives opportunity for low thread count to grow. */
-	/* End of variables relating to Adaptive Threading */
-
 	enum HeapInitializationSplitHeapSection {
 		HEAP_INITIALIZATION_SPLIT_HEAP_UNKNOWN = 0,
 		HEAP_INITIALIZATION_SPLIT_HEAP_TENURE,
@@ -585,6 +610,7 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool compactUseSummaryTable; /**< If true, compaction records per-page live bytes while it finds the sub area limits, before moving objects */
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 
 	bool payAllocationTax;
@@ -682,6 +708,9 @@ public:
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SizeClasses* defaultSizeClasses;
+	bool segregatedGenerational; /**< if set, cells allocated since the last collection form a nursery which is collected without tracing the rest of the heap */
+	uintptr_t segregatedNurseryCollections; /**< number of nursery collections run between full collections when segregatedGenerational is set */
+	uintptr_t segregatedNurserySize; /**< bytes allocated since the last collection which trigger a nursery collection when segregatedGenerational is set (0 for a quarter of the maximum heap) */
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
@@ -718,6 +747,9 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool asyncLogging; /**< Enabled by -Xgc:asyncLogging.  Queue verbose:gc output for a background thread to write to file */
+	uintptr_t asyncLoggingBufferSize; /**< Size of the -Xgc:asyncLogging record ring, set by -Xgc:asyncLoggingBufferSize= */
+	bool asyncLoggingBinary; /**< Enabled by -Xgc:asyncLoggingBinary.  The -Xgc:asyncLogging writer writes unrendered events, for vgcrender to turn into XML */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -1189,6 +1221,8 @@ public:
 		return _concurrentGlobalGCInProgress;
 	}
 
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
 	/**
 	 * Determine whether Adaptive Threading is enabled. AdaptiveGCThreading flag
 	 * is not sufficient; Adaptive threading must be ignored if GC thread count is forced.
@@ -1199,7 +1233,16 @@ public:
 	{
 		return (adaptiveGCThreading && !gcThreadCountForced);
 	}
-#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+	/**
+	 * Determine whether the global collector phases use Adaptive Threading.
+	 * @return TRUE if global mark and sweep thread counts can be adapted, FALSE otherwise
+	 */
+	MMINLINE bool
+	adaptiveGlobalThreadingEnabled()
+	{
+		return (adaptiveGlobalGCThreading && !gcThreadCountForced);
+	}
 
 	/**
 	 * Returns TRUE if an object is old, FALSE otherwise.
@@ -1500,10 +1543,17 @@ public:
 #endif /* defined(OMR_GC_VLHGC) */
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 		, concurrentSweep(false)
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+		, concurrentSweepBackground(1)
 #endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 		, largePageWarnOnError(false)
 		, largePageFailOnError(false)
 		, largePageFailedToSatisfy(false)
+		, hugePageAdvise(false)
+		, hugePageMemoryTypes(0)
+		, hugePageCollapse(false)
+		, hugePageAlignment(0)
 #if defined(OMR_GC_DOUBLE_MAP_ARRAYLETS)
 		, isArrayletDoubleMapRequested(false)
 		, isArrayletDoubleMapAvailable(false)
@@ -1538,6 +1588,8 @@ public:
 		, frequentObjectAllocationSamplingRate(100)
 		, frequentObjectsStats(NULL)
 		, frequentObjectAllocationSamplingDepth(0)
+		, allocationSamplingInterval(0)
+		, allocationProfiler(NULL)
 		, estimateFragmentation(GLOBALGC_ESTIMATE_FRAGMENTATION)
 		, processLargeAllocateStats(true) /* turn on processLargeAllocateStats by default */
 		, largeObjectAllocationProfilingThreshold(512)
@@ -1605,6 +1657,9 @@ public:
 		, packetListSplit(0)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
+		, markingWorkStealing(false)
+		, markingWorkStealingDequeSize(DEFAULT_MARKING_WORK_STEALING_DEQUE_SIZE)
+		, slotPrefetchDepth(0)
 		, rootScannerStatsEnabled(false)
 		, rootScannerStatsUsed(false)
 		, fvtest_forceOldResize(0)
@@ -1650,6 +1705,13 @@ public:
 		, gcThreadCount(0)
 		, gcThreadCountForced(false)
 		, dispatcherHybridNotifyThreadBound(16)
+		, adaptiveSyncSpin(false)
+		, adaptiveSyncSpinMaximum(50)
+		, adaptiveGCThreading(true)
+		, adaptiveThreadingSensitivityFactor(1.0f)
+		, adaptiveThreadingWeightActiveThreads(0.50f)
+		, adaptiveThreadBooster(0.85f)
+		, adaptiveGlobalGCThreading(false)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_NONE)
 		/* Start of options relating to dynamicBreadthFirstScanOrdering */
@@ -1681,6 +1743,8 @@ public:
 		, scavengerEnabled(false)
 		, scavengerRsoScanUnsafe(false)
 		, cacheListSplit(0)
+		, scavengerNUMAAware(false)
+		, scavengerNUMACopyChunkSize(512 * 1024)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, softwareRangeCheckReadBarrier(false)
 		, softwareRangeCheckReadBarrierForced(false)
@@ -1699,6 +1763,10 @@ public:
 		, scvArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, scavengerScanCacheMaximumSize(DEFAULT_SCAN_CACHE_MAXIMUM_SIZE)
 		, scavengerScanCacheMinimumSize(DEFAULT_SCAN_CACHE_MINIMUM_SIZE)
+		, adaptiveScanCacheSizing(false)
+		, scavengerPretenuring(false)
+		, scavengerPretenureThreshold(90)
+		, scavengerPretenureSizeClassMask(0)
 		, tiltedScavenge(true)
 		, debugTiltedScavenge(false)
 		, survivorSpaceMinimumSizeRatio(0.10)
@@ -1721,10 +1789,6 @@ public:
 		, dnssMinimumContraction(0.0)
 		, enableSplitHeap(false)
 		, aliasInhibitingThresholdPercentage(0.20)
-		, adaptiveGCThreading(true)
-		, adaptiveThreadingSensitivityFactor(1.0f)
-		, adaptiveThreadingWeightActiveThreads(0.50f)
-		, adaptiveThreadBooster(0.85f)
 		, splitHeapSection(HEAP_INITIALIZATION_SPLIT_HEAP_UNKNOWN)
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 		, globalMaximumContraction(0.05) /* by default, contract must be at most 5% of the committed heap */
@@ -1748,6 +1812,7 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, compactUseSummaryTable(false)
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1821,6 +1886,9 @@ public:
 #endif /* defined(OMR_GC_REALTIME) || defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		, defaultSizeClasses(NULL)
+		, segregatedGenerational(false)
+		, segregatedNurseryCollections(8)
+		, segregatedNurserySize(0)
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
 		, heapRegionStateTable(NULL)
@@ -1848,6 +1916,9 @@ public:
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, asyncLogging(false)
+		, asyncLoggingBufferSize(1024 * 1024)
+		, asyncLoggingBinary(false)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
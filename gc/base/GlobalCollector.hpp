@@ -102,6 +102,13 @@ public:
 
 	virtual void checkColorAndMark(MM_EnvironmentBase* env, omrobjectptr_t objectPt) {};
 
+	/**
+	 * Write barrier for collectors which track references from old to young objects themselves.
+	 * @param parentObject the object being stored into
+	 * @param childObject the object reference being stored
+	 */
+	virtual void rememberReference(MM_EnvironmentBase* env, omrobjectptr_t parentObject, omrobjectptr_t childObject) {};
+
 	/* Size in bytes to be reserved in an allocation cache for the collector. Required for specific use cases (SATB TLH Premark) */
 	virtual uintptr_t reservedForGCAllocCacheSize() { return 0; }
 
@@ -29,9 +29,12 @@
 #include "Forge.hpp"
 #include "GCExtensionsBase.hpp"
 #include "GlobalCollector.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
 #include "HeapStats.hpp"
 #include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
 #include "ModronAssertions.h"
 
 #include "mmhook_common.h"
@@ -197,6 +200,35 @@ MM_Heap::getActiveMemorySize(uintptr_t includeMemoryType)
 	return memory;
 }
 
+uintptr_t
+MM_Heap::getHugePageBackedMemorySize(uintptr_t includeMemoryType)
+{
+	uintptr_t backedSize = 0;
+	void *rangeBase = NULL;
+	void *rangeTop = NULL;
+	MM_HeapRegionDescriptor *region = NULL;
+	GC_HeapRegionIterator regionIterator(_heapRegionManager);
+
+	/* coalesce adjacent regions so the OS is queried once per contiguous range */
+	while (NULL != (region = regionIterator.nextRegion())) {
+		MM_MemorySubSpace *subspace = region->getSubSpace();
+		if ((NULL != subspace) && (0 != (subspace->getTypeFlags() & includeMemoryType))) {
+			if (region->getLowAddress() != rangeTop) {
+				if (NULL != rangeBase) {
+					backedSize += getHugePageBackedSize(rangeBase, (uintptr_t)rangeTop - (uintptr_t)rangeBase);
+				}
+				rangeBase = region->getLowAddress();
+			}
+			rangeTop = region->getHighAddress();
+		}
+	}
+	if (NULL != rangeBase) {
+		backedSize += getHugePageBackedSize(rangeBase, (uintptr_t)rangeTop - (uintptr_t)rangeBase);
+	}
+
+	return backedSize;
+}
+
 uintptr_t
 MM_Heap::getActiveLOAMemorySize(uintptr_t includeMemoryType)
 {
@@ -128,6 +128,16 @@ public:
 
 	virtual bool commitMemory(void *address, uintptr_t size) = 0;
 	virtual bool decommitMemory(void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress) = 0;
+	virtual bool adviseHugePages(void *address, uintptr_t size, uintptr_t advice) = 0;
+	virtual uintptr_t getHugePageBackedSize(void *address, uintptr_t size) = 0;
+
+	/**
+	 * Sum the bytes of the committed heap ranges of the given memory types that are currently backed by huge pages.
+	 * This queries the OS and is not cheap, so should only be used for reporting.
+	 * @param includeMemoryType memory types (MEMORY_TYPE_NEW and/or MEMORY_TYPE_OLD) to include
+	 * @return the number of huge page backed bytes
+	 */
+	uintptr_t getHugePageBackedMemorySize(uintptr_t includeMemoryType);
 
 	void mergeHeapStats(MM_HeapStats *heapStats, uintptr_t includeMemoryType);
 	void mergeHeapStats(MM_HeapStats *heapStats);
@@ -28,6 +28,7 @@
 #include "Forge.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HeapMapBulkScanner.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "Math.hpp"
 #include "MemoryManager.hpp"
@@ -233,6 +234,33 @@ MM_HeapMap::numberBitsInRange(MM_EnvironmentBase *env, void *lowAddress, void *h
 		
 }
 
+/**
+ * Number of set bits in specified range
+ *
+ * @param lowAddress - base of region of heap whose set heap map bits are to be counted
+ * @param highAddress - top of region of heap whose set heap map bits are to be counted
+ * @return the number of set bits in the heap map slots covering the range
+ */
+uintptr_t
+MM_HeapMap::numberSetBitsInRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress)
+{
+	uintptr_t baseIndex, topIndex;
+
+	/* Validate passed heap references */
+	Assert_MM_true(lowAddress < highAddress);
+	Assert_MM_true((uintptr_t)lowAddress == MM_Math::roundToCeiling(_extensions->heapAlignment,(uintptr_t)lowAddress));
+
+	/* Find mark index for base ptr */
+	baseIndex = ((uintptr_t)lowAddress) - _heapMapBaseDelta;
+	baseIndex >>= _heapMapIndexShift;
+
+	/* ..and for top ptr */
+	topIndex = ((uintptr_t)highAddress) - _heapMapBaseDelta;
+	topIndex >>= _heapMapIndexShift;
+
+	return MM_HeapMapBulkScanner::countSetBits(&(_heapMapBits[baseIndex]), &(_heapMapBits[topIndex]));
+}
+
 /**
  * Set all heap map bits for a specified heap range either ON or OFF
  * 				  
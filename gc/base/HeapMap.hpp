@@ -282,6 +282,15 @@ public:
 
 	uintptr_t numberBitsInRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress);
 
+	/**
+	 * Count the heap map bits that are set for a specified heap range
+	 *
+	 * @param lowAddress - base of region of heap whose set heap map bits are to be counted
+	 * @param highAddress - top of region of heap whose set heap map bits are to be counted
+	 * @return the number of set bits in the heap map slots covering the range
+	 */
+	uintptr_t numberSetBitsInRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress);
+
 	/**
 	 * Set all heap map bits for a specified heap range either ON or OFF
 	 *
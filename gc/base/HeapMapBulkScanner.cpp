@@ -0,0 +1,266 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "HeapMapBulkScanner.hpp"
+
+#include "Bits.hpp"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define OMR_HEAPMAP_BULK_SCAN_X86
+#define OMR_HEAPMAP_BULK_SCAN_TARGET(isa) __attribute__((target(isa)))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define OMR_HEAPMAP_BULK_SCAN_X86
+#define OMR_HEAPMAP_BULK_SCAN_TARGET(isa)
+#endif /* (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) */
+
+#if defined(OMR_HEAPMAP_BULK_SCAN_X86)
+#include <immintrin.h>
+#endif /* defined(OMR_HEAPMAP_BULK_SCAN_X86) */
+
+#define SLOTS_PER_BLOCK ((uintptr_t)MM_HeapMapBulkScanner::SLOTS_PER_CACHE_LINE)
+
+static uintptr_t *
+skipEmptyBlocksScalar(uintptr_t *slot, uintptr_t *slotTop)
+{
+	while (((uintptr_t)(slotTop - slot)) >= SLOTS_PER_BLOCK) {
+		uintptr_t block = 0;
+		for (uintptr_t i = 0; i < SLOTS_PER_BLOCK; i++) {
+			block |= slot[i];
+		}
+		if (0 != block) {
+			break;
+		}
+		slot += SLOTS_PER_BLOCK;
+	}
+	return slot;
+}
+
+static uintptr_t *
+skipFullBlocksScalar(uintptr_t *slot, uintptr_t *slotTop)
+{
+	while (((uintptr_t)(slotTop - slot)) >= SLOTS_PER_BLOCK) {
+		uintptr_t block = UDATA_MAX;
+		for (uintptr_t i = 0; i < SLOTS_PER_BLOCK; i++) {
+			block &= slot[i];
+		}
+		if (UDATA_MAX != block) {
+			break;
+		}
+		slot += SLOTS_PER_BLOCK;
+	}
+	return slot;
+}
+
+static uintptr_t
+countSetBitsScalar(uintptr_t *slot, uintptr_t *slotTop)
+{
+	uintptr_t count = 0;
+	for (; slot < slotTop; slot++) {
+		count += MM_Bits::populationCount(*slot);
+	}
+	return count;
+}
+
+#if defined(OMR_HEAPMAP_BULK_SCAN_X86)
+OMR_HEAPMAP_BULK_SCAN_TARGET("sse2") static uintptr_t *
+skipEmptyBlocksSSE2(uintptr_t *slot, uintptr_t *slotTop)
+{
+	while (((uintptr_t)(slotTop - slot)) >= SLOTS_PER_BLOCK) {
+		__m128i block = _mm_or_si128(
+				_mm_or_si128(_mm_load_si128((__m128i *)slot), _mm_load_si128((__m128i *)slot + 1)),
+				_mm_or_si128(_mm_load_si128((__m128i *)slot + 2), _mm_load_si128((__m128i *)slot + 3)));
+		if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_setzero_si128()))) {
+			break;
+		}
+		slot += SLOTS_PER_BLOCK;
+	}
+	return slot;
+}
+
+OMR_HEAPMAP_BULK_SCAN_TARGET("sse2") static uintptr_t *
+skipFullBlocksSSE2(uintptr_t *slot, uintptr_t *slotTop)
+{
+	while (((uintptr_t)(slotTop - slot)) >= SLOTS_PER_BLOCK) {
+		__m128i block = _mm_and_si128(
+				_mm_and_si128(_mm_load_si128((__m128i *)slot), _mm_load_si128((__m128i *)slot + 1)),
+				_mm_and_si128(_mm_load_si128((__m128i *)slot + 2), _mm_load_si128((__m128i *)slot + 3)));
+		if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(-1)))) {
+			break;
+		}
+		slot += SLOTS_PER_BLOCK;
+	}
+	return slot;
+}
+
+OMR_HEAPMAP_BULK_SCAN_TARGET("avx2") static uintptr_t *
+skipEmptyBlocksAVX2(uintptr_t *slot, uintptr_t *slotTop)
+{
+	while (((uintptr_t)(slotTop - slot)) >= SLOTS_PER_BLOCK) {
+		__m256i block = _mm256_or_si256(_mm256_load_si256((__m256i *)slot), _mm256_load_si256((__m256i *)slot + 1));
+		if (0 == _mm256_testz_si256(block, block)) {
+			break;
+		}
+		slot += SLOTS_PER_BLOCK;
+	}
+	return slot;
+}
+
+OMR_HEAPMAP_BULK_SCAN_TARGET("avx2") static uintptr_t *
+skipFullBlocksAVX2(uintptr_t *slot, uintptr_t *slotTop)
+{
+	while (((uintptr_t)(slotTop - slot)) >= SLOTS_PER_BLOCK) {
+		__m256i block = _mm256_and_si256(_mm256_load_si256((__m256i *)slot), _mm256_load_si256((__m256i *)slot + 1));
+		if (0 == _mm256_testc_si256(block, _mm256_set1_epi8(-1))) {
+			break;
+		}
+		slot += SLOTS_PER_BLOCK;
+	}
+	return slot;
+}
+
+OMR_HEAPMAP_BULK_SCAN_TARGET("avx512f") static uintptr_t *
+skipEmptyBlocksAVX512(uintptr_t *slot, uintptr_t *slotTop)
+{
+	while (((uintptr_t)(slotTop - slot)) >= SLOTS_PER_BLOCK) {
+		__m512i block = _mm512_load_si512((void *)slot);
+		if (0 != _mm512_test_epi64_mask(block, block)) {
+			break;
+		}
+		slot += SLOTS_PER_BLOCK;
+	}
+	return slot;
+}
+
+OMR_HEAPMAP_BULK_SCAN_TARGET("avx512f") static uintptr_t *
+skipFullBlocksAVX512(uintptr_t *slot, uintptr_t *slotTop)
+{
+	while (((uintptr_t)(slotTop - slot)) >= SLOTS_PER_BLOCK) {
+		__m512i block = _mm512_load_si512((void *)slot);
+		if (0 != _mm512_cmpneq_epi64_mask(block, _mm512_set1_epi64(-1))) {
+			break;
+		}
+		slot += SLOTS_PER_BLOCK;
+	}
+	return slot;
+}
+
+OMR_HEAPMAP_BULK_SCAN_TARGET("popcnt") static uintptr_t
+countSetBitsPOPCNT(uintptr_t *slot, uintptr_t *slotTop)
+{
+	uintptr_t count = 0;
+	for (; slot < slotTop; slot++) {
+#if defined(OMR_ENV_DATA64)
+		count += (uintptr_t)_mm_popcnt_u64((unsigned long long)*slot);
+#else /* defined(OMR_ENV_DATA64) */
+		count += (uintptr_t)_mm_popcnt_u32((unsigned int)*slot);
+#endif /* defined(OMR_ENV_DATA64) */
+	}
+	return count;
+}
+#endif /* defined(OMR_HEAPMAP_BULK_SCAN_X86) */
+
+MM_HeapMapBulkScanner::BlockScanFunction MM_HeapMapBulkScanner::_skipEmptyBlocks = skipEmptyBlocksScalar;
+MM_HeapMapBulkScanner::BlockScanFunction MM_HeapMapBulkScanner::_skipFullBlocks = skipFullBlocksScalar;
+MM_HeapMapBulkScanner::CountFunction MM_HeapMapBulkScanner::_countSetBits = countSetBitsScalar;
+MM_HeapMapBulkScanner::Implementation MM_HeapMapBulkScanner::_implementation = MM_HeapMapBulkScanner::IMPLEMENTATION_SCALAR;
+
+void
+MM_HeapMapBulkScanner::initialize(OMRPortLibrary *portLibrary)
+{
+	for (uintptr_t implementation = IMPLEMENTATION_COUNT - 1; implementation > IMPLEMENTATION_SCALAR; implementation--) {
+		if (selectImplementation(portLibrary, (Implementation)implementation)) {
+			return;
+		}
+	}
+	selectImplementation(portLibrary, IMPLEMENTATION_SCALAR);
+}
+
+bool
+MM_HeapMapBulkScanner::isSupported(OMRPortLibrary *portLibrary, Implementation implementation)
+{
+	bool supported = (IMPLEMENTATION_SCALAR == implementation);
+#if defined(OMR_HEAPMAP_BULK_SCAN_X86)
+	if (!supported) {
+		OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+		OMRProcessorDesc description;
+		if (0 == omrsysinfo_get_processor_description(&description)) {
+			/* the port library does not check XCR0, so require OS support for saving the extended vector state */
+			bool osSavesVectorState = TRUE == omrsysinfo_processor_has_feature(&description, OMR_FEATURE_X86_OSXSAVE);
+			switch (implementation) {
+			case IMPLEMENTATION_SSE2:
+				supported = TRUE == omrsysinfo_processor_has_feature(&description, OMR_FEATURE_X86_SSE2);
+				break;
+			case IMPLEMENTATION_AVX2:
+				supported = osSavesVectorState && (TRUE == omrsysinfo_processor_has_feature(&description, OMR_FEATURE_X86_AVX2));
+				break;
+			case IMPLEMENTATION_AVX512:
+				supported = osSavesVectorState && (TRUE == omrsysinfo_processor_has_feature(&description, OMR_FEATURE_X86_AVX512F));
+				break;
+			default:
+				break;
+			}
+		}
+	}
+#endif /* defined(OMR_HEAPMAP_BULK_SCAN_X86) */
+	return supported;
+}
+
+bool
+MM_HeapMapBulkScanner::selectImplementation(OMRPortLibrary *portLibrary, Implementation implementation)
+{
+	if (!isSupported(portLibrary, implementation)) {
+		return false;
+	}
+
+	_skipEmptyBlocks = skipEmptyBlocksScalar;
+	_skipFullBlocks = skipFullBlocksScalar;
+	_countSetBits = countSetBitsScalar;
+#if defined(OMR_HEAPMAP_BULK_SCAN_X86)
+	switch (implementation) {
+	case IMPLEMENTATION_SSE2:
+		_skipEmptyBlocks = skipEmptyBlocksSSE2;
+		_skipFullBlocks = skipFullBlocksSSE2;
+		break;
+	case IMPLEMENTATION_AVX2:
+		_skipEmptyBlocks = skipEmptyBlocksAVX2;
+		_skipFullBlocks = skipFullBlocksAVX2;
+		break;
+	case IMPLEMENTATION_AVX512:
+		_skipEmptyBlocks = skipEmptyBlocksAVX512;
+		_skipFullBlocks = skipFullBlocksAVX512;
+		break;
+	default:
+		break;
+	}
+	if (IMPLEMENTATION_SCALAR != implementation) {
+		OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+		OMRProcessorDesc description;
+		if ((0 == omrsysinfo_get_processor_description(&description))
+			&& (TRUE == omrsysinfo_processor_has_feature(&description, OMR_FEATURE_X86_POPCNT))
+		) {
+			_countSetBits = countSetBitsPOPCNT;
+		}
+	}
+#endif /* defined(OMR_HEAPMAP_BULK_SCAN_X86) */
+	_implementation = implementation;
+	return true;
+}
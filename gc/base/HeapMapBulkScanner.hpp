@@ -0,0 +1,177 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPMAPBULKSCANNER_HPP_)
+#define HEAPMAPBULKSCANNER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+#include "modronbase.h"
+
+/**
+ * Bulk scanning of heap map (mark map) slots.
+ * Sweeping and heap map iteration spend most of their time on sparse heaps stepping over empty map slots one
+ * at a time, and densely marked areas are runs of full slots.  This scanner tests a cache line worth of map slots
+ * per step, using the widest vector unit the processor reports at startup (AVX-512, AVX2 or SSE2) and an
+ * unrolled scalar loop everywhere else.
+ * @ingroup GC_Base
+ */
+class MM_HeapMapBulkScanner
+{
+	/* Data Members */
+public:
+	/**
+	 * Block scanning implementations, in order of preference.
+	 */
+	enum Implementation {
+		IMPLEMENTATION_SCALAR = 0,
+		IMPLEMENTATION_SSE2,
+		IMPLEMENTATION_AVX2,
+		IMPLEMENTATION_AVX512,
+		IMPLEMENTATION_COUNT
+	};
+
+	enum {
+		SLOTS_PER_CACHE_LINE = 64 / sizeof(uintptr_t) /**< Number of map slots tested by each bulk step */
+	};
+
+private:
+	/**
+	 * Scan whole cache line blocks of map slots starting at a cache line aligned slot.
+	 * @return the first block that does not satisfy the scan, or the first slot with fewer than
+	 * SLOTS_PER_CACHE_LINE slots before slotTop
+	 */
+	typedef uintptr_t *(*BlockScanFunction)(uintptr_t *slot, uintptr_t *slotTop);
+	typedef uintptr_t (*CountFunction)(uintptr_t *slot, uintptr_t *slotTop);
+
+	static BlockScanFunction _skipEmptyBlocks; /**< Block scan for runs of empty slots */
+	static BlockScanFunction _skipFullBlocks; /**< Block scan for runs of full slots */
+	static CountFunction _countSetBits; /**< Population count over a range of slots */
+	static Implementation _implementation; /**< Implementation currently in use */
+
+	/* Member Functions */
+private:
+	/**
+	 * Find how many slots must be stepped over one at a time before slot is cache line aligned.
+	 */
+	MMINLINE static uintptr_t
+	slotsToAlignment(uintptr_t *slot, uintptr_t *slotTop)
+	{
+		uintptr_t unaligned = (((uintptr_t)0 - (uintptr_t)slot) & (64 - 1)) / sizeof(uintptr_t);
+		uintptr_t available = (uintptr_t)(slotTop - slot);
+		return (unaligned < available) ? unaligned : available;
+	}
+
+protected:
+public:
+	/**
+	 * Select the widest block scanning implementation the processor supports.  Called once at startup, before any
+	 * heap map is scanned.
+	 * @param portLibrary the port library used to query processor features
+	 */
+	static void initialize(OMRPortLibrary *portLibrary);
+
+	/**
+	 * @param portLibrary the port library used to query processor features
+	 * @param implementation the implementation to test
+	 * @return true if this build contains the implementation and the processor supports it
+	 */
+	static bool isSupported(OMRPortLibrary *portLibrary, Implementation implementation);
+
+	/**
+	 * Force a specific implementation (used by tests to cover every variant).
+	 * @return true if the implementation was selected, false if it is not supported
+	 */
+	static bool selectImplementation(OMRPortLibrary *portLibrary, Implementation implementation);
+
+	MMINLINE static Implementation getImplementation() { return _implementation; }
+
+	/**
+	 * Find the end of a run of empty (all bits clear) map slots.
+	 * @param slot the first map slot to examine
+	 * @param slotTop the map slot at which to stop scanning (exclusive)
+	 * @return the first map slot in [slot, slotTop) with at least one bit set, or slotTop if every slot is empty
+	 */
+	MMINLINE static uintptr_t *
+	skipEmptySlots(uintptr_t *slot, uintptr_t *slotTop)
+	{
+		uintptr_t *alignedSlot = slot + slotsToAlignment(slot, slotTop);
+		while (slot < alignedSlot) {
+			if (0 != *slot) {
+				return slot;
+			}
+			slot += 1;
+		}
+
+		slot = _skipEmptyBlocks(slot, slotTop);
+
+		while ((slot < slotTop) && (0 == *slot)) {
+			slot += 1;
+		}
+		return slot;
+	}
+
+	/**
+	 * Find the end of a run of full (all bits set) map slots.
+	 * @param slot the first map slot to examine
+	 * @param slotTop the map slot at which to stop scanning (exclusive)
+	 * @return the first map slot in [slot, slotTop) with at least one bit clear, or slotTop if every slot is full
+	 */
+	MMINLINE static uintptr_t *
+	skipFullSlots(uintptr_t *slot, uintptr_t *slotTop)
+	{
+		uintptr_t *alignedSlot = slot + slotsToAlignment(slot, slotTop);
+		while (slot < alignedSlot) {
+			if (UDATA_MAX != *slot) {
+				return slot;
+			}
+			slot += 1;
+		}
+
+		slot = _skipFullBlocks(slot, slotTop);
+
+		while ((slot < slotTop) && (UDATA_MAX == *slot)) {
+			slot += 1;
+		}
+		return slot;
+	}
+
+	/**
+	 * Count the bits set in a range of map slots.
+	 * @param slot the first map slot to count
+	 * @param slotTop the map slot at which to stop counting (exclusive)
+	 * @return the number of set bits in [slot, slotTop)
+	 */
+	MMINLINE static uintptr_t
+	countSetBits(uintptr_t *slot, uintptr_t *slotTop)
+	{
+		return _countSetBits(slot, slotTop);
+	}
+};
+
+#endif /* HEAPMAPBULKSCANNER_HPP_ */
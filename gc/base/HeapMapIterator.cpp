@@ -24,6 +24,7 @@
 #include "Bits.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapMap.hpp"
+#include "HeapMapBulkScanner.hpp"
 #include "Math.hpp"
 #include "ObjectModel.hpp"
 
@@ -130,7 +131,14 @@ MM_HeapMapIterator::nextObject()
 		_heapMapSlotCurrent += 1;
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
-			_heapMapSlotValue = *_heapMapSlotCurrent;
+			/* Step over any run of empty heap map slots covering the remainder of the chunk in bulk */
+			uintptr_t remainingMapSlots = MM_Math::roundToCeiling(J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT, _heapChunkTop - _heapSlotCurrent) / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT;
+			uintptr_t *heapMapSlotNonEmpty = MM_HeapMapBulkScanner::skipEmptySlots(_heapMapSlotCurrent, _heapMapSlotCurrent + remainingMapSlots);
+			_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (heapMapSlotNonEmpty - _heapMapSlotCurrent);
+			_heapMapSlotCurrent = heapMapSlotNonEmpty;
+			if(_heapSlotCurrent < _heapChunkTop) {
+				_heapMapSlotValue = *_heapMapSlotCurrent;
+			}
 		}
 	}
 
@@ -300,6 +300,28 @@ MM_HeapSplit::decommitMemory(void *address, uintptr_t size, void *lowValidAddres
 }
 
 
+/**
+ * Advise the OS on transparent huge page backing for the address range, which must lie within one extent.
+ * @return true if successful or not supported by the platform, false otherwise.
+ */
+bool
+MM_HeapSplit::adviseHugePages(void *address, uintptr_t size, uintptr_t advice)
+{
+	MM_HeapVirtualMemory *extent = (address < _lowExtent->getHeapTop()) ? _lowExtent : _highExtent;
+	return extent->adviseHugePages(address, size, advice);
+}
+
+/**
+ * Get the number of bytes of the address range, which must lie within one extent, currently backed by huge pages.
+ * @return the huge page backed size, 0 if unknown.
+ */
+uintptr_t
+MM_HeapSplit::getHugePageBackedSize(void *address, uintptr_t size)
+{
+	MM_HeapVirtualMemory *extent = (address < _lowExtent->getHeapTop()) ? _lowExtent : _highExtent;
+	return extent->getHugePageBackedSize(address, size);
+}
+
 /**
  * Calculate the offset of an address from the base of the heap.
  * @param The address which require the offset for.
@@ -80,6 +80,12 @@ MM_HeapVirtualMemory::initialize(MM_EnvironmentBase* env, uintptr_t size)
 	/* we need to ensure that we allocate the heap with region alignment since the region table requires that */
 	MM_HeapRegionManager* manager = getHeapRegionManager();
 	effectiveHeapAlignment = MM_Math::roundToCeiling(manager->getRegionSize(), effectiveHeapAlignment);
+	/* reserve the heap on a huge page boundary so that the OS can back it with huge pages from its first byte */
+	if (0 != extensions->hugePageAlignment) {
+		effectiveHeapAlignment = MM_Math::roundToCeiling(extensions->hugePageAlignment, effectiveHeapAlignment);
+		/* the heap top is rounded down to the same alignment, so a size that is not a multiple of it would lose its tail */
+		size = MM_Math::roundToCeiling(effectiveHeapAlignment, size);
+	}
 
 	MM_MemoryManager* memoryManager = extensions->memoryManager;
 	bool created = false;
@@ -342,6 +348,30 @@ MM_HeapVirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowVal
 	return memoryManager->decommitMemory(&_vmemHandle, address, size, lowValidAddress, highValidAddress);
 }
 
+/**
+ * Advise the OS on transparent huge page backing for the address range.
+ * @return true if successful or not supported by the platform, false otherwise.
+ */
+bool
+MM_HeapVirtualMemory::adviseHugePages(void* address, uintptr_t size, uintptr_t advice)
+{
+	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
+	MM_MemoryManager* memoryManager = extensions->memoryManager;
+	return memoryManager->adviseHugePages(&_vmemHandle, address, size, advice);
+}
+
+/**
+ * Get the number of bytes of the address range currently backed by huge pages.
+ * @return the huge page backed size, 0 if unknown.
+ */
+uintptr_t
+MM_HeapVirtualMemory::getHugePageBackedSize(void* address, uintptr_t size)
+{
+	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
+	MM_MemoryManager* memoryManager = extensions->memoryManager;
+	return memoryManager->getHugePageBackedSize(&_vmemHandle, address, size);
+}
+
 /**
  * Calculate the offset of an address from the base of the heap.
  * @param The address which require the offset for.
@@ -36,7 +36,10 @@
 #include "Heap.hpp"
 #include "MarkMap.hpp"
 #include "MarkingScheme.hpp"
+#include "ParallelDispatcher.hpp"
+#include "SlotPrefetchQueue.hpp"
 #include "Task.hpp"
+#include "WorkStealingDeque.hpp"
 #if defined(OMR_GC_REALTIME)
 #include "WorkPacketsSATB.hpp"
 #endif /* defined(OMR_GC_REALTIME) */
@@ -96,6 +99,24 @@ MM_MarkingScheme::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+	if (_extensions->markingWorkStealing) {
+		_markDequeCount = _extensions->gcThreadCount;
+		_markDeques = (MM_WorkStealingDeque **)env->getForge()->allocate(_markDequeCount * sizeof(MM_WorkStealingDeque *), OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+		if (NULL == _markDeques) {
+			goto error_no_memory;
+		}
+		memset(_markDeques, 0, _markDequeCount * sizeof(MM_WorkStealingDeque *));
+		for (uintptr_t i = 0; i < _markDequeCount; i++) {
+			_markDeques[i] = MM_WorkStealingDeque::newInstance(env, _extensions->markingWorkStealingDequeSize);
+			if (NULL == _markDeques[i]) {
+				goto error_no_memory;
+			}
+		}
+		if (0 != omrthread_monitor_init_with_name(&_stealTerminationMonitor, 0, "MM_MarkingScheme::stealTermination")) {
+			goto error_no_memory;
+		}
+	}
+
 	return _delegate.initialize(env, this);
 
 error_no_memory:
@@ -117,6 +138,21 @@ MM_MarkingScheme::tearDown(MM_EnvironmentBase *env)
 		_workPackets->kill(env);
 		_workPackets = NULL;
 	}
+
+	if (NULL != _markDeques) {
+		for (uintptr_t i = 0; i < _markDequeCount; i++) {
+			if (NULL != _markDeques[i]) {
+				_markDeques[i]->kill(env);
+			}
+		}
+		env->getForge()->free(_markDeques);
+		_markDeques = NULL;
+	}
+
+	if (NULL != _stealTerminationMonitor) {
+		omrthread_monitor_destroy(_stealTerminationMonitor);
+		_stealTerminationMonitor = NULL;
+	}
 }
 
 /**
@@ -249,18 +285,36 @@ MM_MarkingScheme::markObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr,
 /**************************************************************************
  * name        -  numMarkBitsInRange
  *
- * description -  Determine number of mark bits for specified heap range
+ * description -  Count the mark bits set for specified heap range
  *
  *
  * parameters  - heapBase - base of region of heap whoose mark bits are to be
  * 						    counted
  * 			     heapTop  - top of region of heap whoose mark bits to be counted
  *
+ * return      - the number of mark bits set for specified heap range
+ * *************************************************************************/
+uintptr_t
+MM_MarkingScheme::numMarkBitsInRange(MM_EnvironmentBase *env, void *heapBase, void *heapTop)
+{
+	return  _markMap->numberSetBitsInRange(env, heapBase, heapTop);
+}
+
+/**************************************************************************
+ * name        -  numMarkMapBytesInRange
+ *
+ * description -  Determine size of the mark map for specified heap range
+ *
+ *
+ * parameters  - heapBase - base of region of heap whoose mark map is to be
+ * 						    sized
+ * 			     heapTop  - top of region of heap whoose mark map is to be sized
+ *
  * return      - the number of bytes worth of mark bits for specified heap
  * 				 range
  * *************************************************************************/
 uintptr_t
-MM_MarkingScheme::numMarkBitsInRange(MM_EnvironmentBase *env, void *heapBase, void *heapTop)
+MM_MarkingScheme::numMarkMapBytesInRange(MM_EnvironmentBase *env, void *heapBase, void *heapTop)
 {
 	return  _markMap->numberBitsInRange(env, heapBase, heapTop);
 }
@@ -288,10 +342,10 @@ MM_MarkingScheme::setMarkBitsInRange(MM_EnvironmentBase *env, void *heapBase, vo
  ****************************************
  */
 /**
- * Private internal. Called exclusively from completeScan();
+ * Private internal. Called exclusively from completeScan() and completeScanWithWorkStealing();
  */
 uintptr_t
-MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, MM_WorkStealingDeque *deque)
 {
 	uintptr_t sizeToDo = UDATA_MAX;
 	GC_ObjectScannerState objectScannerState;
@@ -299,14 +353,47 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 	if (NULL != objectScanner) {
 		bool isLeafSlot = false;
 		GC_SlotObject *slotObject;
+		if (0 == _extensions->slotPrefetchDepth) {
 #if defined(OMR_GC_LEAF_BITS)
-		while (NULL != (slotObject = objectScanner->getNextSlot(&isLeafSlot))) {
+			while (NULL != (slotObject = objectScanner->getNextSlot(&isLeafSlot))) {
 #else /* OMR_GC_LEAF_BITS */
-		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			while (NULL != (slotObject = objectScanner->getNextSlot())) {
 #endif /* OMR_GC_LEAF_BITS */
-			fixupForwardedSlot(slotObject);
+				fixupForwardedSlot(slotObject);
 
-			inlineMarkObjectNoCheck(env, slotObject->readReferenceFromSlot(), isLeafSlot);
+				markSlotTarget(env, slotObject->readReferenceFromSlot(), isLeafSlot, deque);
+			}
+		} else {
+			/* prefetch the mark map word of each slot target a few slots before its mark bit is set */
+			MM_SlotPrefetchQueue prefetchQueue(_extensions->slotPrefetchDepth);
+			GC_SlotObject readySlot(env->getOmrVM(), NULL);
+			bool slotsRemaining = true;
+			while (slotsRemaining || !prefetchQueue.isEmpty()) {
+				if (slotsRemaining) {
+#if defined(OMR_GC_LEAF_BITS)
+					slotObject = objectScanner->getNextSlot(&isLeafSlot);
+#else /* OMR_GC_LEAF_BITS */
+					slotObject = objectScanner->getNextSlot();
+#endif /* OMR_GC_LEAF_BITS */
+					if (NULL != slotObject) {
+						omrobjectptr_t target = slotObject->readReferenceFromSlot();
+						if (NULL != target) {
+							MM_SlotPrefetchQueue::prefetch(_markMap->getSlotPtrForAddress(target));
+						}
+						prefetchQueue.push(slotObject, isLeafSlot);
+						if (!prefetchQueue.isFull()) {
+							continue;
+						}
+					} else {
+						slotsRemaining = false;
+						continue;
+					}
+				}
+				prefetchQueue.pop(&readySlot, &isLeafSlot);
+				fixupForwardedSlot(&readySlot);
+
+				markSlotTarget(env, readySlot.readReferenceFromSlot(), isLeafSlot, deque);
+			}
 		}
 	}
 	return sizeToDo;
@@ -321,15 +408,139 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 void
 MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 {
+	if (isWorkStealingActive(env)) {
+		completeScanWithWorkStealing(env);
+		return;
+	}
+
 	do {
 		omrobjectptr_t objectPtr = NULL;
 		while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
-			env->_markStats._bytesScanned += scanObject(env, objectPtr);
+			env->_markStats._bytesScanned += scanObject(env, objectPtr, NULL);
+			env->_markStats._objectsScanned += 1;
+		}
+	} while (_workPackets->handleWorkPacketOverflow(env));
+}
+
+bool
+MM_MarkingScheme::isWorkStealingActive(MM_EnvironmentBase *env)
+{
+	return (NULL != _markDeques)
+		&& (NULL != env->_currentTask)
+		&& (_markDequeCount >= _extensions->dispatcher->threadCountMaximum());
+}
+
+/**
+ * Scan until there are no more objects in any deque or work packet.
+ * @note This is a joining scan: a thread will not exit this method until
+ * all threads have entered and all deques and work packets are empty.
+ */
+void
+MM_MarkingScheme::completeScanWithWorkStealing(MM_EnvironmentBase *env)
+{
+	MM_WorkStealingDeque *deque = _markDeques[env->getWorkerID()];
+	uintptr_t seed = env->getWorkerID() + 1;
+
+	do {
+		while (true) {
+			omrobjectptr_t objectPtr = (omrobjectptr_t)deque->pop();
+			if (NULL == objectPtr) {
+				/* roots and spilled work arrive through the work packets */
+				objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env);
+				if (NULL == objectPtr) {
+					objectPtr = stealMarkWork(env, &seed);
+					if (NULL == objectPtr) {
+						if (markWorkStealingTerminate(env)) {
+							break;
+						}
+						continue;
+					}
+				}
+			}
+			env->_markStats._bytesScanned += scanObject(env, objectPtr, deque);
 			env->_markStats._objectsScanned += 1;
 		}
+		Assert_MM_true(deque->isEmpty());
 	} while (_workPackets->handleWorkPacketOverflow(env));
 }
 
+omrobjectptr_t
+MM_MarkingScheme::stealMarkWork(MM_EnvironmentBase *env, uintptr_t *seed)
+{
+	uintptr_t self = env->getWorkerID();
+	/* xorshift - cheap per thread pseudo random victim selection */
+	uintptr_t x = *seed;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	*seed = x;
+
+	uintptr_t start = x % _markDequeCount;
+	for (uintptr_t i = 0; i < _markDequeCount; i++) {
+		uintptr_t victim = (start + i) % _markDequeCount;
+		if ((victim != self) && !_markDeques[victim]->isEmpty()) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.workStealAttempts += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			omrobjectptr_t objectPtr = (omrobjectptr_t)_markDeques[victim]->steal();
+			if (NULL != objectPtr) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+				env->_workPacketStats.workStealSuccesses += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+				return objectPtr;
+			}
+		}
+	}
+	return NULL;
+}
+
+bool
+MM_MarkingScheme::isMarkWorkAvailable(MM_EnvironmentBase *env)
+{
+	for (uintptr_t i = 0; i < _markDequeCount; i++) {
+		if (!_markDeques[i]->isEmpty()) {
+			return true;
+		}
+	}
+	return _workPackets->inputPacketAvailable(env);
+}
+
+bool
+MM_MarkingScheme::markWorkStealingTerminate(MM_EnvironmentBase *env)
+{
+	bool done = false;
+	uintptr_t threadCount = env->_currentTask->getThreadCount();
+
+	omrthread_monitor_enter(_stealTerminationMonitor);
+	uintptr_t doneIndex = _stealDoneIndex;
+	_stealIdleThreadCount += 1;
+	while (true) {
+		if (doneIndex != _stealDoneIndex) {
+			/* another thread has already observed every thread idle */
+			done = true;
+			break;
+		}
+		if (threadCount == _stealIdleThreadCount) {
+			/* Idle threads never publish work, so all deques and packets are empty */
+			_stealIdleThreadCount = 0;
+			_stealDoneIndex += 1;
+			done = true;
+			break;
+		}
+		if (isMarkWorkAvailable(env)) {
+			_stealIdleThreadCount -= 1;
+			break;
+		}
+		/* deque pushes are lock free and do not notify, so poll */
+		omrthread_monitor_exit(_stealTerminationMonitor);
+		omrthread_yield();
+		omrthread_monitor_enter(_stealTerminationMonitor);
+	}
+	omrthread_monitor_exit(_stealTerminationMonitor);
+
+	return done;
+}
+
 /****************************************
  * Marking Core Functionality
  ****************************************/
@@ -37,6 +37,7 @@
 #include "ObjectModel.hpp"
 #include "ObjectScannerState.hpp"
 #include "WorkStack.hpp"
+#include "WorkStealingDeque.hpp"
 
 /**
  * @todo Provide class documentation
@@ -56,6 +57,11 @@ protected:
 	MM_WorkPackets *_workPackets;
 	void *_heapBase;
 	void *_heapTop;
+	MM_WorkStealingDeque **_markDeques; /**< Per-worker deques, indexed by worker ID, used by completeScan when markingWorkStealing is enabled */
+	uintptr_t _markDequeCount; /**< Number of entries in _markDeques */
+	omrthread_monitor_t _stealTerminationMonitor; /**< Protects the work stealing termination state below */
+	uintptr_t _stealIdleThreadCount; /**< Number of threads that found no work in any deque or packet */
+	volatile uintptr_t _stealDoneIndex; /**< Incremented each time all threads agree that stealing scan is complete */
 
 public:
 
@@ -72,9 +78,64 @@ private:
 	}
 	
 	/**
-	 * Private internal. Called exclusively from completeScan();
+	 * Private internal. Called exclusively from completeScan() and completeScanWithWorkStealing().
+	 * @param[in] deque the thread's own deque when work stealing, newly marked objects go there before
+	 * spilling to the work stack. NULL pushes them straight to the work stack.
 	 */
-	MMINLINE uintptr_t scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+	MMINLINE uintptr_t scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, MM_WorkStealingDeque *deque);
+
+	/**
+	 * Mark the target of a slot found by the private scanObject().
+	 * @see scanObject(MM_EnvironmentBase *, omrobjectptr_t, MM_WorkStealingDeque *)
+	 */
+	MMINLINE void
+	markSlotTarget(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, bool leafType, MM_WorkStealingDeque *deque)
+	{
+		if (NULL == deque) {
+			inlineMarkObjectNoCheck(env, objectPtr, leafType);
+		} else {
+			assertSaneObjectPtr(env, objectPtr);
+			if (_markMap->atomicSetBit(objectPtr)) {
+				if (!leafType && !deque->push((void *)objectPtr)) {
+					/* deque is full - spill to the work packets, which fall back to the overflow handler */
+					env->_workStack.push(env, (void *)objectPtr);
+				}
+				env->_markStats._objectsMarked += 1;
+			}
+		}
+	}
+
+	/**
+	 * Work stealing variant of completeScan(). Threads drain their own deque first, then the shared work
+	 * packets, and finally steal from the deques of randomly chosen victims before attempting to terminate.
+	 */
+	void completeScanWithWorkStealing(MM_EnvironmentBase *env);
+
+	/**
+	 * Attempt to steal one object from the deque of another worker.
+	 * @param[in] env calling thread environment
+	 * @param[in/out] seed per thread random state used to choose the first victim
+	 * @return a stolen object or NULL if every deque appeared empty
+	 */
+	omrobjectptr_t stealMarkWork(MM_EnvironmentBase *env, uintptr_t *seed);
+
+	/**
+	 * Called by a thread that has no local work. Blocks until either work becomes visible in a deque
+	 * or work packet (return false) or all threads of the task are idle (return true).
+	 */
+	bool markWorkStealingTerminate(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if any deque or the shared work packets hold an object to scan
+	 */
+	bool isMarkWorkAvailable(MM_EnvironmentBase *env);
+
+	/**
+	 * The decision must be the same for every thread of a task, so it is made on the dispatcher
+	 * maximum thread count (which bounds worker IDs) rather than on the calling thread.
+	 * @return true if completeScan should use the work stealing deques for the current task
+	 */
+	bool isWorkStealingActive(MM_EnvironmentBase *env);
 
 	MM_WorkPackets *createWorkPackets(MM_EnvironmentBase *env);
 
@@ -208,6 +269,7 @@ public:
 	void markObjectsForRange(MM_EnvironmentBase *env, uint8_t *objPtrLow, uint8_t *objPtrHigh);
 
 	uintptr_t numMarkBitsInRange(MM_EnvironmentBase *env, void *heapBase, void *heapTop);
+	uintptr_t numMarkMapBytesInRange(MM_EnvironmentBase *env, void *heapBase, void *heapTop);
 	uintptr_t setMarkBitsInRange(MM_EnvironmentBase *env, void *heapBase, void *heapTop, bool clear);
 	uintptr_t numHeapBytesPerMarkMapByte() { return (_markMap->getObjectGrain() * BITS_PER_BYTE); };
 
@@ -312,6 +374,11 @@ public:
 		, _workPackets(NULL)
 		, _heapBase(NULL)
 		, _heapTop(NULL)
+		, _markDeques(NULL)
+		, _markDequeCount(0)
+		, _stealTerminationMonitor(NULL)
+		, _stealIdleThreadCount(0)
+		, _stealDoneIndex(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -614,6 +614,24 @@ MM_MemoryManager::decommitMemory(MM_MemoryHandle* handle, void* address, uintptr
 	return memory->decommitMemory(address, size, lowValidAddress, highValidAddress);
 }
 
+bool
+MM_MemoryManager::adviseHugePages(MM_MemoryHandle* handle, void* address, uintptr_t size, uintptr_t advice)
+{
+	Assert_MM_true(NULL != handle);
+	MM_VirtualMemory* memory = handle->getVirtualMemory();
+	Assert_MM_true(NULL != memory);
+	return memory->adviseHugePages(address, size, advice);
+}
+
+uintptr_t
+MM_MemoryManager::getHugePageBackedSize(MM_MemoryHandle* handle, void* address, uintptr_t size)
+{
+	Assert_MM_true(NULL != handle);
+	MM_VirtualMemory* memory = handle->getVirtualMemory();
+	Assert_MM_true(NULL != memory);
+	return memory->getHugePageBackedSize(address, size);
+}
+
 bool
 MM_MemoryManager::isLargePage(MM_EnvironmentBase* env, uintptr_t pageSize)
 {
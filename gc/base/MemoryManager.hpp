@@ -234,6 +234,27 @@ public:
 	 */
 	bool decommitMemory(MM_MemoryHandle* handle, void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
 
+	/**
+	 * Advise transparent huge page backing for a committed range of specified virtual memory instance
+	 *
+	 * @param pointer to memory handle
+	 * @param address start address of the range
+	 * @param size size of the range
+	 * @param advice one of the OMRPORT_VMEM_HUGE_PAGE_ADVICE_* values
+	 * @return true if succeed or the advice is not supported on this platform
+	 */
+	bool adviseHugePages(MM_MemoryHandle* handle, void* address, uintptr_t size, uintptr_t advice);
+
+	/**
+	 * Get the number of bytes of a range of specified virtual memory instance currently backed by huge pages
+	 *
+	 * @param pointer to memory handle
+	 * @param address start address of the range
+	 * @param size size of the range
+	 * @return huge page backed bytes, 0 if unknown
+	 */
+	uintptr_t getHugePageBackedSize(MM_MemoryHandle* handle, void* address, uintptr_t size);
+
 #if defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER)
 	/*
 	 * Set the NUMA affinity for the specified range within the receiver.
@@ -351,6 +351,18 @@ public:
 
 	MMINLINE virtual uintptr_t getDarkMatterSamples() { return _darkMatterSamples; }
 
+	/**
+	 * @return the number of free list searches that started from the free list size index since the large object
+	 * allocate stats were last reset
+	 */
+	MMINLINE virtual uintptr_t getFreeListIndexHits() { return (NULL == _largeObjectAllocateStats) ? 0 : _largeObjectAllocateStats->getFreeListIndexHits(); }
+
+	/**
+	 * @return the number of free list searches for which the free list size index had no usable entry since the
+	 * large object allocate stats were last reset
+	 */
+	MMINLINE virtual uintptr_t getFreeListIndexMisses() { return (NULL == _largeObjectAllocateStats) ? 0 : _largeObjectAllocateStats->getFreeListIndexMisses(); }
+
 	MMINLINE virtual uintptr_t getFreeMemoryAndDarkMatterBytes() {
 		return getActualFreeMemorySize() + getDarkMatterBytes();
 	}
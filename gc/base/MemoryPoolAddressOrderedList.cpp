@@ -231,6 +231,8 @@ MM_MemoryPoolAddressOrderedList::clearHints()
 	_hintInactive = inactiveHint;
 	_hintActive = NULL;
 	_hintLru = 1;
+
+	_sizeIndex.clear();
 }
 
 MMINLINE void
@@ -391,6 +393,8 @@ MM_MemoryPoolAddressOrderedList::removeHint(MM_HeapLinkedFreeHeader *freeEntry)
 			hint = hint->next;
 		}
 	}
+
+	_sizeIndex.remove(freeEntry);
 }
 
 MMINLINE void
@@ -411,6 +415,8 @@ MM_MemoryPoolAddressOrderedList::updateHint(MM_HeapLinkedFreeHeader *oldFreeEntr
 			hint = hint->next;
 		}
 	}
+
+	_sizeIndex.replace(oldFreeEntry, newFreeEntry);
 }
 
 /**
@@ -431,6 +437,8 @@ MM_MemoryPoolAddressOrderedList::updateHintsBeyondEntry(MM_HeapLinkedFreeHeader
 		/* Move to the next hint */
 		hint = hint->next;
 	}
+
+	_sizeIndex.truncate(freeEntry);
 }
 
 /****************************************
@@ -470,6 +478,22 @@ retry:
 		candidateHintSize = allocateHintUsed->size;
 	}
 
+	/* Start from the size index instead if it skips further ahead. The walk must not stop at the starting
+	 * entry itself since its predecessor is unknown; stale entries lie before the list head.
+	 */
+	{
+		uintptr_t sizeClass = MM_FreeListSizeIndex::getSizeClass(sizeInBytesRequired);
+		MM_HeapLinkedFreeHeader *indexEntry = _sizeIndex.getEntry(sizeClass);
+		if ((NULL != indexEntry) && (NULL != _heapFreeList) && (indexEntry >= _heapFreeList) && (indexEntry->getSize() < sizeInBytesRequired)) {
+			_largeObjectAllocateStats->incrementFreeListIndexHits();
+			if ((NULL == allocateHintUsed) || (indexEntry > currentFreeEntry)) {
+				currentFreeEntry = indexEntry;
+				candidateHintSize = _sizeIndex.getPrefixSize(sizeClass);
+			}
+		} else {
+			_largeObjectAllocateStats->incrementFreeListIndexMisses();
+		}
+	}
 
 	while(currentFreeEntry) {
 		if (doesNeedCardAlignment(env, currentFreeEntry)) {
@@ -516,6 +540,9 @@ retry:
 	if((walkCount >= J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK) || ((walkCount > 1) && allocateHintUsed)) {
 		addHint(previousFreeEntry, candidateHintSize);
 	}
+	if (NULL != previousFreeEntry) {
+		_sizeIndex.update(previousFreeEntry, candidateHintSize);
+	}
 
 	/* Adjust the free memory size */
 	_freeMemorySize -= sizeInBytesRequired;
@@ -835,6 +862,17 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 	resetLargeObjectAllocateStats();
 }
 
+/**
+ * Once sweep has rebuilt the free list, index it so large allocations do not start from the list head.
+ */
+void
+MM_MemoryPoolAddressOrderedList::postProcess(MM_EnvironmentBase *env, Cause cause)
+{
+	if (forSweep == cause) {
+		_sizeIndex.rebuild(_heapFreeList, compressObjectReferences());
+	}
+}
+
 /**
  * As opposed to reset, which will empty out, this will fill out as if everything is free.
  * Returns the freelist entry created at the end of the given region
@@ -847,6 +885,8 @@ MM_MemoryPoolAddressOrderedList::rebuildFreeListInRegion(MM_EnvironmentBase *env
 	void* rangeTop = region->getHighAddress();
 	uintptr_t rangeSize = region->getSize();
 
+	_sizeIndex.clear();
+
 	/* This may be called while VM running (indirectly from JCL
 	 * to create RTJ Scoped Memory, so we need proper locking
 	 */
@@ -913,6 +953,8 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 	bool const compressed = compressObjectReferences();
 	MM_HeapLinkedFreeHeader *previousFreeEntry, *nextFreeEntry;
 
+	_sizeIndex.clear();
+
 	if(0 == expandSize) {
 		return ;
 	}
@@ -1025,6 +1067,8 @@ MM_MemoryPoolAddressOrderedList::contractWithRange(MM_EnvironmentBase *env, uint
 	uintptr_t totalContractSize;
 	intptr_t contractCount;
 
+	_sizeIndex.clear();
+
 	if(0 == contractSize) {
 		return NULL;
 	}
@@ -1115,6 +1159,8 @@ MM_MemoryPoolAddressOrderedList::addFreeEntries(MM_EnvironmentBase *env,
 	bool const compressed = compressObjectReferences();
 	uintptr_t localFreeListMemoryCount = freeListMemoryCount;
 
+	_sizeIndex.clear();
+
 	MM_HeapLinkedFreeHeader *currentFreeEntry = freeListHead;
 
 	while (currentFreeEntry != NULL) {
@@ -1207,6 +1253,8 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 	intptr_t removeCount = 0;
 	uintptr_t trailingSize, leadingSize;
 
+	_sizeIndex.clear();
+
 	void *currentFreeEntryTop, *baseAddr, *topAddr;
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry, *nextFreeEntry, *tailFreeEntry;
 
@@ -1587,6 +1635,8 @@ MM_MemoryPoolAddressOrderedList::moveHeap(MM_EnvironmentBase *env, void *srcBase
 	bool const compressed = compressObjectReferences();
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry;
 
+	_sizeIndex.clear();
+
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
 	while(currentFreeEntry) {
@@ -1693,6 +1743,9 @@ MM_MemoryPoolAddressOrderedList::recycleHeapChunk(MM_EnvironmentBase *env, void
 	if ((NULL == prev) || (chunkTop != top)) {
 		/* inserted freeEntry before _heapFreeList, it might confuse the checking for staled Hint, so clear hints for avoiding the cases.  */
 		clearHints();
+	} else {
+		/* the recycled entry may satisfy size classes the size index starts beyond */
+		_sizeIndex.insert(prev, (MM_HeapLinkedFreeHeader *)base, (uintptr_t)top - (uintptr_t)base);
 	}
 
 	_largeObjectAllocateStats->incrementFreeEntrySizeClassStats((uintptr_t)top - (uintptr_t)base);
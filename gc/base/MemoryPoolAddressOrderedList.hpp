@@ -27,6 +27,7 @@
 #include "omrcomp.h"
 #include "modronopt.h"
 
+#include "FreeListSizeIndex.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "LightweightNonReentrantLock.hpp"
 #include "MemoryPoolAddressOrderedListBase.hpp"
@@ -60,6 +61,8 @@ private:
 	struct J9ModronAllocateHint* _hintInactive;
 	struct J9ModronAllocateHint _hintStorage[HINT_ELEMENT_COUNT];
 	uintptr_t _hintLru;
+
+	MM_FreeListSizeIndex _sizeIndex; /**< Size-segregated starting points for free list searches, maintained under the same rules as hints (the walk from there is still linear) */
 	
 	MM_LargeObjectAllocateStats *_largeObjectCollectorAllocateStats;  /**< Same as _largeObjectAllocateStats except specifically for collector allocates */
 
@@ -132,6 +135,7 @@ public:
 	virtual void tearDown(MM_EnvironmentBase *env);
 
 	virtual void reset(Cause cause = any);
+	virtual void postProcess(MM_EnvironmentBase *env, Cause cause);
 	virtual MM_HeapLinkedFreeHeader *rebuildFreeListInRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region, MM_HeapLinkedFreeHeader *previousFreeEntry);
 
 #if defined(DEBUG)
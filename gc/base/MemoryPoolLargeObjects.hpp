@@ -252,6 +252,16 @@ public:
 		return (_memoryPoolSmallObjects->getDarkMatterBytes() + _memoryPoolLargeObjects->getDarkMatterBytes());
 	}
 
+	MMINLINE virtual uintptr_t getFreeListIndexHits()
+	{
+		return (_memoryPoolSmallObjects->getFreeListIndexHits() + _memoryPoolLargeObjects->getFreeListIndexHits());
+	}
+
+	MMINLINE virtual uintptr_t getFreeListIndexMisses()
+	{
+		return (_memoryPoolSmallObjects->getFreeListIndexMisses() + _memoryPoolLargeObjects->getFreeListIndexMisses());
+	}
+
 	/**
 	 * @return the ratio of Large Object Area
 	 */
@@ -26,11 +26,17 @@
  * @ingroup GC_Base_Core
  */
 
+#include <math.h>
+
 #include "ObjectAllocationInterface.hpp"
 
+#include "mmomrhook_internal.h"
+
+#include "AllocateDescription.hpp"
 #include "Debug.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "Math.hpp"
 
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 /**
@@ -47,6 +53,62 @@ MM_ObjectAllocationInterface::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDe
 }
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */
 
+uintptr_t
+MM_ObjectAllocationInterface::nextAllocationSampleThreshold(MM_EnvironmentBase *env)
+{
+	double mean = (double)env->getExtensions()->allocationSamplingInterval;
+
+	/* xorshift64*, the top 53 bits give a uniform double in (0, 1) */
+	_allocationSampleSeed ^= _allocationSampleSeed >> 12;
+	_allocationSampleSeed ^= _allocationSampleSeed << 25;
+	_allocationSampleSeed ^= _allocationSampleSeed >> 27;
+	uint64_t random = _allocationSampleSeed * 0x2545F4914F6CDD1DULL;
+	double uniform = ((double)(random >> 11) + 0.5) / (double)((uint64_t)1 << 53);
+
+	/* the draw is bounded by about 37 times the mean, well within range */
+	double threshold = -log(uniform) * mean;
+	return OMR_MAX((uintptr_t)threshold, (uintptr_t)1);
+}
+
+void
+MM_ObjectAllocationInterface::sampleAllocation(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, omrobjectptr_t object)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t size = allocateDescription->getBytesRequested();
+
+	if (0 == _allocationSampleThreshold) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		/* threads start from different points of the sequence so that they are not sampled in step */
+		_allocationSampleSeed ^= omrtime_hires_clock() * 0x9E3779B97F4A7C15ULL;
+		if (0 == _allocationSampleSeed) {
+			_allocationSampleSeed = 0x9E3779B97F4A7C15ULL;
+		}
+		_allocationSampleThreshold = nextAllocationSampleThreshold(env);
+	}
+
+	_bytesSinceAllocationSample += size;
+	if (_bytesSinceAllocationSample >= _allocationSampleThreshold) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		/* the sample stands for everything the thread allocated since the previous one */
+		uintptr_t sampledBytes = _bytesSinceAllocationSample;
+		_bytesSinceAllocationSample = 0;
+		_allocationSampleThreshold = nextAllocationSampleThreshold(env);
+
+		_stats._allocationSampleCount += 1;
+		_stats._allocationSampledBytes += sampledBytes;
+
+		TRIGGER_J9HOOK_MM_OMR_ALLOCATION_SAMPLE(
+			extensions->omrHookInterface,
+			env->getOmrVMThread(),
+			omrtime_hires_clock(),
+			object,
+			size,
+			MM_Math::floorLog2(size),
+			allocateDescription->getAllocationSite(),
+			sampledBytes);
+	}
+}
+
 /**
  * Purge any cached heap memory for object allocation from the interface.
  * For allocation interfaces that keep caches of heap memory from which to allocate (e.g., TLH), release
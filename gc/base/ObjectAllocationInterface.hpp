@@ -31,6 +31,7 @@
 
 #include "omrcfg.h"
 #include "modronbase.h"
+#include "objectdescription.h"
 #include "ModronAssertions.h"
 
 #include "BaseVirtual.hpp"
@@ -59,6 +60,9 @@ protected:
 	MM_EnvironmentBase *_owningEnv;  /**< The environment with which the receiver is associated */
 	MM_AllocationStats _stats; /**< Allocation statistics for this allocation interface. */
 	MM_FrequentObjectsStats* _frequentObjectsStats;
+	uintptr_t _bytesSinceAllocationSample; /**< Bytes allocated by the owning thread since its last allocation sample */
+	uintptr_t _allocationSampleThreshold; /**< Bytes to allocate before the next allocation sample (0 until the first threshold is drawn) */
+	uint64_t _allocationSampleSeed; /**< State of the random number generator that draws the sampling thresholds */
 
 public:
 
@@ -88,6 +92,9 @@ protected:
 		_owningEnv(env)
 		,_stats()
 		,_frequentObjectsStats(NULL)
+		,_bytesSinceAllocationSample(0)
+		,_allocationSampleThreshold(0)
+		,_allocationSampleSeed((uint64_t)(uintptr_t)this)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -125,6 +132,26 @@ public:
 	virtual void *allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */
 
+	/**
+	 * Draw the number of bytes to allocate before the next allocation sample from an exponential
+	 * distribution whose mean is GCExtensionsBase::allocationSamplingInterval, so that samples are
+	 * taken at the points of a Poisson process over allocated bytes. Unlike a fixed interval this
+	 * cannot lock step with a periodic allocation pattern, and every allocated byte is equally
+	 * likely to be sampled.
+	 */
+	uintptr_t nextAllocationSampleThreshold(MM_EnvironmentBase *env);
+
+	/**
+	 * Account for a successful allocation against the allocation sampling threshold
+	 * (see nextAllocationSampleThreshold()) and, once the threshold has been
+	 * crossed, record the sample in the allocation stats and report J9HOOK_MM_OMR_ALLOCATION_SAMPLE.
+	 * Only called when allocation sampling is enabled.
+	 *
+	 * @param allocateDescription the description of the completed allocation
+	 * @param object the allocated (and initialized) object
+	 */
+	void sampleAllocation(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, omrobjectptr_t object);
+
 	virtual void flushCache(MM_EnvironmentBase *env);
 	virtual void restartCache(MM_EnvironmentBase *env);
 	
@@ -26,6 +26,8 @@
  * @ingroup GC_Base
  */
 
+#include <math.h>
+
 #include "omrcfg.h"
 #include "omr.h"
 #include "ModronAssertions.h"
@@ -37,6 +39,7 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "Math.hpp"
 #include "Task.hpp"
 
 #include "ParallelDispatcher.hpp"
@@ -296,6 +299,12 @@ MM_ParallelDispatcher::initialize(MM_EnvironmentBase *env)
 	}
 	memset(_taskTable, 0, _threadCountMaximum * sizeof(MM_Task *));
 
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		_syncSpinMaximum = (_extensions->adaptiveSyncSpinMaximum * omrtime_hires_frequency()) / 1000000;
+		_syncSpinCPUCount = omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_TARGET);
+	}
+
 	return true;
 
 error_no_memory:
@@ -489,6 +498,49 @@ MM_ParallelDispatcher::recomputeActiveThreadCountForTask(MM_EnvironmentBase *env
  	return taskActiveThreadCount;
 }
 
+float
+MM_ParallelDispatcher::calculateIdealThreadCount(MM_GCExtensionsBase *extensions, uintptr_t threadCount, float percentStall)
+{
+	float sensitivityFactor = extensions->adaptiveThreadingSensitivityFactor;
+	float powerExponent = 1.0f / (sensitivityFactor + 1.0f);
+	float stallComponent = (1.0f / percentStall) - 1.0f;
+	float powerBase = (1.0f / sensitivityFactor) * stallComponent;
+
+	return threadCount * powf(powerBase, powerExponent);
+}
+
+void
+MM_ParallelDispatcher::recordAdaptivePhaseEfficiency(MM_EnvironmentBase *env, AdaptivePhase phase, uintptr_t threadCount, uint64_t phaseTime, uint64_t stallTime)
+{
+	if (!_extensions->adaptiveGlobalThreadingEnabled() || (0 == threadCount) || (0 == phaseTime)) {
+		return;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t avgStallTime = stallTime / threadCount;
+	float percentStall = ((float)avgStallTime) / ((float)phaseTime);
+	uintptr_t recommendedThreads = _threadCount;
+
+	/* A phase that never stalled may use every thread; one that stalled throughout gains nothing from more than one */
+	if (percentStall >= 1.0f) {
+		recommendedThreads = 1;
+	} else if (percentStall > 0.0f) {
+		float idealThreads = calculateIdealThreadCount(_extensions, threadCount, percentStall);
+		float adjustedAverage = MM_Math::weightedAverage((float)threadCount, idealThreads, _extensions->adaptiveThreadingWeightActiveThreads);
+		float boostedThreads = adjustedAverage + _extensions->adaptiveThreadBooster;
+		if (boostedThreads < (float)_threadCount) {
+			recommendedThreads = OMR_MAX((uintptr_t)boostedThreads, (uintptr_t)1);
+		}
+	}
+
+	Trc_MM_ParallelDispatcher_recordAdaptivePhaseEfficiency(env->getLanguageVMThread(), (uintptr_t)phase,
+		omrtime_hires_delta(0, phaseTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+		omrtime_hires_delta(0, avgStallTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+		(percentStall * 100), threadCount, recommendedThreads);
+
+	_adaptivePhaseThreads[phase] = recommendedThreads;
+}
+
 uintptr_t 
 MM_ParallelDispatcher::adjustThreadCount(uintptr_t maxThreadCount)
 {
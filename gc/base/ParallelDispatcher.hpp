@@ -45,6 +45,16 @@ class MM_ParallelDispatcher : public MM_BaseVirtual
 	/*
 	 * Data members
 	 */
+public:
+	/**
+	 * Collector phases whose thread count is adapted to their measured parallel efficiency.
+	 */
+	enum AdaptivePhase {
+		ADAPTIVE_PHASE_GLOBAL_MARK = 0,
+		ADAPTIVE_PHASE_GLOBAL_SWEEP,
+		ADAPTIVE_PHASE_COUNT
+	};
+
 private:
 protected:
 	MM_Task *_task;
@@ -79,6 +89,11 @@ protected:
 	uintptr_t _activeThreadCount; /**< number of threads actively running a task */
 	uintptr_t _threadsToReserve; /**< Indicates number of threads remaining to dispatch tasks upon notify. Must be exactly 0 after tasks are dispatched. */
 
+	uint64_t _syncArrivalSkew; /**< smoothed time, in hi-res ticks, from the first to the last thread arriving at a synchronization point (adaptive sync spin only) */
+	uint64_t _syncSpinMaximum; /**< upper bound, in hi-res ticks, of the spin phase of a synchronization point (adaptive sync spin only) */
+	uintptr_t _syncSpinCPUCount; /**< number of CPUs available to GC threads; synchronization points with more threads than this never spin */
+	uintptr_t _adaptivePhaseThreads[ADAPTIVE_PHASE_COUNT]; /**< thread count recommended for the next run of each adaptive phase, 0 until the phase has been measured */
+
 	omrsig_handler_fn _handler;
 	void* _handler_arg;
 	uintptr_t _defaultOSStackSize; /**< default OS stack size */
@@ -218,6 +233,67 @@ public:
 
 	virtual void run(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount = UDATA_MAX);
 
+	/**
+	 * Return how long a thread waiting at a synchronization point should spin before parking on the synchronize monitor.
+	 * This is the observed arrival skew of recent synchronization points, bounded by the spin maximum: threads that wait
+	 * less than the skew would have been woken right after parking anyway. Spinning only pays off when every participating
+	 * thread has a CPU of its own: otherwise the spinners delay the threads they are waiting for.
+	 * @param[in] threadCount number of threads participating in the synchronization point
+	 * @return spin time in hi-res ticks, 0 if adaptive sync spin is disabled or the threads outnumber the CPUs
+	 */
+	MMINLINE uint64_t
+	getSyncSpinTime(uintptr_t threadCount)
+	{
+		if (!_extensions->adaptiveSyncSpin || (threadCount > _syncSpinCPUCount)) {
+			return 0;
+		}
+		return OMR_MIN(_syncArrivalSkew, _syncSpinMaximum);
+	}
+
+	/**
+	 * Project the optimal thread count of a parallel phase from the share of its time the threads spent stalled.
+	 * This is the Adaptive Threading model, m = n * ((1/x) * (1/%stall - 1))^(1/(x+1)), where x is the stall
+	 * sensitivity factor (see MM_Scavenger::calculateRecommendedWorkingThreads for its derivation).
+	 * @param[in] threadCount number of threads n the phase ran with
+	 * @param[in] percentStall average stall time per thread as a fraction of the phase time, in (0, 1)
+	 * @return the ideal thread count, before weighting and boosting
+	 */
+	static float calculateIdealThreadCount(MM_GCExtensionsBase *extensions, uintptr_t threadCount, float percentStall);
+
+	/**
+	 * Fold the measured efficiency of a completed run of an adaptive phase into the thread count recommended for its next run.
+	 * @param[in] phase the phase that ran
+	 * @param[in] threadCount number of threads the phase ran with
+	 * @param[in] phaseTime elapsed time of the phase, in hi-res ticks
+	 * @param[in] stallTime stall time of the phase summed over all its threads, in hi-res ticks
+	 */
+	void recordAdaptivePhaseEfficiency(MM_EnvironmentBase *env, AdaptivePhase phase, uintptr_t threadCount, uint64_t phaseTime, uint64_t stallTime);
+
+	/**
+	 * Return the thread count to give the task of an adaptive phase.
+	 * @return recommended thread count, UDATA_MAX if adaptive global threading is disabled or the phase has not been measured yet
+	 */
+	MMINLINE uintptr_t
+	getAdaptivePhaseThreads(AdaptivePhase phase)
+	{
+		uintptr_t threads = _adaptivePhaseThreads[phase];
+		if (!_extensions->adaptiveGlobalThreadingEnabled() || (0 == threads)) {
+			threads = UDATA_MAX;
+		}
+		return threads;
+	}
+
+	/**
+	 * Fold the arrival skew of a completed synchronization point into the spin time estimate.
+	 * @param[in] skew time, in hi-res ticks, from the first to the last thread arriving
+	 */
+	MMINLINE void
+	recordSyncArrivalSkew(uint64_t skew)
+	{
+		/* callers hold the synchronize mutex */
+		_syncArrivalSkew = (_syncArrivalSkew + skew) / 2;
+	}
+
 	static MM_ParallelDispatcher *newInstance(MM_EnvironmentBase *env, omrsig_handler_fn handler, void* handler_arg, uintptr_t defaultOSStackSize);
 	virtual void kill(MM_EnvironmentBase *env);
 
@@ -238,6 +314,10 @@ public:
 		,_threadCount(1)
 		,_activeThreadCount(1)
 		,_threadsToReserve(0)		
+		,_syncArrivalSkew(0)
+		,_syncSpinMaximum(0)
+		,_syncSpinCPUCount(0)
+		,_adaptivePhaseThreads()
 		,_handler(handler)
 		,_handler_arg(handler_arg)
 		,_defaultOSStackSize(defaultOSStackSize)
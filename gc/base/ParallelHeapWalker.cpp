@@ -33,11 +33,15 @@
 #include "HeapRegionManager.hpp"
 #include "MarkMap.hpp"
 #include "MarkMapSegmentChunkIterator.hpp"
+#include "MemoryPool.hpp"
 #include "MemorySubSpace.hpp"
 #include "ParallelGlobalGC.hpp"
 #include "ParallelObjectHeapIterator.hpp"
+#include "ParallelSweepChunk.hpp"
+#include "ObjectHeapIteratorAddressOrderedList.hpp"
 #include "ObjectModel.hpp"
 #include "OMRVMInterface.hpp"
+#include "SweepHeapSectioning.hpp"
 
 /**
  * @todo Provide class documentation
@@ -114,6 +118,19 @@ MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalk
 	uintptr_t heapChunkFactor = 1;
 	if ((threadCount > 1) && _markMap->isMarkMapValid() && (!extensions->usingSATBBarrier())) {
 		heapChunkFactor = threadCount * 8;
+	} else if ((threadCount > 1) && (NULL != extensions->sweepHeapSectioning) && !extensions->isConcurrentSweepEnabled()) {
+		/* Without the mark map an object boundary can't be found in the middle of a region, so fall back
+		 * to the sweep chunks and start each one at a free entry. A concurrent sweep owns the chunks
+		 * between collections, so it is left with the single chunk walk.
+		 */
+		if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+			_sweepChunkCount = prepareSweepChunksForWalk(env);
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
+		if (0 != _sweepChunkCount) {
+			allObjectsDoSweepChunks(env, function, userData, walkFlags);
+			return;
+		}
 	}
 	uintptr_t parallelChunkSize = extensions->heap->getMemorySize() / heapChunkFactor;
 	parallelChunkSize = MM_Math::roundToCeiling(extensions->heapAlignment, parallelChunkSize);
@@ -141,6 +158,101 @@ MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalk
 	Trc_MM_ParallelHeapWalker_allObjectsDoParallel_Exit(env->getLanguageVMThread(), heapChunkFactor, parallelChunkSize, objectsWalked);
 }
 
+uintptr_t
+MM_ParallelHeapWalker::prepareSweepChunksForWalk(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_SweepHeapSectioning *sweepHeapSectioning = extensions->sweepHeapSectioning;
+
+	/* The heap may have been resized since the last sweep */
+	if (!sweepHeapSectioning->update(env)) {
+		return 0;
+	}
+	uintptr_t chunkCount = sweepHeapSectioning->reassignChunks(env);
+	if (0 == chunkCount) {
+		return 0;
+	}
+
+	MM_SweepHeapSectioningIterator sectioningIterator(sweepHeapSectioning);
+	MM_ParallelSweepChunk *firstChunk = sectioningIterator.nextChunk();
+	MM_ParallelSweepChunk *chunk = NULL;
+
+	/* The base of a region is always a parse point */
+	for (chunk = firstChunk; NULL != chunk; chunk = chunk->_next) {
+		chunk->_walkBase = chunk->_coalesceCandidate ? NULL : chunk->chunkBase;
+	}
+
+	/* Every free entry is a parse point. Chunks are address ordered, so each pool's free list is matched
+	 * against them with a single cursor that only moves back when a (split) list restarts at a lower address.
+	 */
+	MM_MemoryPool *previousPool = NULL;
+	for (chunk = firstChunk; NULL != chunk; chunk = chunk->_next) {
+		MM_MemoryPool *memoryPool = chunk->memoryPool;
+		if (memoryPool == previousPool) {
+			continue;
+		}
+		previousPool = memoryPool;
+
+		MM_ParallelSweepChunk *cursor = chunk;
+		void *freeEntry = memoryPool->getFirstFreeStartingAddr(env);
+		while (NULL != freeEntry) {
+			if (freeEntry < cursor->chunkBase) {
+				cursor = chunk;
+			}
+			while ((NULL != cursor->_next) && (freeEntry >= cursor->chunkTop)) {
+				cursor = cursor->_next;
+			}
+			if ((freeEntry >= cursor->chunkBase) && (freeEntry < cursor->chunkTop)) {
+				if ((NULL == cursor->_walkBase) || (freeEntry < cursor->_walkBase)) {
+					cursor->_walkBase = freeEntry;
+				}
+			}
+			freeEntry = memoryPool->getNextFreeStartingAddr(env, freeEntry);
+		}
+	}
+
+	/* Each parse point ends the walk of the one before it in the same region */
+	MM_ParallelSweepChunk *walkChunk = NULL;
+	MM_ParallelSweepChunk *previousChunk = NULL;
+	for (chunk = firstChunk; NULL != chunk; chunk = chunk->_next) {
+		if (NULL != chunk->_walkBase) {
+			if (NULL != walkChunk) {
+				walkChunk->_walkTop = chunk->_coalesceCandidate ? chunk->_walkBase : previousChunk->chunkTop;
+			}
+			walkChunk = chunk;
+		}
+		previousChunk = chunk;
+	}
+	walkChunk->_walkTop = previousChunk->chunkTop;
+
+	return chunkCount;
+}
+
+void
+MM_ParallelHeapWalker::allObjectsDoSweepChunks(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_HeapRegionManager *regionManager = extensions->heap->getHeapRegionManager();
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+	uintptr_t objectsWalked = 0;
+
+	MM_SweepHeapSectioningIterator sectioningIterator(extensions->sweepHeapSectioning);
+	for (MM_ParallelSweepChunk *chunk = sectioningIterator.nextChunk(); NULL != chunk; chunk = chunk->_next) {
+		if ((NULL != chunk->_walkBase) && J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			MM_HeapRegionDescriptor *region = regionManager->regionDescriptorForAddress(chunk->_walkBase);
+			if (walkFlags == (region->getTypeFlags() & walkFlags)) {
+				GC_ObjectHeapIteratorAddressOrderedList objectHeapIterator(extensions, (omrobjectptr_t)chunk->_walkBase, (omrobjectptr_t)chunk->_walkTop, false);
+				omrobjectptr_t object = NULL;
+				while (NULL != (object = objectHeapIterator.nextObject())) {
+					function(omrVMThread, region, object, userData);
+					objectsWalked += 1;
+				}
+			}
+		}
+	}
+	Trc_MM_ParallelHeapWalker_allObjectsDoParallel_SweepChunks_Exit(env->getLanguageVMThread(), _sweepChunkCount, objectsWalked);
+}
+
 /**
  * Walk through all live objects of the heap and apply the provided function.
  * If parallel is set to true, task is dispatched to GC threads and walks the heap segments in parallel,
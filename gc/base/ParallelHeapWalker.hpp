@@ -40,6 +40,7 @@ class MM_ParallelHeapWalker : public MM_HeapWalker
 private:
 	MM_MarkMap *_markMap;
 	MM_ParallelGlobalGC *_globalCollector;
+	uintptr_t _sweepChunkCount; /**< number of sweep chunks prepared by the main thread for the current walk */
 protected:
 public:
 	
@@ -47,6 +48,19 @@ public:
 	 * Function members
 	 */
 private:
+	/**
+	 * Assign the sweep chunks to the current heap and find a parse point for each of them.
+	 * The first chunk of a region is parsed from its base; any other chunk is parsed from the lowest
+	 * free entry its memory pool has in the chunk, and chunks without one are covered by the walk of the
+	 * chunk before them. Called by the main thread only.
+	 * @return the number of chunks assigned, 0 if the heap could not be sectioned
+	 */
+	uintptr_t prepareSweepChunksForWalk(MM_EnvironmentBase *env);
+
+	/**
+	 * Walk through all objects of the heap in parallel, one prepared sweep chunk per work unit.
+	 */
+	void allObjectsDoSweepChunks(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags);
 protected:
 public:	
 	/**
@@ -77,6 +91,7 @@ public:
 		: MM_HeapWalker()
 		, _markMap(markMap)
 		, _globalCollector(globalCollector)
+		, _sweepChunkCount(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -55,6 +55,7 @@ private:
 	const bool _initMarkMap;
 	MM_CycleState *_cycleState;  /**< Collection cycle state active for the task */
 	const MarkAction _action;
+	uintptr_t _recommendedThreads; /**< Collector recommended threads for the task */
 	
 public:
 	virtual uintptr_t getVMStateID();
@@ -69,6 +70,8 @@ public:
 	virtual bool synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *env, const char *id);
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
+	virtual uintptr_t getRecommendedWorkingThreads() { return _recommendedThreads; }
+
 	/**
 	 * Create a ParallelMarkTask object.
 	 */
@@ -77,12 +80,14 @@ public:
 			MM_MarkingScheme *markingScheme, 
 			bool initMarkMap,
 			MM_CycleState *cycleState,
-			MarkAction action = MARK_ALL) :
+			MarkAction action = MARK_ALL,
+			uintptr_t recommendedThreads = UDATA_MAX) :
 		MM_ParallelTask(env, dispatcher)
 		,_markingScheme(markingScheme)
 		,_initMarkMap(initMarkMap)
 		,_cycleState(cycleState)
 		,_action(action)
+		,_recommendedThreads(recommendedThreads)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -86,6 +86,10 @@ public:
 
 	uintptr_t _minFreeSize;
 
+	/* Parallel Heap Walk Data */
+	void *_walkBase; /**< first object or hole in the chunk the heap walker can parse from, NULL if none is known */
+	void *_walkTop; /**< end of the range walked from _walkBase (the next chunk's _walkBase, or the end of the region) */
+
 	/**
 	 * clear the Chunk object.
 	 */	
@@ -160,7 +164,9 @@ public:
 		_splitCandidatePreviousEntry(NULL),
 		_accumulatedFreeSize(0),
 		_accumulatedFreeHoles(0),
-		_minFreeSize(0)
+		_minFreeSize(0),
+		_walkBase(NULL),
+		_walkTop(NULL)
 	{
 		_typeId = __FUNCTION__;
 	};
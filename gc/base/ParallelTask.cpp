@@ -90,6 +90,7 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 		}
 
 		_synchronizeCount += 1;
+		recordSynchronizeArrival(env);
 
 		if(_synchronizeCount == _threadCount) {
 			_synchronizeCount = 0;
@@ -98,9 +99,10 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 		} else {
 			volatile uintptr_t index = _synchronizeIndex;
 
-			do {
+			spinForSynchronizeRelease(env, index, false);
+			while(index == _synchronizeIndex) {
 				omrthread_monitor_wait(_synchronizeMutex);
-			} while(index == _synchronizeIndex);
+			}
 		}
 		omrthread_monitor_exit(_synchronizeMutex);
 
@@ -134,6 +136,7 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, con
 		}
 
 		_synchronizeCount += 1;
+		recordSynchronizeArrival(env);
 		if(_synchronizeCount == _threadCount) {
 			if(env->isMainThread()) {
 				omrthread_monitor_exit(_synchronizeMutex);
@@ -142,6 +145,8 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, con
 				goto done;
 			}
 			omrthread_monitor_notify_all(_synchronizeMutex);
+		} else {
+			spinForSynchronizeRelease(env, index, env->isMainThread());
 		}
 
 		while(index == _synchronizeIndex) {
@@ -190,6 +195,7 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *
 		}
 
 		_synchronizeCount += 1;
+		recordSynchronizeArrival(env);
 		if(_synchronizeCount == _threadCount) {
 			omrthread_monitor_exit(_synchronizeMutex);
 			isReleasedThread = true;
@@ -197,9 +203,10 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *
 			goto done;
 		}
 
-		do {
+		spinForSynchronizeRelease(env, index, false);
+		while(index == _synchronizeIndex) {
 			omrthread_monitor_wait(_synchronizeMutex);
-		} while(index == _synchronizeIndex);
+		}
 		omrthread_monitor_exit(_synchronizeMutex);
 	} else {
 		_synchronized = true;
@@ -211,6 +218,38 @@ done:
 	return isReleasedThread;
 }
 
+void
+MM_ParallelTask::recordSynchronizeArrival(MM_EnvironmentBase *env)
+{
+	if (env->getExtensions()->adaptiveSyncSpin) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		if (1 == _synchronizeCount) {
+			_syncFirstArrivalTime = omrtime_hires_clock();
+		} else if (_synchronizeCount == _threadCount) {
+			_dispatcher->recordSyncArrivalSkew(omrtime_hires_clock() - _syncFirstArrivalTime);
+		}
+	}
+}
+
+void
+MM_ParallelTask::spinForSynchronizeRelease(MM_EnvironmentBase *env, uintptr_t index, bool releaseMain)
+{
+	uint64_t spinTime = _dispatcher->getSyncSpinTime(_threadCount);
+
+	if (0 != spinTime) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		omrthread_monitor_exit(_synchronizeMutex);
+		uint64_t spinStart = omrtime_hires_clock();
+		while ((index == _synchronizeIndex) && !(releaseMain && (_synchronizeCount == _threadCount))) {
+			if ((omrtime_hires_clock() - spinStart) > spinTime) {
+				break;
+			}
+			MM_AtomicOperations::yieldCPU();
+		}
+		omrthread_monitor_enter(_synchronizeMutex);
+	}
+}
+
 void
 MM_ParallelTask::releaseSynchronizedGCThreads(MM_EnvironmentBase *env)
 {
@@ -62,11 +62,28 @@ protected:
 	volatile uintptr_t _synchronizeIndex;
 	volatile uintptr_t _synchronizeCount;
 	omrthread_monitor_t _synchronizeMutex;
+	uint64_t _syncFirstArrivalTime; /**< Timestamp of the first thread arriving at the current synchronization point (adaptive sync spin only) */
 public:
 	
 	/*
 	 * Function members
 	 */
+private:
+	/**
+	 * Time the first and last arrivals at a synchronization point to feed the dispatcher's spin time estimate.
+	 * Called with the synchronize mutex held, after the arriving thread is counted.
+	 */
+	void recordSynchronizeArrival(MM_EnvironmentBase *env);
+
+	/**
+	 * Bounded spin phase of a synchronization point wait. Called with the synchronize mutex held, releases it while
+	 * spinning and reacquires it before returning, so the caller parks on the monitor only if still not released.
+	 * @param[in] index the synchronize index observed on arrival
+	 * @param[in] releaseMain true if the caller is the main thread of a synchronize-and-release-main point, which
+	 * also stops spinning once all threads have arrived
+	 */
+	void spinForSynchronizeRelease(MM_EnvironmentBase *env, uintptr_t index, bool releaseMain);
+
 public:
 	virtual bool handleNextWorkUnit(MM_EnvironmentBase *env);
 	virtual void synchronizeGCThreads(MM_EnvironmentBase *env, const char *id);
@@ -107,6 +124,7 @@ public:
 		,_synchronizeIndex(0)
 		,_synchronizeCount(0)
 		,_synchronizeMutex(NULL)
+		,_syncFirstArrivalTime(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -189,7 +189,13 @@ MM_PhysicalArenaVirtualMemory::attachSubArena(MM_EnvironmentBase* env, MM_Physic
 #endif /* OMR_GC_MODRON_SCAVENGER */
 
 	/* Commit the subarena memory into existence */
-	return _heap->commitMemory(candidateBase, size);
+	currentSubArena->adviseHugePages(env, candidateBase, size);
+	if (!_heap->commitMemory(candidateBase, size)) {
+		return false;
+	}
+	currentSubArena->collapseHugePages(env, candidateBase, size);
+
+	return true;
 }
 
 /**
@@ -23,7 +23,12 @@
 
 #include "PhysicalSubArenaVirtualMemory.hpp"
 
-class MM_EnvironmentBase;
+#include "omrport.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "MemorySubSpace.hpp"
 
 bool
 MM_PhysicalSubArenaVirtualMemory::initialize(MM_EnvironmentBase* env)
@@ -52,3 +57,23 @@ MM_PhysicalSubArenaVirtualMemory::findAdjacentHighValidAddress(MM_EnvironmentBas
 	/* There is - return its lowest address */
 	return _highArena->getLowAddress();
 }
+
+void
+MM_PhysicalSubArenaVirtualMemory::adviseHugePages(MM_EnvironmentBase* env, void* address, uintptr_t size)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	if (extensions->hugePageAdvise) {
+		/* advice sticks to the reserved range, so it holds across later decommit and recommit */
+		bool useHugePages = (0 != (_subSpace->getTypeFlags() & extensions->hugePageMemoryTypes));
+		_heap->adviseHugePages(address, size, useHugePages ? OMRPORT_VMEM_HUGE_PAGE_ADVICE_ENABLE : OMRPORT_VMEM_HUGE_PAGE_ADVICE_DISABLE);
+	}
+}
+
+void
+MM_PhysicalSubArenaVirtualMemory::collapseHugePages(MM_EnvironmentBase* env, void* address, uintptr_t size)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	if (extensions->hugePageAdvise && extensions->hugePageCollapse && (0 != (_subSpace->getTypeFlags() & extensions->hugePageMemoryTypes))) {
+		_heap->adviseHugePages(address, size, OMRPORT_VMEM_HUGE_PAGE_ADVICE_COLLAPSE);
+	}
+}
@@ -82,6 +82,21 @@ public:
 	}
 
 	void* findAdjacentHighValidAddress(MM_EnvironmentBase* env);
+
+	/**
+	 * Advise for or against transparent huge page backing of a range about to be committed to this sub arena,
+	 * depending on whether the sub arena's memory type was selected by -Xgc:hugePageAdvise=.
+	 * @param address The base address of the range.
+	 * @param size The size of the range.
+	 */
+	void adviseHugePages(MM_EnvironmentBase* env, void* address, uintptr_t size);
+
+	/**
+	 * Collapse a range just committed to this sub arena into huge pages if requested by -Xgc:hugePageCollapse.
+	 * @param address The base address of the range.
+	 * @param size The size of the range.
+	 */
+	void collapseHugePages(MM_EnvironmentBase* env, void* address, uintptr_t size);
 	
 	MMINLINE uintptr_t getNumaNode() { return _numaNode; }
 	MMINLINE void setNumaNode(uintptr_t numaNode) { _numaNode = numaNode; }
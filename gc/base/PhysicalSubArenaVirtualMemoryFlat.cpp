@@ -204,9 +204,11 @@ MM_PhysicalSubArenaVirtualMemoryFlat::expandNoCheck(MM_EnvironmentBase *env, uin
 	void *highExpandAddress = (void *)(((uintptr_t)_highAddress) + expandSize);
 
 	/* Get the heap memory */
+	adviseHugePages(env, lowExpandAddress, expandSize);
 	if(!_heap->commitMemory(lowExpandAddress, expandSize)) {
 		return 0;
 	}
+	collapseHugePages(env, lowExpandAddress, expandSize);
 
 	if (_highAddress != highExpandAddress) {
 		/* the area has been expanded.  Update internal values */
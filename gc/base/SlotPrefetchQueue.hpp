@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(SLOTPREFETCHQUEUE_HPP_)
+#define SLOTPREFETCHQUEUE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#include "SlotObject.hpp"
+
+/**
+ * Upper bound on the prefetch distance (and size of the queue storage), in slots.
+ */
+#define OMR_GC_SLOT_PREFETCH_DEPTH_MAX 16
+
+/**
+ * Small bounded FIFO of object slots used to overlap cache misses while scanning an object.
+ * The scanning loop prefetches the target of every slot as it is read from the object scanner
+ * and only processes it (copy/forward, mark) once the queue holds _depth newer slots, so the
+ * miss on the target has had a few iterations to complete. Slot targets are re-read when
+ * the slot is processed, so a prefetched value going stale is harmless.
+ * Instances are intended to live on the stack of the scanning thread.
+ * @ingroup GC_Base
+ */
+class MM_SlotPrefetchQueue
+{
+/* Data members */
+private:
+	volatile fomrobject_t *_slots[OMR_GC_SLOT_PREFETCH_DEPTH_MAX]; /**< circular slot address storage */
+	bool _isLeaf[OMR_GC_SLOT_PREFETCH_DEPTH_MAX]; /**< leaf hint recorded with each slot */
+	uintptr_t _depth; /**< number of slots held before the oldest is handed back */
+	uintptr_t _head; /**< index of the oldest queued slot */
+	uintptr_t _count; /**< number of queued slots */
+
+/* Methods */
+public:
+	/**
+	 * Issue a prefetch (in anticipation of a write) for the given address. NULL is ignored.
+	 */
+	MMINLINE static void
+	prefetch(void *address)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		if (NULL != address) {
+			__builtin_prefetch(address, 1, 3);
+		}
+#endif /* defined(__GNUC__) || defined(__clang__) */
+	}
+
+	MMINLINE bool isEmpty() const { return 0 == _count; }
+	MMINLINE bool isFull() const { return _depth == _count; }
+
+	/**
+	 * Append a slot. The queue must not be full.
+	 * @param[in] slotObject the slot to queue (only its address is recorded)
+	 * @param[in] isLeaf leaf hint to hand back with the slot
+	 */
+	MMINLINE void
+	push(GC_SlotObject *slotObject, bool isLeaf)
+	{
+		uintptr_t tail = (_head + _count) % OMR_GC_SLOT_PREFETCH_DEPTH_MAX;
+		_slots[tail] = slotObject->readAddressFromSlot();
+		_isLeaf[tail] = isLeaf;
+		_count += 1;
+	}
+
+	/**
+	 * Remove the oldest slot.
+	 * @param[out] slotObject receives the address of the oldest slot
+	 * @param[out] isLeaf receives the leaf hint recorded with the slot
+	 * @return false if the queue was empty
+	 */
+	MMINLINE bool
+	pop(GC_SlotObject *slotObject, bool *isLeaf)
+	{
+		bool result = false;
+		if (0 != _count) {
+			slotObject->writeAddressToSlot((fomrobject_t *)_slots[_head]);
+			*isLeaf = _isLeaf[_head];
+			_head = (_head + 1) % OMR_GC_SLOT_PREFETCH_DEPTH_MAX;
+			_count -= 1;
+			result = true;
+		}
+		return result;
+	}
+
+	/**
+	 * @param[in] depth prefetch distance in slots, clamped to [1, OMR_GC_SLOT_PREFETCH_DEPTH_MAX]
+	 */
+	MM_SlotPrefetchQueue(uintptr_t depth)
+		: _depth(OMR_MAX((uintptr_t)1, OMR_MIN(depth, (uintptr_t)OMR_GC_SLOT_PREFETCH_DEPTH_MAX)))
+		, _head(0)
+		, _count(0)
+	{
+	}
+};
+
+#endif /* SLOTPREFETCHQUEUE_HPP_ */
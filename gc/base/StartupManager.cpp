@@ -37,6 +37,8 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #define OMR_XCOMPACTGC "-Xcompactgc"
 #define OMR_XCOMPACTGC_LENGTH 11
+#define OMR_XGCCOMPACTSUMMARYTABLE "-Xgc:compactSummaryTable"
+#define OMR_XGCCOMPACTSUMMARYTABLE_LENGTH 24
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #define OMR_XGCPOLICY "-Xgcpolicy:"
@@ -48,8 +50,60 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCASYNCLOGGINGBUFFERSIZE "-Xgc:asyncLoggingBufferSize="
+#define OMR_XGCASYNCLOGGINGBUFFERSIZE_LENGTH 28
+#define OMR_XGCASYNCLOGGINGBINARY "-Xgc:asyncLoggingBinary"
+#define OMR_XGCASYNCLOGGINGBINARY_LENGTH 23
+#define OMR_XGCASYNCLOGGING "-Xgc:asyncLogging"
+#define OMR_XGCASYNCLOGGING_LENGTH 17
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+#define OMR_XGCCONCURRENTSWEEP "-Xgc:concurrentSweep"
+#define OMR_XGCCONCURRENTSWEEP_LENGTH 20
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+#define OMR_XGCHUGEPAGEADVISE "-Xgc:hugePageAdvise="
+#define OMR_XGCHUGEPAGEADVISE_LENGTH 20
+#define OMR_XGCHUGEPAGECOLLAPSE "-Xgc:hugePageCollapse"
+#define OMR_XGCHUGEPAGECOLLAPSE_LENGTH 21
+#define OMR_XGCHUGEPAGEALIGNMENT "-Xgc:hugePageAlignment="
+#define OMR_XGCHUGEPAGEALIGNMENT_LENGTH 23
+#define OMR_XGCALLOCATIONSAMPLINGINTERVAL "-Xgc:allocationSamplingInterval="
+#define OMR_XGCALLOCATIONSAMPLINGINTERVAL_LENGTH 32
+#define OMR_XGCALLOCATIONPROFILEFILE "-Xgc:allocationProfileFile="
+#define OMR_XGCALLOCATIONPROFILEFILE_LENGTH 27
+#define OMR_XGCMARKINGWORKSTEALINGDEQUESIZE "-Xgc:markingWorkStealingDequeSize="
+#define OMR_XGCMARKINGWORKSTEALINGDEQUESIZE_LENGTH 34
+#define OMR_XGCMARKINGWORKSTEALING "-Xgc:markingWorkStealing"
+#define OMR_XGCMARKINGWORKSTEALING_LENGTH 24
+#define OMR_XGCADAPTIVESYNCSPINMAXIMUM "-Xgc:adaptiveSyncSpinMaximum="
+#define OMR_XGCADAPTIVESYNCSPINMAXIMUM_LENGTH 29
+#define OMR_XGCADAPTIVESYNCSPIN "-Xgc:adaptiveSyncSpin"
+#define OMR_XGCADAPTIVESYNCSPIN_LENGTH 21
+#define OMR_XGCADAPTIVEGLOBALGCTHREADING "-Xgc:adaptiveGlobalGCThreading"
+#define OMR_XGCADAPTIVEGLOBALGCTHREADING_LENGTH 30
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#define OMR_XGCSCAVENGERNUMAAWARE "-Xgc:scavengerNUMAAware"
+#define OMR_XGCSCAVENGERNUMAAWARE_LENGTH 23
+#define OMR_XGCSCAVENGERNUMACOPYCHUNKSIZE "-Xgc:scavengerNUMACopyChunkSize="
+#define OMR_XGCSCAVENGERNUMACOPYCHUNKSIZE_LENGTH 32
+#define OMR_XGCADAPTIVESCANCACHESIZING "-Xgc:adaptiveScanCacheSizing"
+#define OMR_XGCADAPTIVESCANCACHESIZING_LENGTH 28
+#define OMR_XGCSCAVENGERPRETENURING "-Xgc:scavengerPretenuring"
+#define OMR_XGCSCAVENGERPRETENURING_LENGTH 25
+#define OMR_XGCSCAVENGERPRETENURETHRESHOLD "-Xgc:scavengerPretenureThreshold="
+#define OMR_XGCSCAVENGERPRETENURETHRESHOLD_LENGTH 33
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#define OMR_XGCSLOTPREFETCHDEPTH "-Xgc:slotPrefetchDepth="
+#define OMR_XGCSLOTPREFETCHDEPTH_LENGTH 23
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#define OMR_XGCSEGREGATEDGENERATIONAL "-Xgc:segregatedGenerational"
+#define OMR_XGCSEGREGATEDGENERATIONAL_LENGTH 27
+#define OMR_XGCSEGREGATEDNURSERYCOLLECTIONS "-Xgc:segregatedNurseryCollections="
+#define OMR_XGCSEGREGATEDNURSERYCOLLECTIONS_LENGTH 34
+#define OMR_XGCSEGREGATEDNURSERYSIZE "-Xgc:segregatedNurserySize="
+#define OMR_XGCSEGREGATEDNURSERYSIZE_LENGTH 27
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 uintptr_t
 MM_StartupManager::getUDATAValue(char *option, uintptr_t *outputValue)
@@ -264,6 +318,9 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		extensions->nocompactOnSystemGC = 0;
 		extensions->compactOnSystemGC = 0;
 	}
+	else if (0 == strncmp(option, OMR_XGCCOMPACTSUMMARYTABLE, OMR_XGCCOMPACTSUMMARYTABLE_LENGTH)) {
+		extensions->compactUseSummaryTable = true;
+	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 	else if (0 == strncmp(option, OMR_XVERBOSEGCLOG, OMR_XVERBOSEGCLOG_LENGTH)) {
 		verboseFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XVERBOSEGCLOG_LENGTH)+1, OMRMEM_CATEGORY_MM);
@@ -276,6 +333,18 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCASYNCLOGGINGBUFFERSIZE, OMR_XGCASYNCLOGGINGBUFFERSIZE_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCASYNCLOGGINGBUFFERSIZE_LENGTH, &extensions->asyncLoggingBufferSize)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCASYNCLOGGINGBINARY, OMR_XGCASYNCLOGGINGBINARY_LENGTH)) {
+		extensions->asyncLogging = true;
+		extensions->asyncLoggingBinary = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCASYNCLOGGING, OMR_XGCASYNCLOGGING_LENGTH)) {
+		extensions->asyncLogging = true;
+	}
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
@@ -295,6 +364,97 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 			extensions->gcThreadCount = forcedThreadCount;
 			extensions->gcThreadCountForced = true;
 		}
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	} else if (0 == strncmp(option, OMR_XGCCONCURRENTSWEEP, OMR_XGCCONCURRENTSWEEP_LENGTH)) {
+		extensions->concurrentSweep = true;
+		extensions->payAllocationTax = true;
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+	} else if (0 == strncmp(option, OMR_XGCHUGEPAGEADVISE, OMR_XGCHUGEPAGEADVISE_LENGTH)) {
+		char *memoryTypes = option + OMR_XGCHUGEPAGEADVISE_LENGTH;
+		extensions->hugePageAdvise = true;
+		if (0 == strcmp(memoryTypes, "all")) {
+			extensions->hugePageMemoryTypes = MEMORY_TYPE_NEW | MEMORY_TYPE_OLD;
+		} else if (0 == strcmp(memoryTypes, "nursery")) {
+			extensions->hugePageMemoryTypes = MEMORY_TYPE_NEW;
+		} else if (0 == strcmp(memoryTypes, "tenure")) {
+			extensions->hugePageMemoryTypes = MEMORY_TYPE_OLD;
+		} else if (0 == strcmp(memoryTypes, "none")) {
+			extensions->hugePageMemoryTypes = 0;
+		} else {
+			result = false;
+		}
+	} else if (0 == strncmp(option, OMR_XGCHUGEPAGECOLLAPSE, OMR_XGCHUGEPAGECOLLAPSE_LENGTH)) {
+		extensions->hugePageCollapse = true;
+	} else if (0 == strncmp(option, OMR_XGCHUGEPAGEALIGNMENT, OMR_XGCHUGEPAGEALIGNMENT_LENGTH)) {
+		uintptr_t alignment = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCHUGEPAGEALIGNMENT_LENGTH, &alignment) || (0 == alignment) || (0 != (alignment & (alignment - 1)))) {
+			result = false;
+		} else {
+			extensions->hugePageAlignment = alignment;
+		}
+	} else if (0 == strncmp(option, OMR_XGCALLOCATIONSAMPLINGINTERVAL, OMR_XGCALLOCATIONSAMPLINGINTERVAL_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCALLOCATIONSAMPLINGINTERVAL_LENGTH, &extensions->allocationSamplingInterval)) {
+			result = false;
+		}
+	} else if (0 == strncmp(option, OMR_XGCALLOCATIONPROFILEFILE, OMR_XGCALLOCATIONPROFILEFILE_LENGTH)) {
+		allocationProfileFileName = (char *) omrmem_allocate_memory(strlen(option + OMR_XGCALLOCATIONPROFILEFILE_LENGTH) + 1, OMRMEM_CATEGORY_MM);
+		if (NULL == allocationProfileFileName) {
+			result = false;
+		} else {
+			strcpy(allocationProfileFileName, option + OMR_XGCALLOCATIONPROFILEFILE_LENGTH);
+		}
+	} else if (0 == strncmp(option, OMR_XGCMARKINGWORKSTEALINGDEQUESIZE, OMR_XGCMARKINGWORKSTEALINGDEQUESIZE_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCMARKINGWORKSTEALINGDEQUESIZE_LENGTH, &extensions->markingWorkStealingDequeSize))
+			|| (0 == extensions->markingWorkStealingDequeSize)
+		) {
+			result = false;
+		}
+	} else if (0 == strncmp(option, OMR_XGCMARKINGWORKSTEALING, OMR_XGCMARKINGWORKSTEALING_LENGTH)) {
+		extensions->markingWorkStealing = true;
+	} else if (0 == strncmp(option, OMR_XGCADAPTIVESYNCSPINMAXIMUM, OMR_XGCADAPTIVESYNCSPINMAXIMUM_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCADAPTIVESYNCSPINMAXIMUM_LENGTH, &extensions->adaptiveSyncSpinMaximum)) {
+			result = false;
+		}
+	} else if (0 == strncmp(option, OMR_XGCADAPTIVESYNCSPIN, OMR_XGCADAPTIVESYNCSPIN_LENGTH)) {
+		extensions->adaptiveSyncSpin = true;
+	} else if (0 == strncmp(option, OMR_XGCADAPTIVEGLOBALGCTHREADING, OMR_XGCADAPTIVEGLOBALGCTHREADING_LENGTH)) {
+		extensions->adaptiveGlobalGCThreading = true;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	} else if (0 == strncmp(option, OMR_XGCSCAVENGERNUMAAWARE, OMR_XGCSCAVENGERNUMAAWARE_LENGTH)) {
+		extensions->scavengerNUMAAware = true;
+	} else if (0 == strncmp(option, OMR_XGCSCAVENGERNUMACOPYCHUNKSIZE, OMR_XGCSCAVENGERNUMACOPYCHUNKSIZE_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCSCAVENGERNUMACOPYCHUNKSIZE_LENGTH, &extensions->scavengerNUMACopyChunkSize)
+			|| (0 == extensions->scavengerNUMACopyChunkSize)
+		) {
+			result = false;
+		}
+	} else if (0 == strncmp(option, OMR_XGCADAPTIVESCANCACHESIZING, OMR_XGCADAPTIVESCANCACHESIZING_LENGTH)) {
+		extensions->adaptiveScanCacheSizing = true;
+	} else if (0 == strncmp(option, OMR_XGCSCAVENGERPRETENURETHRESHOLD, OMR_XGCSCAVENGERPRETENURETHRESHOLD_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCSCAVENGERPRETENURETHRESHOLD_LENGTH, &extensions->scavengerPretenureThreshold))
+			|| (0 == extensions->scavengerPretenureThreshold) || (100 < extensions->scavengerPretenureThreshold)
+		) {
+			result = false;
+		}
+	} else if (0 == strncmp(option, OMR_XGCSCAVENGERPRETENURING, OMR_XGCSCAVENGERPRETENURING_LENGTH)) {
+		extensions->scavengerPretenuring = true;
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	} else if (0 == strncmp(option, OMR_XGCSLOTPREFETCHDEPTH, OMR_XGCSLOTPREFETCHDEPTH_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCSLOTPREFETCHDEPTH_LENGTH, &extensions->slotPrefetchDepth)) {
+			result = false;
+		}
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	} else if (0 == strncmp(option, OMR_XGCSEGREGATEDGENERATIONAL, OMR_XGCSEGREGATEDGENERATIONAL_LENGTH)) {
+		extensions->segregatedGenerational = true;
+	} else if (0 == strncmp(option, OMR_XGCSEGREGATEDNURSERYCOLLECTIONS, OMR_XGCSEGREGATEDNURSERYCOLLECTIONS_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCSEGREGATEDNURSERYCOLLECTIONS_LENGTH, &extensions->segregatedNurseryCollections)) {
+			result = false;
+		}
+	} else if (0 == strncmp(option, OMR_XGCSEGREGATEDNURSERYSIZE, OMR_XGCSEGREGATEDNURSERYSIZE_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCSEGREGATEDNURSERYSIZE_LENGTH, &extensions->segregatedNurserySize)) {
+			result = false;
+		}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 	} else {
 		/* unknown option */
 		result = false;
@@ -311,6 +471,10 @@ MM_StartupManager::tearDown(void)
 		omrmem_free_memory(verboseFileName);
 		verboseFileName = NULL;
 	}
+	if (NULL != allocationProfileFileName) {
+		omrmem_free_memory(allocationProfileFileName);
+		allocationProfileFileName = NULL;
+	}
 }
 
 bool
@@ -43,6 +43,7 @@ class MM_StartupManager
 	 */
 private:
 	char *verboseFileName;
+	char *allocationProfileFileName; /**< file the allocation profile is written to at shutdown (-Xgc:allocationProfileFile=) */
 
 protected:
 	OMR_VM *omrVM;
@@ -81,11 +82,13 @@ public:
 
 	bool isVerboseEnabled(void);
 	char * getVerboseFileName(void);
+	char * getAllocationProfileFileName(void) { return allocationProfileFileName; }
 
 	virtual ~MM_StartupManager() { tearDown(); }
 
 	MM_StartupManager(OMR_VM *omrVM, uintptr_t defaultMinHeapSize, uintptr_t defaultMaxHeapSize)
 		: verboseFileName(NULL)
+		, allocationProfileFileName(NULL)
 		, omrVM(omrVM)
 		, defaultMinHeapSize(defaultMinHeapSize)
 		, defaultMaxHeapSize(defaultMaxHeapSize)
@@ -42,3 +42,9 @@ MM_SweepPoolManagerAddressOrderedList::newInstance(MM_EnvironmentBase *env)
 
 	return sweepPoolManager;
 }
+
+void
+MM_SweepPoolManagerAddressOrderedList::poolPostProcess(MM_EnvironmentBase *envModron, MM_MemoryPool *memoryPool)
+{
+	memoryPool->postProcess(envModron, MM_MemoryPool::forSweep);
+}
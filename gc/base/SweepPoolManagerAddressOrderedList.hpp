@@ -48,6 +48,8 @@ public:
 
 	static MM_SweepPoolManagerAddressOrderedList *newInstance(MM_EnvironmentBase *env);
 
+	virtual void poolPostProcess(MM_EnvironmentBase *envModron, MM_MemoryPool *memoryPool);
+
 	/**
 	 * Create a SweepPoolManager object.
 	 */
@@ -41,9 +41,15 @@
 #include "FrequentObjectsStats.hpp"
 #include "GCExtensionsBase.hpp"
 #include "GlobalCollector.hpp"
+#include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 
+/* Objects larger than this fraction of the pretenure cache size are allocated in tenure space directly, so that a
+ * refresh never discards most of a cache for one object.
+ */
+#define PRETENURE_CACHE_LARGE_OBJECT_FRACTION 8
+
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 /**
  * Create and return a new instance of MM_TLHAllocationInterface.
@@ -126,6 +132,10 @@ MM_TLHAllocationInterface::kill(MM_EnvironmentBase *env)
 #if defined(OMR_GC_NON_ZERO_TLH)
 	_tlhAllocationSupportNonZero.reconnect(env);
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	clearPretenureCache(env);
+#endif /* OMR_GC_MODRON_SCAVENGER */
 };
 
 
@@ -180,7 +190,15 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 			result = subspace->allocateObject(env, allocDescription, NULL, NULL, shouldCollectOnFailure);
 		}
 	} else {
-		result = allocateFromTLH(env, allocDescription, shouldCollectOnFailure);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		if (extensions->scavengerPretenuring && (memorySpace->getTenureMemorySubSpace() != memorySpace->getDefaultMemorySubSpace())) {
+			result = allocatePretenured(env, allocDescription, memorySpace);
+		}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
+		if (NULL == result) {
+			result = allocateFromTLH(env, allocDescription, shouldCollectOnFailure);
+		}
 
 		if (NULL == result) {
 			if (NULL != ac) {
@@ -209,6 +227,101 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 	return result;
 }
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+void *
+MM_TLHAllocationInterface::allocatePretenured(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySpace *memorySpace)
+{
+	void *result = NULL;
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t sizeClass = MM_AllocationStats::sizeClassForBytes(allocDescription->getBytesRequested());
+
+	if (0 != (extensions->scavengerPretenureSizeClassMask & ((uintptr_t)1 << sizeClass))) {
+		/* The scavenger predicts that objects of this size class survive to tenure age, so skip the copying. Never
+		 * collect for it though: if tenure space is full the object is allocated in new space as if not pretenured.
+		 */
+		MM_MemorySubSpace *tenureSubSpace = memorySpace->getTenureMemorySubSpace();
+		uintptr_t sizeInBytesRequired = allocDescription->getContiguousBytes();
+
+		allocDescription->setTenuredFlag();
+		result = allocateFromPretenureCache(env, allocDescription, sizeInBytesRequired);
+		if ((NULL == result) && (sizeInBytesRequired <= (extensions->tlhMaximumSize / PRETENURE_CACHE_LARGE_OBJECT_FRACTION))) {
+			/* refresh through the subspace (see allocateTLH()) so that the cache pays allocation tax like a TLH */
+			if (NULL != tenureSubSpace->allocateTLH(env, allocDescription, this, NULL, NULL, false)) {
+				result = allocateFromPretenureCache(env, allocDescription, sizeInBytesRequired);
+			}
+		}
+		if (NULL == result) {
+			result = tenureSubSpace->allocateObject(env, allocDescription, NULL, NULL, false);
+		}
+		if (NULL == result) {
+			allocDescription->clearTenuredFlag();
+		}
+	}
+
+	if (NULL == result) {
+		_stats._nurseryAllocationBytesBySizeClass[sizeClass] += allocDescription->getBytesRequested();
+	}
+
+	return result;
+}
+
+void *
+MM_TLHAllocationInterface::allocateFromPretenureCache(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t sizeInBytesRequired)
+{
+	void *result = NULL;
+
+	if (sizeInBytesRequired <= ((uintptr_t)_pretenureCacheTop - (uintptr_t)_pretenureCacheAlloc)) {
+		result = _pretenureCacheAlloc;
+		_pretenureCacheAlloc = (void *)((uintptr_t)_pretenureCacheAlloc + sizeInBytesRequired);
+		/* not completed from a TLH: the caller marks the object if required and the cache is not batch cleared */
+		allocDescription->setMemorySubSpace(_pretenureCacheSubSpace);
+		allocDescription->setMemoryPool(_pretenureCachePool);
+		allocDescription->setObjectFlags(_pretenureCacheSubSpace->getObjectFlags());
+		allocDescription->setNurseryAllocation(false);
+	}
+
+	return result;
+}
+
+void *
+MM_TLHAllocationInterface::refreshPretenureCache(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool)
+{
+	void *addrBase = NULL;
+	void *addrTop = NULL;
+
+	clearPretenureCache(env);
+
+	if (NULL != memoryPool->allocateTLH(env, allocDescription, env->getExtensions()->tlhMaximumSize, addrBase, addrTop)) {
+		_pretenureCacheBase = addrBase;
+		_pretenureCacheAlloc = addrBase;
+		_pretenureCacheTop = addrTop;
+		_pretenureCacheSubSpace = memorySubSpace;
+		_pretenureCachePool = memoryPool;
+		allocDescription->setMemorySubSpace(memorySubSpace);
+		allocDescription->setObjectFlags(memorySubSpace->getObjectFlags());
+
+		TRIGGER_J9HOOK_MM_PRIVATE_CACHE_REFRESHED(env->getExtensions()->privateHookInterface, _owningEnv->getOmrVMThread(), memorySubSpace, addrBase, addrTop);
+	}
+
+	return _pretenureCacheBase;
+}
+
+void
+MM_TLHAllocationInterface::clearPretenureCache(MM_EnvironmentBase *env)
+{
+	if (NULL != _pretenureCachePool) {
+		_pretenureCachePool->abandonTlhHeapChunk(_pretenureCacheAlloc, _pretenureCacheTop);
+		TRIGGER_J9HOOK_MM_PRIVATE_CACHE_CLEARED(env->getExtensions()->privateHookInterface, _owningEnv->getOmrVMThread(), _pretenureCacheSubSpace, _pretenureCacheBase, _pretenureCacheAlloc, _pretenureCacheTop);
+	}
+
+	_pretenureCacheBase = NULL;
+	_pretenureCacheAlloc = NULL;
+	_pretenureCacheTop = NULL;
+	_pretenureCacheSubSpace = NULL;
+	_pretenureCachePool = NULL;
+}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 void *
 MM_TLHAllocationInterface::allocateArray(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, MM_MemorySpace *memorySpace, bool shouldCollectOnFailure)
 {
@@ -259,6 +372,12 @@ MM_TLHAllocationInterface::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescr
 {
 	void *result = NULL;
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/* only pretenured allocations request a TLH on behalf of a tenured object */
+	if (allocDescription->getTenuredFlag()) {
+		result = refreshPretenureCache(env, allocDescription, memorySubSpace, memoryPool);
+	} else
+#endif /* OMR_GC_MODRON_SCAVENGER */
 #if defined(OMR_GC_NON_ZERO_TLH)
 	if (allocDescription->getNonZeroTLHFlag()) {
 		result = _tlhAllocationSupportNonZero.allocateTLH(env, allocDescription, memorySubSpace, memoryPool);
@@ -297,6 +416,10 @@ MM_TLHAllocationInterface::flushCache(MM_EnvironmentBase *env)
 #if defined(OMR_GC_NON_ZERO_TLH)
 	_tlhAllocationSupportNonZero.flushCache(env);
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	clearPretenureCache(env);
+#endif /* OMR_GC_MODRON_SCAVENGER */
 }
 
 void
@@ -63,6 +63,13 @@ private:
 
 	bool _cachedAllocationsEnabled; /**< Are cached allocations enabled? */
 	uintptr_t _bytesAllocatedBase; /**< Bytes allocated at the start of an allocation request.  Relative to _stats.bytesAllocated(). */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	void *_pretenureCacheBase; /**< Base of the tenure space cache used for pretenured allocations */
+	void *_pretenureCacheAlloc; /**< Next free address in the pretenure cache */
+	void *_pretenureCacheTop; /**< Top of the pretenure cache */
+	MM_MemorySubSpace *_pretenureCacheSubSpace; /**< Subspace the pretenure cache was allocated from, NULL if there is no cache */
+	MM_MemoryPool *_pretenureCachePool; /**< Pool the pretenure cache was allocated from, NULL if there is no cache */
+#endif /* OMR_GC_MODRON_SCAVENGER */
 
 public:
 	static MM_TLHAllocationInterface *newInstance(MM_EnvironmentBase *env);
@@ -90,6 +97,33 @@ protected:
 private:
 	void reconnect(MM_EnvironmentBase *env);
 	void *allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/**
+	 * Allocate an object directly in tenure space if the scavenger currently pretenures its size class, otherwise
+	 * record the object's size class in the new space allocation stats consumed by the pretenuring prediction.
+	 * Pretenured objects are carved from a thread local tenure space cache so that only cache refreshes and
+	 * large objects take the tenure pool lock.
+	 * @return the tenured object, or NULL if the object must be allocated in new space
+	 */
+	void *allocatePretenured(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySpace *memorySpace);
+
+	/**
+	 * Allocate an object from the pretenure cache.
+	 * @return the object, or NULL if the cache does not have sizeInBytesRequired bytes left
+	 */
+	void *allocateFromPretenureCache(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t sizeInBytesRequired);
+
+	/**
+	 * Replace the pretenure cache with a new chunk of the given tenure pool.
+	 * @return the base of the new cache, or NULL if the pool could not supply one
+	 */
+	void *refreshPretenureCache(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
+
+	/**
+	 * Return the unused part of the pretenure cache to its pool, leaving the heap walkable.
+	 */
+	void clearPretenureCache(MM_EnvironmentBase *env);
+#endif /* OMR_GC_MODRON_SCAVENGER */
 
 	/**
 	 * Create a ThreadLocalHeap object.
@@ -103,6 +137,13 @@ private:
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
 		_cachedAllocationsEnabled(true),
 		_bytesAllocatedBase(0)
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		, _pretenureCacheBase(NULL)
+		, _pretenureCacheAlloc(NULL)
+		, _pretenureCacheTop(NULL)
+		, _pretenureCacheSubSpace(NULL)
+		, _pretenureCachePool(NULL)
+#endif /* OMR_GC_MODRON_SCAVENGER */
 	{
 		_typeId = __FUNCTION__;
 		_tlhAllocationSupport._objectAllocationInterface = this;
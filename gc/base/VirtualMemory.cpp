@@ -231,6 +231,36 @@ MM_VirtualMemory::commitMemory(void* address, uintptr_t size)
 	return success;
 }
 
+bool
+MM_VirtualMemory::adviseHugePages(void* address, uintptr_t byteAmount, uintptr_t advice)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+
+	bool success = true;
+	if (_pageSize == omrvmem_supported_page_sizes()[0]) {
+		int32_t rc = omrvmem_advise_huge_pages(address, byteAmount, advice);
+		success = (0 == rc) || (OMRPORT_ERROR_VMEM_NOT_SUPPORTED == rc);
+	}
+
+	return success;
+}
+
+uintptr_t
+MM_VirtualMemory::getHugePageBackedSize(void* address, uintptr_t byteAmount)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+
+	uint64_t backedSize = 0;
+	if (_pageSize != omrvmem_supported_page_sizes()[0]) {
+		/* reserved with explicit large pages, the whole range is backed by them */
+		backedSize = byteAmount;
+	} else if (0 != omrvmem_get_huge_page_backed_size(address, byteAmount, &backedSize)) {
+		backedSize = 0;
+	}
+
+	return (uintptr_t)backedSize;
+}
+
 /**
  * Decommit the address range from physical memory.
  * @param address the start of the block to be decommitted
@@ -121,6 +121,28 @@ protected:
 	 */
 	virtual bool setNumaAffinity(uintptr_t numaNode, void* address, uintptr_t byteAmount);
 
+	/**
+	 * Advise the OS on transparent huge page backing for the specified committed range within the receiver.
+	 * Memory reserved with large (non-default) pages is already huge page backed and is left alone.
+	 *
+	 * @param[in] address - the start of the range to advise
+	 * @param byteAmount - the size of the range to advise. Will be rounded inwards to the physical page size.
+	 * @param advice - one of the OMRPORT_VMEM_HUGE_PAGE_ADVICE_* values
+	 *
+	 * @return true on success or if the platform does not support the advice, false on failure
+	 */
+	bool adviseHugePages(void* address, uintptr_t byteAmount, uintptr_t advice);
+
+	/**
+	 * Determine how many bytes of the specified range within the receiver are currently backed by huge pages.
+	 *
+	 * @param[in] address - the start of the range
+	 * @param byteAmount - the size of the range
+	 *
+	 * @return the number of huge page backed bytes, 0 if unknown
+	 */
+	uintptr_t getHugePageBackedSize(void* address, uintptr_t byteAmount);
+
 	/**
 	 * Return the heap base of the virtual memory object.
 	 */
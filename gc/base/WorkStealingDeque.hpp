@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(WORKSTEALINGDEQUE_HPP_)
+#define WORKSTEALINGDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Fixed capacity, single owner work-stealing deque (Chase-Lev).
+ * The owning thread pushes and pops at the bottom without any atomic read-modify-write
+ * except when racing for the last element; any other thread may steal from the top.
+ * The deque never grows: a failed push is expected to be redirected by the caller to
+ * the shared work packets (and from there to the overflow handler).
+ * @ingroup GC_Base
+ */
+class MM_WorkStealingDeque : public MM_BaseNonVirtual
+{
+/* Data members */
+private:
+	volatile uintptr_t _top; /**< Index of the next element to be stolen */
+	volatile uintptr_t _bottom; /**< Index of the next free slot for the owner */
+	void * volatile *_buffer; /**< Circular element storage, _capacity entries */
+	uintptr_t _capacity; /**< Number of entries in _buffer (power of 2) */
+	uintptr_t _mask; /**< _capacity - 1 */
+
+/* Methods */
+private:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t capacity);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_WorkStealingDeque *newInstance(MM_EnvironmentBase *env, uintptr_t capacity);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Push an element at the bottom of the deque. Owner thread only.
+	 * @param element[in] The element to push (must not be NULL)
+	 * @return true if the element was pushed, false if the deque is full
+	 */
+	MMINLINE bool
+	push(void *element)
+	{
+		uintptr_t bottom = _bottom;
+		if ((bottom - _top) >= _capacity) {
+			return false;
+		}
+		_buffer[bottom & _mask] = element;
+		/* the element must be visible before thieves can observe the new bottom */
+		MM_AtomicOperations::storeSync();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop an element from the bottom of the deque. Owner thread only.
+	 * @return the most recently pushed element, or NULL if the deque is empty (or the last element was stolen)
+	 */
+	MMINLINE void *
+	pop()
+	{
+		uintptr_t bottom = _bottom - 1;
+		_bottom = bottom;
+		/* publishing the reservation must be ordered before reading top */
+		MM_AtomicOperations::sync();
+		uintptr_t top = _top;
+		if ((intptr_t)(bottom - top) < 0) {
+			/* deque was empty; restore canonical state */
+			_bottom = top;
+			return NULL;
+		}
+
+		void *element = _buffer[bottom & _mask];
+		if (bottom == top) {
+			/* last element - race against thieves for it */
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				element = NULL;
+			}
+			_bottom = top + 1;
+		}
+		return element;
+	}
+
+	/**
+	 * Steal an element from the top of the deque. Any thread may call this.
+	 * @return the oldest element in the deque, or NULL if the deque is empty or the steal lost a race
+	 */
+	MMINLINE void *
+	steal()
+	{
+		uintptr_t top = _top;
+		/* top must be read before bottom */
+		MM_AtomicOperations::sync();
+		uintptr_t bottom = _bottom;
+		if ((intptr_t)(bottom - top) <= 0) {
+			return NULL;
+		}
+
+		void *element = _buffer[top & _mask];
+		if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+			return NULL;
+		}
+		return element;
+	}
+
+	/**
+	 * Racy emptiness check, suitable for termination polling.
+	 * @return true if the deque appears to hold no elements
+	 */
+	MMINLINE bool isEmpty() { return ((intptr_t)(_bottom - _top) <= 0); }
+
+	MMINLINE uintptr_t getCapacity() { return _capacity; }
+
+	/**
+	 * Create a WorkStealingDeque object.
+	 */
+	MM_WorkStealingDeque()
+		: MM_BaseNonVirtual()
+		, _top(0)
+		, _bottom(0)
+		, _buffer(NULL)
+		, _capacity(0)
+		, _mask(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* WORKSTEALINGDEQUE_HPP_ */
@@ -247,7 +247,8 @@ MM_AllocationContextSegregated::tryAllocateFromRegionPool(MM_EnvironmentBase *en
 bool
 MM_AllocationContextSegregated::shouldPreMarkSmallCells(MM_EnvironmentBase *env)
 {
-	return true;
+	/* In generational mode an unmarked cell is what identifies a nursery object, so new cells stay unmarked */
+	return !env->getExtensions()->segregatedGenerational;
 }
 
 /*
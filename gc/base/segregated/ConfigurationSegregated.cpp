@@ -90,6 +90,9 @@ MM_ConfigurationSegregated::initialize(MM_EnvironmentBase *env)
 			extensions->setSegregatedHeap(true);
 			extensions->setStandardGC(true);
 			extensions->arrayletsPerRegion = extensions->regionSize / env->getOmrVM()->_arrayletLeafSize;
+			if (extensions->segregatedGenerational && (0 == extensions->segregatedNurserySize)) {
+				extensions->segregatedNurserySize = extensions->memoryMax / 4;
+			}
 			success = true;
 		}
 	}
@@ -76,6 +76,12 @@ public:
 
 	virtual MM_HeapRegionDescriptorSegregated *allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess) = 0;
 
+	/**
+	 * @return true if the list is updated without a lock, in which case its internals may not be
+	 * spliced directly into another list and regions must be moved through pop() instead.
+	 */
+	virtual bool isLockFree() { return false; }
+
 	MM_HeapRegionDescriptorSegregated *allocate(MM_EnvironmentBase *env, uintptr_t szClass)
 	{
 		assert(_singleRegionsOnly);
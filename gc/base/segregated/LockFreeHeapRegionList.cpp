@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronopt.h"
+#include "sizeclasses.h"
+
+#include "LockFreeHeapRegionList.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_LockFreeHeapRegionList *
+MM_LockFreeHeapRegionList::newInstance(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, MM_HeapRegionManager *regionManager)
+{
+	MM_LockFreeHeapRegionList *fpl = (MM_LockFreeHeapRegionList *)env->getForge()->allocate(sizeof(MM_LockFreeHeapRegionList), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (fpl) {
+		new (fpl) MM_LockFreeHeapRegionList(regionListKind, regionManager);
+		if (!fpl->initialize(env)) {
+			fpl->kill(env);
+			return NULL;
+		}
+	}
+	return fpl;
+}
+
+void
+MM_LockFreeHeapRegionList::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_LockFreeHeapRegionList::initialize(MM_EnvironmentBase *env)
+{
+	return NULL != _regionManager;
+}
+
+void
+MM_LockFreeHeapRegionList::tearDown(MM_EnvironmentBase *env)
+{
+}
+
+void
+MM_LockFreeHeapRegionList::push(MM_HeapRegionQueue *src)
+{
+	/* Detach the regions from the source first so they are published with a single update */
+	MM_HeapRegionDescriptorSegregated *front = src->dequeue();
+	if (NULL != front) {
+		MM_HeapRegionDescriptorSegregated *back = front;
+		uintptr_t count = 1;
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		while (NULL != (region = src->dequeue())) {
+			Assert_MM_true(NULL == region->getNext() && NULL == region->getPrev());
+			back->setNext(region);
+			back = region;
+			count += 1;
+		}
+		pushChain(front, back, count);
+	}
+}
+
+void
+MM_LockFreeHeapRegionList::push(MM_FreeHeapRegionList *src)
+{
+	MM_HeapRegionDescriptorSegregated *front = src->pop();
+	if (NULL != front) {
+		MM_HeapRegionDescriptorSegregated *back = front;
+		uintptr_t count = 1;
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		while (NULL != (region = src->pop())) {
+			back->setNext(region);
+			back = region;
+			count += 1;
+		}
+		pushChain(front, back, count);
+	}
+}
+
+uintptr_t
+MM_LockFreeHeapRegionList::getTotalRegions()
+{
+	return _totalRegionsCount;
+}
+
+void
+MM_LockFreeHeapRegionList::showList(MM_EnvironmentBase *env)
+{
+	/* Not synchronized with concurrent push/pop; only meaningful while the list is quiescent */
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t count = 0;
+	omrtty_printf("LockFreeHeapRegionList 0x%x: ", this);
+	for (MM_HeapRegionDescriptorSegregated *cur = decodeRegion(_top); cur != NULL; cur = cur->getNext()) {
+		omrtty_printf("  %d-%d-%d ", count, count, cur->getRange());
+		count += 1;
+	}
+	omrtty_printf("\n");
+}
+
+MM_HeapRegionDescriptorSegregated*
+MM_LockFreeHeapRegionList::allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess)
+{
+	MM_HeapRegionDescriptorSegregated *region = NULL;
+	if (1 == numRegions) {
+		region = MM_FreeHeapRegionList::allocate(env, szClass);
+	}
+	return region;
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
@@ -0,0 +1,177 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(LOCKFREEHEAPREGIONLIST_HPP_)
+#define LOCKFREEHEAPREGIONLIST_HPP_
+
+#include "omrcfg.h"
+#include "ModronAssertions.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "FreeHeapRegionList.hpp"
+#include "HeapRegionManager.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * A lock-free implementation of a FreeHeapRegionList for single regions.
+ *
+ * The list is a LIFO stack threaded through the descriptors' next links. The top of
+ * the stack is a 64-bit word holding the region table index of the top region (plus one,
+ * so that zero means empty) in the low half and a modification tag in the high half.
+ * Every successful update bumps the tag, so a pop that raced with a pop/push pair
+ * returning the same region to the top fails its compare-and-swap instead of installing
+ * a stale next link (ABA). Descriptors live in the region table for the life of the heap,
+ * so a stale read of a next link is always safe.
+ *
+ * Only single regions are supported and arbitrary removal (detach) is not, which
+ * is all the single free list in the region pool requires.
+ */
+class MM_LockFreeHeapRegionList : public MM_FreeHeapRegionList
+{
+/* Data members & types */
+public:
+protected:
+private:
+	MM_HeapRegionManager *_regionManager; /**< Region manager owning the table that indexes are relative to */
+	volatile uint64_t _top; /**< Tagged top of stack: (region table index + 1) in the low 32 bits, modification tag in the high 32 bits */
+	volatile uintptr_t _totalRegionsCount;
+
+/* Methods */
+public:
+	static MM_LockFreeHeapRegionList *newInstance(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, MM_HeapRegionManager *regionManager);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	MM_LockFreeHeapRegionList(MM_HeapRegionList::RegionListKind regionListKind, MM_HeapRegionManager *regionManager) :
+		MM_FreeHeapRegionList(regionListKind, true),
+		_regionManager(regionManager),
+		_top(0),
+		_totalRegionsCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	virtual void
+	push(MM_HeapRegionDescriptorSegregated *region)
+	{
+		Assert_MM_true(NULL == region->getNext() && NULL == region->getPrev());
+		pushChain(region, region, 1);
+	}
+
+	virtual void push(MM_HeapRegionQueue *src);
+	virtual void push(MM_FreeHeapRegionList *src);
+
+	virtual MM_HeapRegionDescriptorSegregated *
+	pop()
+	{
+		uint64_t oldTop = _top;
+		MM_HeapRegionDescriptorSegregated *result = decodeRegion(oldTop);
+		while (NULL != result) {
+			uint64_t newTop = encode(result->getNext(), oldTop);
+			uint64_t witness = MM_AtomicOperations::lockCompareExchangeU64(&_top, oldTop, newTop);
+			if (witness == oldTop) {
+				result->setNext(NULL);
+				MM_AtomicOperations::subtract((volatile uintptr_t *)&_length, 1);
+				MM_AtomicOperations::subtract(&_totalRegionsCount, 1);
+				break;
+			}
+			oldTop = witness;
+			result = decodeRegion(oldTop);
+		}
+		return result;
+	}
+
+	/**
+	 * Arbitrary removal cannot be done safely without a lock; the single free list is never
+	 * detached from, so this must not be reached.
+	 */
+	virtual void
+	detach(MM_HeapRegionDescriptorSegregated *cur)
+	{
+		Assert_MM_unreachable();
+	}
+
+	virtual MM_HeapRegionDescriptorSegregated* allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess);
+
+	virtual bool isLockFree() { return true; }
+
+	virtual uintptr_t getTotalRegions();
+
+	virtual void showList(MM_EnvironmentBase *env);
+
+protected:
+private:
+	/**
+	 * Push a chain of regions linked through their next links.
+	 * @param front the region that will become the new top
+	 * @param back the last region of the chain, whose next link is overwritten
+	 * @param count the number of regions in the chain
+	 */
+	MMINLINE void
+	pushChain(MM_HeapRegionDescriptorSegregated *front, MM_HeapRegionDescriptorSegregated *back, uintptr_t count)
+	{
+		uint64_t oldTop = _top;
+		while (true) {
+			back->setNext(decodeRegion(oldTop));
+			uint64_t witness = MM_AtomicOperations::lockCompareExchangeU64(&_top, oldTop, encode(front, oldTop));
+			if (witness == oldTop) {
+				break;
+			}
+			oldTop = witness;
+		}
+		MM_AtomicOperations::add((volatile uintptr_t *)&_length, count);
+		MM_AtomicOperations::add(&_totalRegionsCount, count);
+	}
+
+	MMINLINE MM_HeapRegionDescriptorSegregated *
+	decodeRegion(uint64_t top)
+	{
+		uint32_t indexPlusOne = (uint32_t)top;
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		if (0 != indexPlusOne) {
+			region = (MM_HeapRegionDescriptorSegregated *)_regionManager->physicalTableDescriptorForIndex(indexPlusOne - 1);
+		}
+		return region;
+	}
+
+	/**
+	 * Build a new top word for region, bumping the tag of the top it replaces.
+	 */
+	MMINLINE uint64_t
+	encode(MM_HeapRegionDescriptorSegregated *region, uint64_t oldTop)
+	{
+		uint64_t tag = (oldTop >> 32) + 1;
+		uint64_t indexPlusOne = 0;
+		if (NULL != region) {
+			indexPlusOne = (uint64_t)_regionManager->mapDescriptorToRegionTableIndex(region) + 1;
+		}
+		return (tag << 32) | (uint32_t)indexPlusOne;
+	}
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* LOCKFREEHEAPREGIONLIST_HPP_ */
@@ -108,8 +108,18 @@ public:
 	}
 	
 	virtual void 
-	push(MM_FreeHeapRegionList *srcAsFPL) 
-	{ 
+	push(MM_FreeHeapRegionList *srcAsFPL)
+	{
+		if (srcAsFPL->isLockFree()) {
+			/* A lock-free list cannot be spliced; move its regions one at a time */
+			MM_HeapRegionDescriptorSegregated *region = NULL;
+			lock();
+			while (NULL != (region = srcAsFPL->pop())) {
+				pushInternal(region);
+			}
+			unlock();
+			return;
+		}
 		MM_LockingFreeHeapRegionList* src = MM_LockingFreeHeapRegionList::asLockingFreeHeapRegionList(srcAsFPL);
 		if (src->_head == NULL) { /* Nothing to move - single read needs no lock */
 			return;
@@ -101,9 +101,11 @@ MM_MemorySubSpaceSegregated::allocateMixedObjectOrArraylet(MM_EnvironmentBase *e
 
 	allocDescription->setObjectFlags(getObjectFlags());
 
-	result = allocate(env, allocDescription, allocType);
-	if (NULL != result) {
-		return result;
+	if (!isNurseryExhausted(env)) {
+		result = allocate(env, allocDescription, allocType);
+		if (NULL != result) {
+			return result;
+		}
 	}
 
 	if (NULL != _collector) {
@@ -193,6 +195,27 @@ MM_MemorySubSpaceSegregated::allocateMixedObjectOrArraylet(MM_EnvironmentBase *e
 	return result;
 }
 
+bool
+MM_MemorySubSpaceSegregated::isNurseryExhausted(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (!extensions->segregatedGenerational) {
+		return false;
+	}
+
+	uintptr_t bytesInUse = _memoryPoolSegregated->_bytesInUse;
+	uintptr_t gcCount = extensions->globalGCStats.gcCount;
+	if (gcCount != _nurseryGCCount) {
+		/* First allocation slow path since a collection: the nursery starts out empty. Racing threads sample
+		 * nearly the same value, so the unsynchronized update is harmless.
+		 */
+		_nurseryBaseBytesInUse = bytesInUse;
+		_nurseryGCCount = gcCount;
+		return false;
+	}
+	return bytesInUse > (_nurseryBaseBytesInUse + extensions->segregatedNurserySize);
+}
+
 void *
 MM_MemorySubSpaceSegregated::allocationRequestFailed(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, AllocationType allocationType, MM_ObjectAllocationInterface *objectAllocationInterface, MM_MemorySubSpace *baseSubSpace, MM_MemorySubSpace *previousSubSpace)
 {
@@ -45,6 +45,8 @@ class MM_MemorySubSpaceSegregated : public MM_MemorySubSpaceUniSpace
 private:
 	void *_regionExpansionBase;
 	void *_regionExpansionTop;
+	uintptr_t _nurseryGCCount; /**< Global collection count when _nurseryBaseBytesInUse was sampled */
+	uintptr_t _nurseryBaseBytesInUse; /**< Bytes in use after the last collection, the nursery being everything allocated since */
 
 protected:
 	typedef enum AllocateType {
@@ -94,6 +96,13 @@ public:
 	virtual void *allocateArrayletLeaf(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *baseSubSpace, MM_MemorySubSpace *previousSubSpace, bool shouldCollectOnFailure);
 	virtual uintptr_t largestDesirableArraySpine();
 
+	/**
+	 * In generational mode, determine whether more than segregatedNurserySize bytes have been allocated since the
+	 * last collection, in which case the allocation should collect the nursery before the heap is exhausted.
+	 * @return true if a nursery collection is due
+	 */
+	bool isNurseryExhausted(MM_EnvironmentBase *env);
+
 	/* Calls for internal collection routines */
 	virtual void abandonHeapChunk(void *addrBase, void *addrTop);
 
@@ -125,6 +134,8 @@ public:
 		: MM_MemorySubSpaceUniSpace(env, physicalSubArena, usesGlobalCollector, minimumSize, initialSize, maximumSize, MEMORY_TYPE_OLD, 0)
 		,_regionExpansionBase(NULL)
 		,_regionExpansionTop(NULL)
+		,_nurseryGCCount(UDATA_MAX)
+		,_nurseryBaseBytesInUse(0)
 		, _memoryPoolSegregated((MM_MemoryPoolSegregated *)memoryPool)
 	{
 		_typeId = __FUNCTION__;
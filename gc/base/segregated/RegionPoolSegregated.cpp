@@ -32,6 +32,7 @@
 #include "Heap.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
 #include "HeapRegionManager.hpp"
+#include "LockFreeHeapRegionList.hpp"
 #include "LockingFreeHeapRegionList.hpp"
 #include "LockingHeapRegionQueue.hpp"
 #include "MemoryPoolAggregatedCellList.hpp"
@@ -80,7 +81,8 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 		_smallSweepRegions[szClass] = NULL;
 	}
 
-	_singleFreeList = MM_RegionPoolSegregated::allocateFreeHeapRegionList(env, MM_HeapRegionList::HRL_KIND_FREE, true);
+	/* Singleton regions are taken by every mutator refilling a size class cache, so that list is lock-free */
+	_singleFreeList = MM_LockFreeHeapRegionList::newInstance(env, MM_HeapRegionList::HRL_KIND_FREE, _heapRegionManager);
 	_multiFreeList = MM_RegionPoolSegregated::allocateFreeHeapRegionList(env, MM_HeapRegionList::HRL_KIND_MULTI_FREE, false);
 	_coalesceFreeList = MM_RegionPoolSegregated::allocateFreeHeapRegionList(env, MM_HeapRegionList::HRL_KIND_COALESCE, false);
 	if ((_singleFreeList == NULL) || (_multiFreeList == NULL) || (_coalesceFreeList == NULL)) {
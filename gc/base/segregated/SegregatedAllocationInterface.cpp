@@ -31,8 +31,10 @@
 #include "FrequentObjectsStats.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "MemoryPoolSegregated.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
+#include "MemorySubSpaceSegregated.hpp"
 #include "SizeClasses.hpp"
 #include "ObjectHeapIteratorSegregated.hpp"
 
@@ -158,7 +160,9 @@ MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_All
 			cell = allocateFromCache(env, sizeInBytes);
 			if (NULL == cell) {
 				MM_AllocationContextSegregated *ac = (MM_AllocationContextSegregated *) env->getAllocationContext();
-				if (ac != NULL) {
+				/* Refilling the cache is the allocation slow path, so an exhausted nursery falls through to the subspace to collect */
+				MM_MemorySubSpaceSegregated *subSpace = (MM_MemorySubSpaceSegregated *) memorySpace->getDefaultMemorySubSpace();
+				if ((ac != NULL) && !subSpace->isNurseryExhausted(env)) {
 					cell = ac->preAllocateSmall(env, sizeInBytes);
 				}
 			}
@@ -176,7 +180,8 @@ MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_All
 			cell = allocateFromCache(env, sizeInBytes);
 			if (NULL == cell) {
 				MM_AllocationContextSegregated *ac = (MM_AllocationContextSegregated *) env->getAllocationContext();
-				if (ac != NULL) {
+				MM_MemorySubSpaceSegregated *subSpace = (MM_MemorySubSpaceSegregated *) memorySpace->getDefaultMemorySubSpace();
+				if ((ac != NULL) && !subSpace->isNurseryExhausted(env)) {
 					cell = ac->preAllocateSmall(env, sizeInBytes);
 				}
 			}
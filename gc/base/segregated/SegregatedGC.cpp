@@ -32,6 +32,7 @@
 #include "ParallelMarkTask.hpp"
 #include "SegregatedAllocationInterface.hpp"
 #include "SegregatedMarkingScheme.hpp"
+#include "SegregatedMarkTask.hpp"
 #include "SegregatedSweepTask.hpp"
 #include "SweepSchemeSegregated.hpp"
 #include "SweepStats.hpp"
@@ -204,9 +205,16 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 //	}
 
 	/* run the mark */
-	bool initMarkMap = true; // reset the markmap?
-	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
-	_dispatcher->run(env, &markTask);
+	if (_extensions->segregatedGenerational) {
+		bool nurseryCollection = isNurseryCollection(env);
+		MM_SegregatedMarkTask markTask(env, _dispatcher, _markingScheme, env->_cycleState, nurseryCollection);
+		_dispatcher->run(env, &markTask);
+		_nurseryCollectionCount = nurseryCollection ? (_nurseryCollectionCount + 1) : 0;
+	} else {
+		bool initMarkMap = true; // reset the markmap?
+		MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
+		_dispatcher->run(env, &markTask);
+	}
 
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 
@@ -247,6 +255,16 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	return true;
 }
 
+bool
+MM_SegregatedGC::isNurseryCollection(MM_EnvironmentBase *env)
+{
+	MM_GCCode gcCode = env->_cycleState->_gcCode;
+	return !gcCode.isExplicitGC()
+		&& !gcCode.isAggressiveGC()
+		&& !gcCode.isOutOfMemoryGC()
+		&& (_nurseryCollectionCount < _extensions->segregatedNurseryCollections);
+}
+
 void
 MM_SegregatedGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode)
 {
@@ -48,6 +48,7 @@ protected:
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the main cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
+	uintptr_t _nurseryCollectionCount; /**< Number of nursery collections run since the last full collection */
 private:
 public:
 	/* OMRTODO Remove _objectsMarked and _scanBytes, they are used to fake marking to create more interesting verbose output */
@@ -73,6 +74,14 @@ protected:
 	void reportSweepStart(MM_EnvironmentBase *env);
 	void reportSweepEnd(MM_EnvironmentBase *env);
 
+	/**
+	 * Decide whether the current collection may be restricted to the nursery.
+	 * Explicit, aggressive and out of memory collections, and every (segregatedNurseryCollections + 1)th
+	 * collection, trace the full heap so that garbage in old objects is eventually reclaimed.
+	 * @return true if only the nursery should be collected
+	 */
+	bool isNurseryCollection(MM_EnvironmentBase *env);
+
 public:
 	static MM_SegregatedGC *newInstance(MM_EnvironmentBase *env);
 	virtual void kill(MM_EnvironmentBase *env);
@@ -99,6 +108,8 @@ public:
 
 	virtual bool isMarked(void *objectPtr) { return _markingScheme->isMarked(static_cast<omrobjectptr_t>(objectPtr)); }
 
+	virtual void rememberReference(MM_EnvironmentBase* env, omrobjectptr_t parentObject, omrobjectptr_t childObject) { _markingScheme->rememberObject(parentObject, childObject); }
+
 	/**
 	 * Return reference to Marking Scheme
 	 */
@@ -119,6 +130,7 @@ public:
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
 		, _dispatcher(_extensions->dispatcher)
+		, _nurseryCollectionCount(0)
 		, _scanBytes(0)
 		, _objectsMarked(0)
 	{
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(SEGREGATEDMARKTASK_HPP_)
+#define SEGREGATEDMARKTASK_HPP_
+
+#include "omrcfg.h"
+
+#include "ParallelMarkTask.hpp"
+#include "SegregatedMarkingScheme.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * Mark task used by the segregated collector when it runs generationally.
+ * A full collection clears the mark map and the remembered objects and traces the whole heap.  A nursery
+ * collection keeps the mark bits of old objects, so only objects reachable from the roots and from the
+ * remembered objects through unmarked (nursery) objects are traced.  Setup, cleanup and the parallel
+ * statistics are those of MM_ParallelMarkTask.
+ */
+class MM_SegregatedMarkTask : public MM_ParallelMarkTask
+{
+/* Data members / types */
+public:
+protected:
+private:
+	MM_SegregatedMarkingScheme *_segregatedMarkingScheme;
+	const bool _isNurseryCollection; /**< True if old (already marked) objects are not traced */
+
+/* Methods */
+public:
+	virtual void run(MM_EnvironmentBase *env);
+
+	MM_SegregatedMarkTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_SegregatedMarkingScheme *markingScheme, MM_CycleState *cycleState, bool isNurseryCollection)
+		: MM_ParallelMarkTask(env, dispatcher, markingScheme, !isNurseryCollection, cycleState)
+		, _segregatedMarkingScheme(markingScheme)
+		, _isNurseryCollection(isNurseryCollection)
+	{
+		_typeId = __FUNCTION__;
+	}
+protected:
+private:
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* SEGREGATEDMARKTASK_HPP_ */
@@ -20,7 +20,14 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include "Bits.hpp"
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapRegionIterator.hpp"
+#include "HeapRegionManager.hpp"
+#include "Task.hpp"
+#include "WorkStack.hpp"
 
 #include "SegregatedMarkingScheme.hpp"
 
@@ -57,4 +64,90 @@ MM_SegregatedMarkingScheme::kill(MM_EnvironmentBase *env)
 	env->getForge()->free(this);
 }
 
+bool
+MM_SegregatedMarkingScheme::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_MarkingScheme::initialize(env)) {
+		return false;
+	}
+
+	if (_extensions->segregatedGenerational) {
+		_rememberedMap = MM_MarkMap::newInstance(env, _extensions->heap->getMaximumPhysicalRange());
+		if (NULL == _rememberedMap) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void
+MM_SegregatedMarkingScheme::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _rememberedMap) {
+		_rememberedMap->kill(env);
+		_rememberedMap = NULL;
+	}
+
+	MM_MarkingScheme::tearDown(env);
+}
+
+bool
+MM_SegregatedMarkingScheme::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress)
+{
+	bool result = MM_MarkingScheme::heapAddRange(env, subspace, size, lowAddress, highAddress);
+
+	if (result && (NULL != _rememberedMap)) {
+		result = _rememberedMap->heapAddRange(env, size, lowAddress, highAddress);
+	}
+	return result;
+}
+
+bool
+MM_SegregatedMarkingScheme::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
+{
+	bool result = MM_MarkingScheme::heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+
+	if (result && (NULL != _rememberedMap)) {
+		result = _rememberedMap->heapRemoveRange(env, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+	}
+	return result;
+}
+
+void
+MM_SegregatedMarkingScheme::scanRememberedObjects(MM_EnvironmentBase *env)
+{
+	GC_HeapRegionIterator regionIterator(_extensions->heap->getHeapRegionManager());
+	MM_HeapRegionDescriptor *region = NULL;
+	/* The segregated heap map is compressed (one bit per smallest cell), so walk its slots directly rather than through MM_HeapMapIterator */
+	uintptr_t grain = _rememberedMap->getObjectGrain();
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (region->isCommitted() && J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			/* Regions are aligned far beyond a heap map slot, so no other thread touches the map slots of this region */
+			uintptr_t slotIndex = _rememberedMap->getSlotIndex((omrobjectptr_t)region->getLowAddress());
+			uintptr_t slotTop = _rememberedMap->getSlotIndex((omrobjectptr_t)region->getHighAddress());
+			uintptr_t slotBase = (uintptr_t)region->getLowAddress();
+			for (; slotIndex < slotTop; slotIndex++, slotBase += grain * J9BITS_BITS_IN_SLOT) {
+				uintptr_t slotValue = _rememberedMap->getSlot(slotIndex);
+				if (0 != slotValue) {
+					_rememberedMap->setSlot(slotIndex, 0);
+					while (0 != slotValue) {
+						uintptr_t bitIndex = MM_Bits::leadingZeroes(slotValue);
+						slotValue &= slotValue - 1;
+						/* The remembered object is old, so it is already marked - queue it for scanning directly */
+						env->_workStack.push(env, (void *)(slotBase + (bitIndex * grain)));
+					}
+				}
+			}
+		}
+	}
+}
+
+void
+MM_SegregatedMarkingScheme::clearRememberedObjects(MM_EnvironmentBase *env)
+{
+	_rememberedMap->initializeMarkMap(env);
+}
+
 #endif /* OMR_GC_SEGREGATED_HEAP */
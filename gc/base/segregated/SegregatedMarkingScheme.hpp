@@ -28,6 +28,7 @@
 
 #include "GCExtensionsBase.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
+#include "MarkMap.hpp"
 #include "MarkingScheme.hpp"
 
 #include "BaseVirtual.hpp"
@@ -44,12 +45,43 @@ class MM_SegregatedMarkingScheme : public MM_MarkingScheme
 public:
 protected:
 private:
+	MM_MarkMap *_rememberedMap; /**< Heap map of marked (old) objects which were stored a reference to an unmarked (nursery) object since the last collection */
+
 	/*
 	 * Function members
 	 */
 public:
 	static MM_SegregatedMarkingScheme *newInstance(MM_EnvironmentBase *env);
 	void kill(MM_EnvironmentBase *env);
+
+	bool heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress);
+	bool heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
+
+	/**
+	 * Generational write barrier for the segregated heap.  Objects which survived a previous collection keep
+	 * their mark bit, so a store of an unmarked (nursery) child into a marked (old) parent must remember
+	 * the parent for the next nursery collection.
+	 * @param[in] parentObject the object being stored into
+	 * @param[in] childObject the object reference being stored
+	 */
+	MMINLINE void
+	rememberObject(omrobjectptr_t parentObject, omrobjectptr_t childObject)
+	{
+		if ((NULL != childObject) && _markMap->isBitSet(parentObject) && !_markMap->isBitSet(childObject)) {
+			_rememberedMap->atomicSetBit(parentObject);
+		}
+	}
+
+	/**
+	 * Push every remembered object onto the work stack so that its nursery children are traced, and forget it.
+	 * Must be called from within a collection task; heap regions are distributed as work units.
+	 */
+	void scanRememberedObjects(MM_EnvironmentBase *env);
+
+	/**
+	 * Forget all remembered objects.  Called from within a full collection task, which traces the entire heap.
+	 */
+	void clearRememberedObjects(MM_EnvironmentBase *env);
 	
 	MMINLINE void
 	preMarkSmallCells(MM_EnvironmentBase* env, MM_HeapRegionDescriptorSegregated *containingRegion, uintptr_t *cellList, uintptr_t preAllocatedBytes)
@@ -67,11 +99,15 @@ public:
 		}
 	}
 protected:
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
 	/**
 	 * Create a MM_RealtimeMarkingScheme object
 	 */
 	MM_SegregatedMarkingScheme(MM_EnvironmentBase *env)
 		: MM_MarkingScheme(env)
+		, _rememberedMap(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -286,6 +286,11 @@ MM_CompactScheme::initialize(MM_EnvironmentBase *env)
 void
 MM_CompactScheme::tearDown(MM_EnvironmentBase *env)
 {
+	if (NULL != _pageLiveBytes) {
+		env->getForge()->free(_pageLiveBytes);
+		_pageLiveBytes = NULL;
+		_pageLiveBytesCount = 0;
+	}
 	_delegate.tearDown(env);
 }
 
@@ -369,9 +374,26 @@ MM_CompactScheme::mainSetupForGC(MM_EnvironmentStandard *env)
 	_compactTable = (CompactTableEntry*)_markingScheme->getMarkMap()->getMarkBits();
 	_subAreaTable = (SubAreaEntry*)_extensions->sweepHeapSectioning->getBackingStoreAddress();
 	_subAreaTableSize = _extensions->sweepHeapSectioning->getBackingStoreSize();
+	if (_extensions->compactUseSummaryTable) {
+		allocatePageSummaryTable(env);
+	}
 	_delegate.mainSetupForGC(env);
 }
 
+void
+MM_CompactScheme::allocatePageSummaryTable(MM_EnvironmentStandard *env)
+{
+	uintptr_t pageCount = (((uintptr_t)_heap->getHeapTop() - _heapBase) / sizeof_page) + 1;
+
+	if (pageCount > _pageLiveBytesCount) {
+		if (NULL != _pageLiveBytes) {
+			env->getForge()->free(_pageLiveBytes);
+		}
+		_pageLiveBytes = (uintptr_t *)env->getForge()->allocate(pageCount * sizeof(uintptr_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		_pageLiveBytesCount = (NULL == _pageLiveBytes) ? 0 : pageCount;
+	}
+}
+
 omrobjectptr_t
 MM_CompactScheme::freeChunkEnd(omrobjectptr_t chunk)
 {
@@ -464,12 +486,15 @@ void
 MM_CompactScheme::setRealLimitsSubAreas(MM_EnvironmentStandard *env)
 {
 	/* multi threaded pass to find real regions limits - where an object is found */
-	for (uintptr_t i = 1; _subAreaTable[i].state != SubAreaEntry::end_heap; i++) {
-		/* i=1 because first region starts with heapAlloc thus we don't need to find its first object */
-		if ((SubAreaEntry::end_segment == _subAreaTable[i].state)
-		|| (SubAreaEntry::end_segment == _subAreaTable[i - 1].state)
-		) {
-			/* skip the end_segment and its successor */
+	for (uintptr_t i = 0; _subAreaTable[i].state != SubAreaEntry::end_heap; i++) {
+		if (SubAreaEntry::end_segment == _subAreaTable[i].state) {
+			continue;
+		}
+		/* the first sub area of a segment starts with heapAlloc thus we don't need to find its first object,
+		 * it is only walked to fill the page summary table
+		 */
+		bool firstInSegment = (0 == i) || (SubAreaEntry::end_segment == _subAreaTable[i - 1].state);
+		if (firstInSegment && (NULL == _pageLiveBytes)) {
 			continue;
 		}
 
@@ -479,8 +504,20 @@ MM_CompactScheme::setRealLimitsSubAreas(MM_EnvironmentStandard *env)
 			MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, start, end);
 			omrobjectptr_t objectPtr = markedObjectIterator.nextObject();
 
-			_subAreaTable[i].firstObject = objectPtr;
-			Assert_MM_true(objectPtr == 0 || _markMap->isBitSet(objectPtr));
+			if (!firstInSegment) {
+				_subAreaTable[i].firstObject = objectPtr;
+				Assert_MM_true(objectPtr == 0 || _markMap->isBitSet(objectPtr));
+			}
+
+			if (NULL != _pageLiveBytes) {
+				/* tentative limits are page aligned, so every page is summarized by exactly one sub area */
+				intptr_t firstPage = pageIndex((omrobjectptr_t)start);
+				memset(&_pageLiveBytes[firstPage], 0, (pageIndex((omrobjectptr_t)end) - firstPage) * sizeof(uintptr_t));
+				while (NULL != objectPtr) {
+					_pageLiveBytes[pageIndex(objectPtr)] += _extensions->objectModel.getConsumedSizeInBytesWithHeaderForMove(objectPtr);
+					objectPtr = markedObjectIterator.nextObject();
+				}
+			}
 		}
 	}
 }
@@ -1207,13 +1244,17 @@ MM_CompactScheme::doCompact(MM_EnvironmentStandard *env, MM_MemorySubSpace *memo
 			 * sure there is enough space for ALL of them.
 			 */
 			uintptr_t pageByteCount = 0;
-			void *baseOfPage = pageStart(pageIndex(objectPtr));
-			for (uintptr_t bias = 0; bias < sizeof_page; bias += J9MODRON_HEAP_BYTES_PER_UDATA_OF_HEAP_MAP) {
-				void *baseAddress = (void *)((uintptr_t)baseOfPage + bias);
-				MM_HeapMapWordIterator pagePieceIterator(_markMap, baseAddress);
-				omrobjectptr_t p = NULL;
-				while ((NULL != (p = pagePieceIterator.nextObject())) && (pageByteCount <= deadObjectSize)) {
-					pageByteCount += _extensions->objectModel.getConsumedSizeInBytesWithHeaderForMove(p);
+			if (NULL != _pageLiveBytes) {
+				pageByteCount = _pageLiveBytes[pageIndex(objectPtr)];
+			} else {
+				void *baseOfPage = pageStart(pageIndex(objectPtr));
+				for (uintptr_t bias = 0; bias < sizeof_page; bias += J9MODRON_HEAP_BYTES_PER_UDATA_OF_HEAP_MAP) {
+					void *baseAddress = (void *)((uintptr_t)baseOfPage + bias);
+					MM_HeapMapWordIterator pagePieceIterator(_markMap, baseAddress);
+					omrobjectptr_t p = NULL;
+					while ((NULL != (p = pagePieceIterator.nextObject())) && (pageByteCount <= deadObjectSize)) {
+						pageByteCount += _extensions->objectModel.getConsumedSizeInBytesWithHeaderForMove(p);
+					}
 				}
 			}
 			if (pageByteCount > deadObjectSize) {
@@ -137,6 +137,8 @@ protected:
 	SubAreaEntry           *_subAreaTable;  /**< Reference to the subAreaTable which is shared data from the SweepHeapSectioning */
 	omrobjectptr_t         _compactFrom;
 	omrobjectptr_t         _compactTo;
+	uintptr_t              *_pageLiveBytes; /**< Summary table holding, per page, the post-move size of all marked objects starting on that page (NULL if not in use) */
+	uintptr_t              _pageLiveBytesCount; /**< Number of entries allocated in _pageLiveBytes */
 	MM_CompactDelegate     _delegate;
 
 public:
@@ -162,7 +164,14 @@ protected:
 
 	void createSubAreaTable(MM_EnvironmentStandard *env, bool singleThreaded);
 	/**
-	 * Set the real limits for a specific subArea
+	 * Make sure the page summary table covers the whole heap, allocating or growing it as required.
+	 * Compaction falls back to walking each page before evacuating it if the table cannot be allocated.
+	 * @param env[in] the main thread
+	 */
+	void allocatePageSummaryTable(MM_EnvironmentStandard *env);
+	/**
+	 * Set the real limits for a specific subArea. If the page summary table is in use, the same walk of the
+	 * mark map fills it, so evacuation decides whether a page fits in a free chunk with a single table lookup.
 	 *
 	 * @param env[in] the current thread
 	 */
@@ -335,6 +344,8 @@ public:
 		, _markMap(markingScheme->getMarkMap())
 		, _subAreaTableSize(0)
 		, _subAreaTable(NULL)
+		, _pageLiveBytes(NULL)
+		, _pageLiveBytesCount(0)
 		, _delegate()
 	{
 		_typeId = __FUNCTION__;
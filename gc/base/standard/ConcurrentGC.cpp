@@ -560,7 +560,7 @@ MM_ConcurrentGC::determineInitWork(MM_EnvironmentBase *env)
 				_initRanges[i].top = region->getHighAddress();
 				_initRanges[i].subspace = subspace;
 				_initRanges[i].current = _initRanges[i].base;
-				_initRanges[i].initBytes = _markingScheme->numMarkBitsInRange(env,_initRanges[i].base,_initRanges[i].top);
+				_initRanges[i].initBytes = _markingScheme->numMarkMapBytesInRange(env,_initRanges[i].base,_initRanges[i].top);
 				_initRanges[i].type = MARK_BITS;
 				_initRanges[i].chunkSize = INIT_CHUNK_SIZE * _markingScheme->numHeapBytesPerMarkMapByte();
 				i++;
@@ -31,6 +31,17 @@
 
 #include "ParallelScavengeTask.hpp"
 
+/**
+ * Task run by the GC threads while mutators run during a concurrent scavenge.
+ *
+ * Mutators must not see an object in evacuate space once it has been copied, so the language runtime
+ * has to load references through a read barrier that resolves forwarding: either hardware guarded loads
+ * (concurrentScavengerHWSupport) or a software range check (softwareRangeCheckReadBarrier).
+ * Protecting evacuate space with omrvmem and resolving forwarding in a fault handler is not a substitute:
+ * a fault is raised when a reference is dereferenced, not when it is loaded, so a mutator can hold and
+ * compare a stale reference without faulting, and the handler cannot update the reference that faulted.
+ * GC threads copying out of the same pages would also have to reach them through a second mapping.
+ */
 class MM_ConcurrentScavengeTask : public MM_ParallelScavengeTask
 {
 	/* Data Members */
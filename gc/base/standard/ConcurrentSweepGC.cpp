@@ -0,0 +1,339 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+
+#include "omrutil.h"
+
+#include "AllocateDescription.hpp"
+#include "ConcurrentSweepGC.hpp"
+#include "ConcurrentSweepScheme.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+typedef struct SweepHelperThreadInfo {
+	OMR_VM *omrVM;
+	uintptr_t threadFlags;
+	MM_ConcurrentSweepGC *collector;
+} SweepHelperThreadInfo;
+
+#define SWEEP_HELPER_INFO_FLAG_OK 1
+
+/* Number of chunks a background sweep helper sweeps before checking whether to yield VM access */
+#define SWEEP_HELPER_CHUNK_BATCH 8
+
+extern "C" {
+
+/**
+ * Background sweep helper thread procedure
+ *
+ * @parm info Address of SweepHelperThreadInfo structure
+ */
+static int J9THREAD_PROC
+sweep_helper_thread_proc(void *info)
+{
+	SweepHelperThreadInfo *sweepHelperThreadInfo = (SweepHelperThreadInfo *)info;
+	MM_ConcurrentSweepGC *collector = sweepHelperThreadInfo->collector;
+	OMR_VM *omrVM = sweepHelperThreadInfo->omrVM;
+	omrthread_monitor_t monitor = collector->getSweepHelpersMonitor();
+
+	/* Signal that the helper thread has started; info is owned by the starting thread and must not be touched afterwards */
+	omrthread_monitor_enter(monitor);
+	sweepHelperThreadInfo->threadFlags = SWEEP_HELPER_INFO_FLAG_OK;
+	omrthread_monitor_notify_all(monitor);
+	omrthread_monitor_exit(monitor);
+
+	collector->sweepHelperEntryPoint(omrVM);
+
+	return 0;
+}
+
+} /* extern "C" */
+
+MM_ConcurrentSweepGC *
+MM_ConcurrentSweepGC::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentSweepGC *globalGC = (MM_ConcurrentSweepGC *)env->getForge()->allocate(sizeof(MM_ConcurrentSweepGC), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != globalGC) {
+		new(globalGC) MM_ConcurrentSweepGC(env);
+		if (!globalGC->initialize(env)) {
+			globalGC->kill(env);
+			globalGC = NULL;
+		}
+	}
+	return globalGC;
+}
+
+void
+MM_ConcurrentSweepGC::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ConcurrentSweepGC::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_ParallelGlobalGC::initialize(env)) {
+		return false;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_sweepHelpersMonitor, 0, "MM_ConcurrentSweepGC::sweepHelpers")) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_ConcurrentSweepGC::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _sweepHelpersMonitor) {
+		omrthread_monitor_destroy(_sweepHelpersMonitor);
+		_sweepHelpersMonitor = NULL;
+	}
+
+	MM_ParallelGlobalGC::tearDown(env);
+}
+
+bool
+MM_ConcurrentSweepGC::collectorStartup(MM_GCExtensionsBase* extensions)
+{
+	bool result = MM_ParallelGlobalGC::collectorStartup(extensions);
+	if (result) {
+		result = initializeSweepHelpers(extensions);
+	}
+	return result;
+}
+
+void
+MM_ConcurrentSweepGC::collectorShutdown(MM_GCExtensionsBase *extensions)
+{
+	shutdownSweepHelpers(extensions);
+	MM_ParallelGlobalGC::collectorShutdown(extensions);
+}
+
+/**
+ * Start the background sweep helper threads.
+ * Helpers run at minimum priority so that they only use cycles the application leaves idle.
+ * @return true if all requested helpers were started, false otherwise
+ */
+bool
+MM_ConcurrentSweepGC::initializeSweepHelpers(MM_GCExtensionsBase *extensions)
+{
+	SweepHelperThreadInfo sweepHelperThreadInfo;
+	sweepHelperThreadInfo.omrVM = extensions->getOmrVM();
+	sweepHelperThreadInfo.collector = this;
+
+	omrthread_monitor_enter(_sweepHelpersMonitor);
+	_sweepHelpersRequest = SWEEP_HELPER_WAIT;
+
+	uintptr_t threadCount = 0;
+	for (threadCount = 0; threadCount < _sweepHelperThreads; threadCount++) {
+		omrthread_t thread = NULL;
+		sweepHelperThreadInfo.threadFlags = 0;
+
+		intptr_t threadForkResult = createThreadWithCategory(&thread, OMR_OS_STACK_SIZE, J9THREAD_PRIORITY_MIN,
+															0, sweep_helper_thread_proc, (void *)&sweepHelperThreadInfo, J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+		if (0 != threadForkResult) {
+			break;
+		}
+
+		while (0 == sweepHelperThreadInfo.threadFlags) {
+			omrthread_monitor_wait(_sweepHelpersMonitor);
+		}
+	}
+	_sweepHelpersStarted = threadCount;
+	omrthread_monitor_exit(_sweepHelpersMonitor);
+
+	return (_sweepHelpersStarted == _sweepHelperThreads);
+}
+
+/**
+ * Ask all background sweep helper threads to terminate and wait until they have.
+ */
+void
+MM_ConcurrentSweepGC::shutdownSweepHelpers(MM_GCExtensionsBase *extensions)
+{
+	if (_sweepHelpersStarted > 0) {
+		omrthread_monitor_enter(_sweepHelpersMonitor);
+		_sweepHelpersRequest = SWEEP_HELPER_SHUTDOWN;
+		omrthread_monitor_notify_all(_sweepHelpersMonitor);
+		while (_sweepHelpersShutdownCount < _sweepHelpersStarted) {
+			omrthread_monitor_wait(_sweepHelpersMonitor);
+		}
+		omrthread_monitor_exit(_sweepHelpersMonitor);
+	}
+}
+
+/**
+ * Wake the background sweep helper threads once a lazy sweep has been started.
+ */
+void
+MM_ConcurrentSweepGC::resumeSweepHelpers(MM_EnvironmentBase *env)
+{
+	if (_sweepHelpersStarted > 0) {
+		omrthread_monitor_enter(_sweepHelpersMonitor);
+		if (SWEEP_HELPER_WAIT == _sweepHelpersRequest) {
+			_sweepHelpersRequest = SWEEP_HELPER_SWEEP;
+			omrthread_monitor_notify_all(_sweepHelpersMonitor);
+		}
+		omrthread_monitor_exit(_sweepHelpersMonitor);
+	}
+}
+
+void
+MM_ConcurrentSweepGC::sweepHelperEntryPoint(OMR_VM *omrVM)
+{
+	OMR_VMThread *omrThread = NULL;
+	MM_EnvironmentBase *env = NULL;
+	SweepHelperRequest request = SWEEP_HELPER_WAIT;
+
+	while (SWEEP_HELPER_SHUTDOWN != request) {
+		omrthread_monitor_enter(_sweepHelpersMonitor);
+		while (SWEEP_HELPER_WAIT == (request = _sweepHelpersRequest)) {
+			omrthread_monitor_wait(_sweepHelpersMonitor);
+		}
+		omrthread_monitor_exit(_sweepHelpersMonitor);
+
+		if ((SWEEP_HELPER_SWEEP == request) && (NULL == omrThread)) {
+			/* Attach on the first sweep request rather than at collector startup: the collector is created
+			 * before the default memory space, and the per-thread free entry statistics can only be sized
+			 * once the memory pools exist.
+			 */
+			omrThread = MM_EnvironmentBase::attachVMThread(omrVM, "Concurrent Sweep Helper", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+			if (NULL == omrThread) {
+				break;
+			}
+			env = MM_EnvironmentBase::getEnvironment(omrThread);
+
+			/* Thread not a mutator so identify its type */
+			env->initializeGCThread();
+			env->setThreadType(CON_SWEEP_HELPER_THREAD);
+		}
+
+		if (SWEEP_HELPER_SWEEP == request) {
+			/* Sweeping requires shared VM access so that a collection cannot start underneath the helper.
+			 * Sweep in batches of chunks and give VM access back between batches whenever a thread is
+			 * waiting for exclusive access, so that a helper never delays a collection by more than one batch.
+			 */
+			uintptr_t chunksSwept = 0;
+			env->acquireVMAccess();
+			do {
+				chunksSwept = getConcurrentSweepScheme()->sweepChunksConcurrently(env, SWEEP_HELPER_CHUNK_BATCH);
+				if (env->isExclusiveAccessRequestWaiting()) {
+					env->releaseVMAccess();
+					env->acquireVMAccess();
+				}
+			} while ((0 < chunksSwept) && (SWEEP_HELPER_SWEEP == _sweepHelpersRequest));
+			env->releaseVMAccess();
+
+			omrthread_monitor_enter(_sweepHelpersMonitor);
+			if (SWEEP_HELPER_SWEEP == _sweepHelpersRequest) {
+				_sweepHelpersRequest = SWEEP_HELPER_WAIT;
+			}
+			request = _sweepHelpersRequest;
+			omrthread_monitor_exit(_sweepHelpersMonitor);
+		}
+	}
+
+	if (NULL != omrThread) {
+		MM_EnvironmentBase::detachVMThread(omrVM, omrThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+	}
+
+	omrthread_monitor_enter(_sweepHelpersMonitor);
+	_sweepHelpersShutdownCount += 1;
+	if (_sweepHelpersShutdownCount == _sweepHelpersStarted) {
+		omrthread_monitor_notify_all(_sweepHelpersMonitor);
+	}
+	omrthread_exit(_sweepHelpersMonitor);
+}
+
+void
+MM_ConcurrentSweepGC::completeConcurrentSweep(MM_EnvironmentBase *env)
+{
+	if (getConcurrentSweepScheme()->isConcurrentSweepActive()) {
+		getConcurrentSweepScheme()->completeSweep(env, ABOUT_TO_GC);
+	}
+}
+
+void
+MM_ConcurrentSweepGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode)
+{
+	/* Finish off any sweep work still pending before the GC: the mark map is about to be
+	 * reused and a partially connected free entry may span unswept chunks.
+	 */
+	completeConcurrentSweep(env);
+
+	MM_ParallelGlobalGC::internalPreCollect(env, subSpace, allocDescription, gcCode);
+}
+
+void
+MM_ConcurrentSweepGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace)
+{
+	MM_ParallelGlobalGC::internalPostCollect(env, subSpace);
+
+	/* Chunks not swept during the collection are left to allocating threads and helpers */
+	resumeSweepHelpers(env);
+}
+
+bool
+MM_ConcurrentSweepGC::completeFreelistRebuildRequired(MM_EnvironmentBase *env, SweepCompletionReason *reason)
+{
+	bool result = MM_ParallelGlobalGC::completeFreelistRebuildRequired(env, reason);
+	if (SYSTEM_GC == *reason) {
+		*reason = NOT_REQUIRED;
+		result = false;
+	}
+	return result;
+}
+
+void
+MM_ConcurrentSweepGC::prepareHeapForWalk(MM_EnvironmentBase *env)
+{
+	completeConcurrentSweep(env);
+
+	MM_ParallelGlobalGC::prepareHeapForWalk(env);
+}
+
+void
+MM_ConcurrentSweepGC::payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription)
+{
+	uintptr_t oldVMstate = env->pushVMstate(OMRVMSTATE_GC_CONCURRENT_SWEEP);
+	getConcurrentSweepScheme()->payAllocationTax(env, baseSubSpace, allocDescription);
+	env->popVMstate(oldVMstate);
+}
+
+/**
+ * Replenish a pools free lists to satisfy a given allocate.
+ * @note This call is made under the pools allocation lock (or equivalent)
+ * @return True if the pool was replenished with a free entry that can satisfy the size, false otherwise.
+ */
+bool
+MM_ConcurrentSweepGC::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size)
+{
+	return getConcurrentSweepScheme()->replenishPoolForAllocate(env, memoryPool, size);
+}
+
+#endif /* OMR_GC_CONCURRENT_SWEEP */
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(CONCURRENTSWEEPGC_HPP_)
+#define CONCURRENTSWEEPGC_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+#include "omr.h"
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+#include "ParallelGlobalGC.hpp"
+
+class MM_ConcurrentSweepScheme;
+
+/**
+ * Flat mark and sweep global collector whose sweep is performed lazily.
+ * The stop-the-world part of the collection only marks and sweeps enough chunks to satisfy the
+ * allocation that triggered it.  The remaining chunks are swept and connected to the free lists
+ * by allocating threads (when a pool runs out of free entries, or as allocation tax) and by
+ * background sweep helper threads.  Any outstanding sweep work is completed before the next
+ * collection or heap walk.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentSweepGC : public MM_ParallelGlobalGC
+{
+	/*
+	 * Data members
+	 */
+private:
+	typedef enum {
+		SWEEP_HELPER_WAIT = 1,
+		SWEEP_HELPER_SWEEP,
+		SWEEP_HELPER_SHUTDOWN
+	} SweepHelperRequest;
+
+	uintptr_t _sweepHelperThreads; /**< Number of background sweep helper threads requested */
+	uintptr_t _sweepHelpersStarted; /**< Number of background sweep helper threads actually started */
+	uintptr_t _sweepHelpersShutdownCount; /**< Number of background sweep helper threads that have exited */
+	volatile SweepHelperRequest _sweepHelpersRequest; /**< Current request for the background sweep helper threads */
+	omrthread_monitor_t _sweepHelpersMonitor; /**< Monitor protecting _sweepHelpersRequest and helper startup/shutdown */
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE MM_ConcurrentSweepScheme *getConcurrentSweepScheme() { return (MM_ConcurrentSweepScheme *)_sweepScheme; }
+
+	bool initializeSweepHelpers(MM_GCExtensionsBase *extensions);
+	void shutdownSweepHelpers(MM_GCExtensionsBase *extensions);
+	void resumeSweepHelpers(MM_EnvironmentBase *env);
+
+	/**
+	 * Finish all outstanding sweep and connect work.
+	 * @note Expects exclusive access and the parallel GC threads to be available.
+	 */
+	void completeConcurrentSweep(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	virtual void internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode);
+	virtual void internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace);
+
+	/**
+	 * Answer whether the sweep must be completed in the pause.
+	 * An explicit collection does not need an accurate free list any more than an allocation
+	 * failure does, so it leaves its sweep to allocating threads and helpers as well.
+	 */
+	virtual bool completeFreelistRebuildRequired(MM_EnvironmentBase *env, SweepCompletionReason *reason);
+
+public:
+	static MM_ConcurrentSweepGC *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_COLLECTOR_CONCURRENTSWEEPGC; }
+
+	virtual bool collectorStartup(MM_GCExtensionsBase* extensions);
+	virtual void collectorShutdown(MM_GCExtensionsBase *extensions);
+
+	virtual void prepareHeapForWalk(MM_EnvironmentBase *env);
+
+	virtual void payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription);
+	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size);
+
+	/**
+	 * Main loop of a background sweep helper thread.
+	 * The helper attaches to the VM when it is first asked to sweep.
+	 * @param omrVM the VM the helper sweeps for
+	 */
+	void sweepHelperEntryPoint(OMR_VM *omrVM);
+	omrthread_monitor_t getSweepHelpersMonitor() { return _sweepHelpersMonitor; }
+
+	MM_ConcurrentSweepGC(MM_EnvironmentBase *env)
+		: MM_ParallelGlobalGC(env)
+		, _sweepHelperThreads(_extensions->concurrentSweepBackground)
+		, _sweepHelpersStarted(0)
+		, _sweepHelpersShutdownCount(0)
+		, _sweepHelpersRequest(SWEEP_HELPER_WAIT)
+		, _sweepHelpersMonitor(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+
+#endif /* CONCURRENTSWEEPGC_HPP_ */
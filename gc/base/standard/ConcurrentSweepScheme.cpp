@@ -36,6 +36,7 @@
 #endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
 #include "HeapMemoryPoolIterator.hpp"
 #include "MemorySubSpace.hpp"
 #include "MemorySubSpaceChildIterator.hpp"
@@ -1188,6 +1189,30 @@ MM_ConcurrentSweepScheme::sweepPool(MM_EnvironmentBase *envModron, MM_MemoryPool
 	return taxPaid;
 }	
 
+/**
+ * Sweep up to a given number of chunks from all pools of the heap.
+ * Used by background sweep helpers, which must return to their caller regularly so that they
+ * do not hold VM access for the duration of the entire sweep.
+ * @note Expects the calling thread to hold VM access.
+ * @param chunkBudget Maximum number of chunks to be swept
+ * @return Number of chunks actually swept, 0 if there is no sweep work left
+ */
+UDATA
+MM_ConcurrentSweepScheme::sweepChunksConcurrently(MM_EnvironmentBase *env, UDATA chunkBudget)
+{
+	UDATA chunksSwept = 0;
+
+	if(isConcurrentSweepActive()) {
+		MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
+		MM_MemoryPool *memoryPool = NULL;
+		while((chunksSwept < chunkBudget) && (NULL != (memoryPool = poolIterator.nextPool()))) {
+			chunksSwept += sweepPool(env, memoryPool, chunkBudget - chunksSwept);
+		}
+	}
+
+	return chunksSwept;
+}
+
 /**
  * Complete the sweep such that all pending chunks have been swept and connected to the appropriate
  * free lists.
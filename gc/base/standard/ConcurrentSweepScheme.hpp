@@ -161,6 +161,7 @@ public:
 	virtual void completeSweep(MM_EnvironmentBase* env, SweepCompletionReason reason);
 	virtual bool sweepForMinimumSize(MM_EnvironmentBase *env, MM_MemorySubSpace *baseMemorySubSpace, MM_AllocateDescription *allocateDescription);
 	bool completeSweepingConcurrently(MM_EnvironmentBase *envModron);
+	UDATA sweepChunksConcurrently(MM_EnvironmentBase *env, UDATA chunkBudget);
 
 	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, UDATA size);
 	void payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace,  MM_AllocateDescription *allocDescriptionn);
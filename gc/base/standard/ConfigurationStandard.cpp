@@ -106,7 +106,7 @@ MM_ConfigurationStandard::initialize(MM_EnvironmentBase* env)
 MM_GlobalCollector*
 MM_ConfigurationStandard::createCollectors(MM_EnvironmentBase* env)
 {
-#if defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_MODRON_CONCCURENT_SWEEP)
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_CONCURRENT_SWEEP)
 	MM_GCExtensionsBase* extensions = env->getExtensions();
 #endif /* OMR_GC_MODRON_CONCURRENT_MARK || OMR_GC_CONCURRENT_SWEEP */
 
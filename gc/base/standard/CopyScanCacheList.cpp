@@ -41,7 +41,10 @@ MM_CopyScanCacheList::initialize(MM_EnvironmentBase *env, volatile uintptr_t *ca
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
 	
-	_sublistCount = extensions->cacheListSplit;
+	if (extensions->scavengerNUMAAware) {
+		_numaNodeCount = OMR_MAX(1, extensions->_numaManager.getAffinityLeaderCount());
+	}
+	_sublistCount = _numaNodeCount * extensions->cacheListSplit;
 	Assert_MM_true(0 < _sublistCount);
 
 	_sublists = (CopyScanCacheSublist *)extensions->getForge()->allocate(
@@ -71,7 +74,7 @@ MM_CopyScanCacheList::reinitializeForRestore(MM_EnvironmentBase *env)
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
 
-	uintptr_t newSublistCount = extensions->cacheListSplit;
+	uintptr_t newSublistCount = _numaNodeCount * extensions->cacheListSplit;
 	Assert_MM_true(0 < newSublistCount);
 
 	if (newSublistCount > _sublistCount) {
@@ -101,7 +104,7 @@ MM_CopyScanCacheList::reinitializeForRestore(MM_EnvironmentBase *env)
 			}
 		}
 	} else {
-		Assert_MM_true(extensions->cacheListSplit == _sublistCount);
+		Assert_MM_true(newSublistCount == _sublistCount);
 	}
 
 	return result;
@@ -363,6 +366,9 @@ MM_CopyScanCacheStandard *
 MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 {
 	uintptr_t index = getSublistIndex(env);
+	/* sublists of the thread's own node come first in the walk (all of them, if not NUMA partitioned) */
+	uintptr_t localSublistCount = _sublistCount / _numaNodeCount;
+	uintptr_t localBase = index - (index % localSublistCount);
 	MM_CopyScanCacheStandard *cache = NULL;
 
 	for (uintptr_t i = 0; i < _sublistCount; i++) {
@@ -383,11 +389,23 @@ MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 			list->_cacheLock.release();
 
 			if (NULL != cache) {
+				if (1 < _numaNodeCount) {
+					if (i < localSublistCount) {
+						env->_scavengerStats._numaLocalCacheCount += 1;
+					} else {
+						env->_scavengerStats._numaRemoteCacheCount += 1;
+					}
+				}
 				break;
 			}
 		}
 
-		index = (index + 1) % _sublistCount;
+		if ((i + 1) < localSublistCount) {
+			index = localBase + ((index - localBase + 1) % localSublistCount);
+		} else {
+			/* local node exhausted, walk the remote nodes starting right after it */
+			index = (localBase + localSublistCount + (i + 1 - localSublistCount)) % _sublistCount;
+		}
 	}
 
 	return cache;
@@ -75,6 +75,7 @@ private:
 	
 	CopyScanCacheSublist *_sublists;	/**< An array of CopyScanCacheSublist structures which is _sublistCount elements long */
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
+	uintptr_t _numaNodeCount; /**< the number of NUMA nodes the sublists are partitioned between (1 unless the scavenger is NUMA-aware). _sublistCount is a multiple of it */
 	
 	MM_CopyScanCacheChunk *_chunkHead; 
 	uintptr_t _incrementEntryCount;
@@ -101,7 +102,16 @@ private:
 	 */
 	uintptr_t getSublistIndex(MM_EnvironmentBase *env)
 	{
-		return env->getEnvironmentId() % _sublistCount;
+		uintptr_t index = 0;
+		if (1 < _numaNodeCount) {
+			/* each node owns a contiguous block of sublists; hash within the block of this thread's node */
+			uintptr_t sublistsPerNode = _sublistCount / _numaNodeCount;
+			uintptr_t node = MM_EnvironmentStandard::getEnvironment(env)->_scavengerNUMANode % _numaNodeCount;
+			index = (node * sublistsPerNode) + (env->getEnvironmentId() % sublistsPerNode);
+		} else {
+			index = env->getEnvironmentId() % _sublistCount;
+		}
+		return index;
 	}
 	
 	/**
@@ -213,6 +223,7 @@ public:
 		, _allocationInHeap(false)
 		, _sublists(NULL)
 		, _sublistCount(0)
+		, _numaNodeCount(1)
 		, _chunkHead(NULL)
 		, _incrementEntryCount(0)
 		, _totalAllocatedEntryCount(0)
@@ -34,6 +34,7 @@
 
 #include "CopyScanCache.hpp"
 #include "ObjectScannerState.hpp"
+#include "ScavengerStats.hpp"
 
 class GC_ObjectScanner;
 
@@ -52,6 +53,7 @@ public:
 	uintptr_t _arraySplitIndex; /**< The index within a split array to start scanning from (meaningful if OMR_COPYSCAN_CACHE_TYPE_SPLIT_ARRAY is set) */
 	uintptr_t _arraySplitAmountToScan; /**< The amount of elements that should be scanned by split array scanning. */
 	omrobjectptr_t* _arraySplitRememberedSlot; /**< A pointer to the remembered set slot a split array came from if applicable. */
+	uintptr_t _numaNode; /**< NUMA node index of the chunk the copy cache memory was carved from, OMR_SCAVENGER_NUMA_NODE_UNBOUND if the memory is not node-local */
 
 	/* Members Function */
 private:
@@ -78,8 +80,9 @@ public:
 	 * reinitializes the cache with the given base and top addresses.
 	 * @param base base address of cache
 	 * @param top top address of cache
+	 * @param numaNode NUMA node index of the cache memory
 	 */
-	void reinitCache(void *base, void *top) {
+	void reinitCache(void *base, void *top, uintptr_t numaNode = OMR_SCAVENGER_NUMA_NODE_UNBOUND) {
 		cacheBase = base;
 		cacheAlloc = base;
 		scanCurrent = base;
@@ -89,6 +92,7 @@ public:
 		_arraySplitRememberedSlot = NULL;
 		_hasPartiallyScannedObject = false;
 		_shouldBeRemembered = false;
+		_numaNode = numaNode;
 	}
 
 	/**
@@ -100,6 +104,7 @@ public:
 		, _arraySplitIndex(0)
 		, _arraySplitAmountToScan(0)
 		, _arraySplitRememberedSlot(NULL)
+		, _numaNode(OMR_SCAVENGER_NUMA_NODE_UNBOUND)
 	{}
 };
 
@@ -66,6 +66,10 @@ public:
 	bool _loaAllocation;  /** true, if tenure TLH remainder is in LOA (TODO: try preventing remainder creation in LOA) */
 	void *_survivorTLHRemainderBase; /**< base and top pointers of the last unused survivor TLH copy cache, that might be reused  on next copy refresh */
 	void *_survivorTLHRemainderTop;
+	uintptr_t _tenureTLHRemainderNUMANode; /**< NUMA node index of the tenure TLH remainder memory, OMR_SCAVENGER_NUMA_NODE_UNBOUND if not node-local */
+	uintptr_t _survivorTLHRemainderNUMANode; /**< NUMA node index of the survivor TLH remainder memory, OMR_SCAVENGER_NUMA_NODE_UNBOUND if not node-local */
+	uintptr_t _scavengerNUMANode; /**< zero-based index of the affinity leader this thread is associated with for NUMA-aware scavenging, refreshed at the start of each scavenge */
+	uintptr_t _scanCacheSizeTarget; /**< upper bound for this thread's copy cache size when adaptive scan cache sizing is enabled, 0 until the thread first participates in a scavenge */
 
 protected:
 
@@ -98,6 +102,10 @@ public:
 		,_loaAllocation(false)
 		,_survivorTLHRemainderBase(NULL)
 		,_survivorTLHRemainderTop(NULL)
+		,_tenureTLHRemainderNUMANode(OMR_SCAVENGER_NUMA_NODE_UNBOUND)
+		,_survivorTLHRemainderNUMANode(OMR_SCAVENGER_NUMA_NODE_UNBOUND)
+		,_scavengerNUMANode(0)
+		,_scanCacheSizeTarget(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -725,7 +725,7 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		uintptr_t totalSize = memorySubSpace->getActiveMemorySize();
 		MM_MemoryPool *memoryPool= memorySubSpace->getMemoryPool();
 		uintptr_t darkMatterBytes = 0;
-		if (!_extensions->concurrentSweep) {
+		if (!_extensions->isConcurrentSweepEnabled()) {
 			darkMatterBytes = memoryPool->getDarkMatterBytes();
 		}
 		uintptr_t freeMemorySize = memoryPool->getActualFreeMemorySize();
@@ -955,9 +955,16 @@ MM_ParallelGlobalGC::markAll(MM_EnvironmentBase *env, bool initMarkMap)
 		env->_cycleState->_referenceObjectOptions |= MM_CycleState::references_soft_as_weak;
 	}
 
-	/* run the mark */
-	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
+	/* run the mark, measuring its parallel efficiency from the stall time the mark task threads merge into the global stats */
+	MM_WorkPacketStats *workPacketStats = &_extensions->globalGCStats.workPacketStats;
+	uint64_t stallTimeBefore = markStats->_syncStallTime + workPacketStats->_workStallTime + workPacketStats->_completeStallTime;
+	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState, MM_ParallelMarkTask::MARK_ALL,
+		_dispatcher->getAdaptivePhaseThreads(MM_ParallelDispatcher::ADAPTIVE_PHASE_GLOBAL_MARK));
+	uint64_t markTaskStartTime = omrtime_hires_clock();
 	_dispatcher->run(env, &markTask);
+	uint64_t markTaskTime = omrtime_hires_clock() - markTaskStartTime;
+	uint64_t stallTimeAfter = markStats->_syncStallTime + workPacketStats->_workStallTime + workPacketStats->_completeStallTime;
+	_dispatcher->recordAdaptivePhaseEfficiency(env, MM_ParallelDispatcher::ADAPTIVE_PHASE_GLOBAL_MARK, markTask.getThreadCount(), markTaskTime, stallTimeAfter - stallTimeBefore);
 	
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 
@@ -1906,10 +1913,8 @@ void
 MM_ParallelGlobalGC::healHeap(MM_EnvironmentBase *env)
 {
 	/* This will heal only the heap slots */
-	_heapWalker->allObjectsDo(env, healReferenceSlots, NULL, 0, false, false);
-	/* Don't have the mark map at the start of gc so we'll have to iterate over
-	 * in a sequential manner
-	 */
+	/* The mark map isn't valid at the start of gc, so the parallel walk is partitioned by sweep chunks */
+	_heapWalker->allObjectsDo(env, healReferenceSlots, NULL, 0, true, false);
 }
 #endif /* defined(OMR_ENV_DATA64) && defined(OMR_GC_FULL_POINTERS) */
 
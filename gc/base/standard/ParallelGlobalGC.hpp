@@ -91,13 +91,6 @@ private:
 	 */
 	void sweep(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool rebuildMarkBits);
 
-	/**
-	 * Answer whether a complete rebuild of freelist should be performed during the sweep phase.
-	 * @return true if sweep work should be completed, false otherwise.
-	 * Also returns the reason why completion of concurrent sweep is required 
-	 */
-	bool completeFreelistRebuildRequired(MM_EnvironmentBase *env, SweepCompletionReason *reason);
-
 #if defined(OMR_GC_MODRON_COMPACTION)
 	/**
 	 * Determine whether a compaction is required or not.
@@ -198,6 +191,13 @@ protected:
 	virtual void internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode);
 	virtual void internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace);
 
+	/**
+	 * Answer whether a complete rebuild of freelist should be performed during the sweep phase.
+	 * @return true if sweep work should be completed, false otherwise.
+	 * Also returns the reason why completion of concurrent sweep is required 
+	 */
+	virtual bool completeFreelistRebuildRequired(MM_EnvironmentBase *env, SweepCompletionReason *reason);
+
 	/**
 	 * Update tuning statistics at end of a concurrent cycle.
 	 *  need this function here empty, a real implementation is in ConcurrentGC
@@ -32,6 +32,7 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HeapMapBulkScanner.hpp"
 #include "HeapMemoryPoolIterator.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "MemoryPool.hpp"
@@ -341,14 +342,7 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = MM_HeapMapBulkScanner::skipEmptySlots(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -811,8 +805,16 @@ MM_ParallelSweepScheme::sweep(MM_EnvironmentBase *env)
 {
 	setupForSweep(env);
 	
-	MM_ParallelSweepTask sweepTask(env,_extensions->dispatcher, this);
-	_extensions->dispatcher->run(env, &sweepTask);
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_ParallelDispatcher *dispatcher = _extensions->dispatcher;
+	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+	uint64_t idleTimeBefore = sweepStats->idleTime;
+
+	MM_ParallelSweepTask sweepTask(env, dispatcher, this, dispatcher->getAdaptivePhaseThreads(MM_ParallelDispatcher::ADAPTIVE_PHASE_GLOBAL_SWEEP));
+	uint64_t sweepTaskStartTime = omrtime_hires_clock();
+	dispatcher->run(env, &sweepTask);
+	uint64_t sweepTaskTime = omrtime_hires_clock() - sweepTaskStartTime;
+	dispatcher->recordAdaptivePhaseEfficiency(env, MM_ParallelDispatcher::ADAPTIVE_PHASE_GLOBAL_SWEEP, sweepTask.getThreadCount(), sweepTaskTime, sweepStats->idleTime - idleTimeBefore);
 }
 
 /**
@@ -60,6 +60,7 @@ class MM_ParallelSweepTask : public MM_ParallelTask
 private:
 protected:
 	MM_ParallelSweepScheme *_sweepScheme;
+	uintptr_t _recommendedThreads; /**< Collector recommended threads for the task */
 
 public:
 	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_SWEEP; };
@@ -74,12 +75,15 @@ public:
 	virtual bool synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *env, const char *id);
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
+	virtual uintptr_t getRecommendedWorkingThreads() { return _recommendedThreads; }
+
 	/**
 	 * Create a ParallelSweepTask object.
 	 */
-	MM_ParallelSweepTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_ParallelSweepScheme *sweepScheme) :
+	MM_ParallelSweepTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_ParallelSweepScheme *sweepScheme, uintptr_t recommendedThreads = UDATA_MAX) :
 		MM_ParallelTask(env, dispatcher),
-		_sweepScheme(sweepScheme)
+		_sweepScheme(sweepScheme),
+		_recommendedThreads(recommendedThreads)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -1247,10 +1247,12 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::expandNoCheck(MM_EnvironmentBase *env
 		if(debug) {
 			omrtty_printf("\tCommit (%p %p)\n", newLowAddress, ((uintptr_t)newLowAddress) + splitExpandSize);
 		}
+		adviseHugePages(env, newLowAddress, splitExpandSize);
 		if(!_heap->commitMemory(newLowAddress, splitExpandSize)) {
 			/* Memory couldn't be commited (for whatever reason) - can't expand */
 			return 0;
 		}
+		collapseHugePages(env, newLowAddress, splitExpandSize);
 		/* The survivor space will have its free list rebuilt - don't bother adding memory */
 		if(debug) {
 			omrtty_printf("\tRemove: allocate(%p %p)\n", freeRangeToTransferBase, (void *)_lowSemiSpaceRegion->getHighAddress());
@@ -1321,10 +1323,12 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::expandNoCheck(MM_EnvironmentBase *env
 		if(debug) {
 			omrtty_printf("\tCommit (%p %p)\n", newLowAddress, ((uintptr_t)newLowAddress)+splitExpandSize);
 		}
+		adviseHugePages(env, newLowAddress, splitExpandSize);
 		if(!_heap->commitMemory(newLowAddress, splitExpandSize)) {
 			/* Memory couldn't be commited (for whatever reason) - can't expand */
 			return 0;
 		}
+		collapseHugePages(env, newLowAddress, splitExpandSize);
 		/* Adjust the high and low segment ranges (high gains at its base, low gives
 		 * way at top and gains at base)
 		 */
@@ -61,6 +61,9 @@
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
 #include "HeapStats.hpp"
+#include "HeapVirtualMemory.hpp"
+#include "Math.hpp"
+#include "MemoryManager.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -82,6 +85,7 @@
 #include "ScavengerRootScanner.hpp"
 #include "ScavengerStats.hpp"
 #include "SlotObject.hpp"
+#include "SlotPrefetchQueue.hpp"
 #include "SublistFragment.hpp"
 #include "SublistIterator.hpp"
 #include "SublistPool.hpp"
@@ -105,6 +109,13 @@
 #define FLIP_TENURE_LARGE_SCAN 4
 #define FLIP_TENURE_LARGE_SCAN_DEFERRED 5
 
+/* Adaptive scan cache sizing controller thresholds (see updateScanCacheSizeTarget()) */
+#define SCAN_CACHE_SIZING_HIGH_STALL_RATIO 0.05
+#define SCAN_CACHE_SIZING_LOW_STALL_RATIO 0.01
+#define SCAN_CACHE_SIZING_HIGH_STEAL_FAILURE_RATIO 0.10
+#define SCAN_CACHE_SIZING_MIN_SCALING_FACTOR 0.9
+#define SCAN_CACHE_SIZING_GROWTH_STEPS 8
+
 /* If scavenger dynamicBreadthFirstScanOrdering and alwaysDepthCopyFirstOffset is enabled, always copy the first offset of each object after the object itself is copied */
 #define DEFAULT_HOT_FIELD_OFFSET 1
 
@@ -243,6 +254,17 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	if (_extensions->scavengerNUMAAware) {
+		for (uintptr_t i = 0; i < OMR_SCAVENGER_NUMA_NODE_BINS; i++) {
+			if (!_survivorNUMAChunks[i]._lock.initialize(env, &_extensions->lnrlOptions, "MM_Scavenger:_survivorNUMAChunks[]._lock")) {
+				return false;
+			}
+			if (!_tenureNUMAChunks[i]._lock.initialize(env, &_extensions->lnrlOptions, "MM_Scavenger:_tenureNUMAChunks[]._lock")) {
+				return false;
+			}
+		}
+	}
+
 
 	/* No thread can use more than _cachesPerThread cache entries at 1 time (flip, tenure, scan, large, possibly deferred)
 	 * So long as (N * _cachesPerThread) cache entries exist,the head of the scan list
@@ -317,6 +339,13 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 		_freeCacheMonitor = NULL;
 	}
 
+	if (_extensions->scavengerNUMAAware) {
+		for (uintptr_t i = 0; i < OMR_SCAVENGER_NUMA_NODE_BINS; i++) {
+			_survivorNUMAChunks[i]._lock.tearDown();
+			_tenureNUMAChunks[i]._lock.tearDown();
+		}
+	}
+
 	J9HookInterface** mmOmrHooks = J9_HOOK_INTERFACE(_extensions->omrHookInterface);
 	/* Unregister hook for global GC end. */
 	(*mmOmrHooks)->J9HookUnregister(mmOmrHooks, J9HOOK_MM_OMR_GLOBAL_GC_START, hookGlobalCollectionStart, (void *)this);
@@ -404,6 +433,16 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 	Assert_MM_true(0 == _cachedEntryCount);
 	_extensions->copyScanRatio.reset(env, true);
 
+	/* Copy caches are carved from node-local chunks only for stop-the-world scavenges, since the chunk tails are
+	 * retired while all GC threads are synchronized at the end of the copy phase */
+	_numaCopyChunkCount = 0;
+	if (_extensions->scavengerNUMAAware && !IS_CONCURRENT_ENABLED) {
+		uintptr_t leaderCount = _extensions->_numaManager.getAffinityLeaderCount();
+		if (1 < leaderCount) {
+			_numaCopyChunkCount = OMR_MIN(leaderCount, (uintptr_t)OMR_SCAVENGER_NUMA_NODE_BINS);
+		}
+	}
+
 	/* Cache heap ranges for fast "valid object" checks (this can change in an expanding heap situation, so we refetch every cycle) */
 	_heapBase = _extensions->heap->getHeapBase();
 	_heapTop = _extensions->heap->getHeapTop();
@@ -442,6 +481,9 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 	_tenureMemorySubSpace->mergeHeapStats(&heapStatsTenureSpace);
 	scavengerStats->_tenureSpaceAllocBytesAcumulation += heapStatsTenureSpace._allocBytes;
 	scavengerStats->_semiSpaceAllocBytesAcumulation += heapStatsSemiSpace._allocBytes;
+	if (_extensions->scavengerPretenuring) {
+		accumulateNurseryAllocationBySizeClass(env);
+	}
 
 	/* Check if scvTenureAdaptiveTenureAge has not been initialized or forced (by cmdline option) */
 	if (0 == _extensions->scvTenureAdaptiveTenureAge) {
@@ -493,6 +535,16 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 	env->_scavengerRememberedSet.fragmentSize = (uintptr_t)OMR_SCV_REMSET_FRAGMENT_SIZE;
 	env->_scavengerRememberedSet.parentList = &_extensions->rememberedSet;
 
+	env->_scavengerNUMANode = calculateScavengerNUMANode(env);
+
+	if (_extensions->adaptiveScanCacheSizing) {
+		/* threads new to the scavenger start from the static maximum and are tuned from there */
+		uintptr_t maxCacheSize = _extensions->scavengerScanCacheMaximumSize;
+		if ((0 == env->_scanCacheSizeTarget) || (maxCacheSize < env->_scanCacheSizeTarget)) {
+			env->_scanCacheSizeTarget = maxCacheSize;
+		}
+	}
+
 	/* caches should all be reset */
 	Assert_MM_true(NULL == env->_survivorCopyScanCache);
 	Assert_MM_true(NULL == env->_tenureCopyScanCache);
@@ -509,6 +561,248 @@ MM_Scavenger::calculateMaxCacheCount(uintptr_t activeMemorySize)
 	return 5 * (activeMemorySize / (_extensions->scavengerScanCacheMaximumSize + _extensions->scavengerScanCacheMinimumSize));
 }
 
+uintptr_t
+MM_Scavenger::calculateScavengerNUMANode(MM_EnvironmentStandard *env)
+{
+	uintptr_t node = 0;
+
+	if (_extensions->scavengerNUMAAware) {
+		uintptr_t leaderCount = 0;
+		J9MemoryNodeDetail const *leaders = _extensions->_numaManager.getAffinityLeaders(&leaderCount);
+		if (1 < leaderCount) {
+			node = env->getWorkerID() % leaderCount;
+			/* node numbers of simulated NUMA leaders are meaningless, so only honour real thread affinity */
+			if (_extensions->_numaManager.isPhysicalNUMASupported()) {
+				uintptr_t affinity = env->getNumaAffinity();
+				if (0 != affinity) {
+					for (uintptr_t i = 0; i < leaderCount; i++) {
+						if (affinity == leaders[i].j9NodeNumber) {
+							node = i;
+							break;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	return node;
+}
+
+bool
+MM_Scavenger::allocateNUMACopyCache(MM_EnvironmentStandard *env, NUMACopyChunk *chunks, MM_MemorySubSpace *subSpace, uintptr_t minimumSize, uintptr_t maximumSize, void* &addrBase, void* &addrTop, uintptr_t *numaNode, bool *loa)
+{
+	uintptr_t localNode = env->_scavengerNUMANode % _numaCopyChunkCount;
+	if (allocateFromNUMACopyChunk(env, &chunks[localNode], localNode, subSpace, minimumSize, maximumSize, addrBase, addrTop, loa, true)) {
+		*numaNode = localNode;
+		return true;
+	}
+
+	/* the subspace could not refill the local chunk, so use up what other nodes have left before falling back to unbound memory */
+	for (uintptr_t i = 1; i < _numaCopyChunkCount; i++) {
+		uintptr_t node = (localNode + i) % _numaCopyChunkCount;
+		if (allocateFromNUMACopyChunk(env, &chunks[node], node, subSpace, minimumSize, maximumSize, addrBase, addrTop, loa, false)) {
+			env->_scavengerStats._numaRemoteChunkAllocations += 1;
+			*numaNode = node;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool
+MM_Scavenger::allocateFromNUMACopyChunk(MM_EnvironmentStandard *env, NUMACopyChunk *chunk, uintptr_t node, MM_MemorySubSpace *subSpace, uintptr_t minimumSize, uintptr_t maximumSize, void* &addrBase, void* &addrTop, bool *loa, bool refill)
+{
+	bool result = false;
+
+	chunk->_lock.acquire();
+
+	uintptr_t available = (uintptr_t)chunk->_top - (uintptr_t)chunk->_alloc;
+	if ((available < minimumSize) && refill) {
+		if (0 != available) {
+			/* the tail is too small for this copy, discard it like any other TLH tail */
+			subSpace->abandonHeapChunk(chunk->_alloc, chunk->_top);
+			if (subSpace == _tenureMemorySubSpace) {
+				env->_scavengerStats._tenureDiscardBytes += available;
+			} else {
+				env->_scavengerStats._flipDiscardBytes += available;
+			}
+		}
+		chunk->_alloc = NULL;
+		chunk->_top = NULL;
+		chunk->_loa = false;
+		available = 0;
+
+		void *chunkBase = NULL;
+		void *chunkTop = NULL;
+		/* chunks are TLHs to the memory pool, so they are bounded by the largest TLH size */
+		uintptr_t chunkSize = OMR_MAX(OMR_MIN(_extensions->scavengerNUMACopyChunkSize, _extensions->tlhMaximumSize), maximumSize);
+		MM_AllocateDescription allocDescription(0, 0, false, true);
+		allocDescription.setCollectorAllocateExpandOnFailure(subSpace == _tenureMemorySubSpace);
+		if (NULL != subSpace->collectorAllocateTLH(env, this, &allocDescription, chunkSize, chunkBase, chunkTop)) {
+			bindNUMACopyChunk(env, node, chunkBase, chunkTop);
+			chunk->_alloc = chunkBase;
+			chunk->_top = chunkTop;
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+			chunk->_loa = allocDescription.isLOAAllocation();
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
+			available = (uintptr_t)chunkTop - (uintptr_t)chunkBase;
+			env->_scavengerStats._numaCopyChunkRefills += 1;
+		}
+	}
+
+	if (available >= minimumSize) {
+		addrBase = chunk->_alloc;
+		addrTop = (void *)((uintptr_t)addrBase + OMR_MIN(available, OMR_MAX(minimumSize, maximumSize)));
+		chunk->_alloc = addrTop;
+		*loa = chunk->_loa;
+		result = true;
+	}
+
+	chunk->_lock.release();
+
+	return result;
+}
+
+void
+MM_Scavenger::bindNUMACopyChunk(MM_EnvironmentStandard *env, uintptr_t node, void *base, void *top)
+{
+	/* node numbers of simulated NUMA leaders are meaningless */
+	if (_extensions->_numaManager.isPhysicalNUMASupported()) {
+		uintptr_t leaderCount = 0;
+		J9MemoryNodeDetail const *leaders = _extensions->_numaManager.getAffinityLeaders(&leaderCount);
+		MM_HeapVirtualMemory *heap = (MM_HeapVirtualMemory *)_extensions->heap;
+		uintptr_t pageSize = heap->getPageSize();
+		uintptr_t alignedBase = MM_Math::roundToCeiling(pageSize, (uintptr_t)base);
+		uintptr_t alignedTop = MM_Math::roundToFloor(pageSize, (uintptr_t)top);
+		if (alignedBase < alignedTop) {
+			_extensions->memoryManager->setNumaAffinity(heap->getVmemHandle(), leaders[node].j9NodeNumber, (void *)alignedBase, alignedTop - alignedBase);
+		}
+	}
+}
+
+void
+MM_Scavenger::abandonNUMACopyChunks(MM_EnvironmentStandard *env)
+{
+	for (uintptr_t node = 0; node < _numaCopyChunkCount; node++) {
+		NUMACopyChunk *chunk = &_survivorNUMAChunks[node];
+		if (chunk->_alloc < chunk->_top) {
+			env->_scavengerStats._flipDiscardBytes += (uintptr_t)chunk->_top - (uintptr_t)chunk->_alloc;
+			_survivorMemorySubSpace->abandonHeapChunk(chunk->_alloc, chunk->_top);
+		}
+		chunk->_alloc = NULL;
+		chunk->_top = NULL;
+
+		chunk = &_tenureNUMAChunks[node];
+		if (chunk->_alloc < chunk->_top) {
+			env->_scavengerStats._tenureDiscardBytes += (uintptr_t)chunk->_top - (uintptr_t)chunk->_alloc;
+			_tenureMemorySubSpace->abandonHeapChunk(chunk->_alloc, chunk->_top);
+		}
+		chunk->_alloc = NULL;
+		chunk->_top = NULL;
+		chunk->_loa = false;
+	}
+}
+
+void
+MM_Scavenger::updateScanCacheSizeTarget(MM_EnvironmentStandard *env)
+{
+	MM_ScavengerStats *scavStats = &env->_scavengerStats;
+	uintptr_t minCacheSize = _extensions->scavengerScanCacheMinimumSize;
+	uintptr_t maxCacheSize = _extensions->scavengerScanCacheMaximumSize;
+	uintptr_t target = env->_scanCacheSizeTarget;
+
+	/* report the target this thread used during the scavenge before adjusting it for the next one */
+	scavStats->_scanCacheSizeTargetCount = 1;
+	scavStats->_scanCacheSizeTargetMin = target;
+	scavStats->_scanCacheSizeTargetMax = target;
+	scavStats->_scanCacheSizeTargetSum = target;
+
+	uint64_t elapsed = scavStats->_endTime - scavStats->_startTime;
+	uint64_t stall = scavStats->_workStallTime + scavStats->_completeStallTime;
+	if ((0 == elapsed) || (stall >= elapsed)) {
+		return;
+	}
+
+	double stallRatio = (double)stall / (double)elapsed;
+	double stealFailureRatio = 0.0;
+	uintptr_t scanListAttempts = scavStats->_workStallCount + scavStats->_acquireScanListCount;
+	if (0 < scanListAttempts) {
+		stealFailureRatio = (double)scavStats->_workStallCount / (double)scanListAttempts;
+	}
+
+	if ((SCAN_CACHE_SIZING_HIGH_STALL_RATIO < stallRatio) || (SCAN_CACHE_SIZING_HIGH_STEAL_FAILURE_RATIO < stealFailureRatio)) {
+		/* thread went idle waiting for scan work: smaller caches are released to the scan list sooner */
+		target /= 2;
+	} else if ((SCAN_CACHE_SIZING_LOW_STALL_RATIO > stallRatio) && (SCAN_CACHE_SIZING_MIN_SCALING_FACTOR <= _scanCacheSizingScalingFactor)) {
+		/* work was plentiful for the whole cycle: grow to cut scan list lock traffic, faster copiers growing faster */
+		double relativeCopyRate = 1.0;
+		if (0.0 < _scanCacheSizingCopyRate) {
+			double copyRate = (double)(scavStats->_flipBytes + scavStats->_tenureAggregateBytes) / (double)(elapsed - stall);
+			relativeCopyRate = OMR_MIN(2.0, OMR_MAX(0.5, copyRate / _scanCacheSizingCopyRate));
+		}
+		target += (uintptr_t)(relativeCopyRate * (double)((maxCacheSize - minCacheSize) / SCAN_CACHE_SIZING_GROWTH_STEPS));
+	}
+
+	target = OMR_MIN(maxCacheSize, OMR_MAX(minCacheSize, target));
+	env->_scanCacheSizeTarget = MM_Math::roundToCeiling(_extensions->getObjectAlignmentInBytes(), target);
+}
+
+void
+MM_Scavenger::calculateScanCacheSizingFeedback(MM_EnvironmentStandard *env)
+{
+	/* average the copy/scan scaling factor over the history of the scavenge that just completed */
+	uintptr_t recordCount = 0;
+	MM_ScavengerCopyScanRatio::UpdateHistory *history = _extensions->copyScanRatio.getHistory(&recordCount);
+	if (0 < recordCount) {
+		double scalingFactorSum = 0.0;
+		for (uintptr_t i = 0; i < recordCount; i++) {
+			scalingFactorSum += _extensions->copyScanRatio.getScalingFactor(env, &history[i]);
+		}
+		_scanCacheSizingScalingFactor = scalingFactorSum / (double)recordCount;
+	} else {
+		_scanCacheSizingScalingFactor = 1.0;
+	}
+
+	/* mean copy rate (bytes per hires tick of busy time) of all participating threads */
+	MM_ScavengerStats *scavengerStats = &_extensions->scavengerStats;
+	uint64_t elapsed = scavengerStats->_endTime - scavengerStats->_startTime;
+	uint64_t stall = scavengerStats->_workStallTime + scavengerStats->_completeStallTime;
+	if (elapsed > stall) {
+		_scanCacheSizingCopyRate = (double)(scavengerStats->_flipBytes + scavengerStats->_tenureAggregateBytes) / (double)(elapsed - stall);
+	} else {
+		_scanCacheSizingCopyRate = 0.0;
+	}
+}
+
+void
+MM_Scavenger::accumulateNurseryAllocationBySizeClass(MM_EnvironmentBase *env)
+{
+	MM_ScavengerStats *scavengerStats = &_extensions->scavengerStats;
+	MM_AllocationStats *allocationStats = &_extensions->allocationStats;
+	for (uintptr_t sizeClass = 0; sizeClass < OMR_ALLOCATION_SIZE_CLASS_BINS; sizeClass++) {
+		scavengerStats->_semiSpaceAllocBytesBySizeClassAcumulation[sizeClass] += allocationStats->_nurseryAllocationBytesBySizeClass[sizeClass];
+	}
+}
+
+void
+MM_Scavenger::updatePretenurePrediction(MM_EnvironmentStandard *env)
+{
+	MM_ScavengerStats *scavengerStats = &_extensions->scavengerStats;
+	uintptr_t previousMask = _pretenurePredictor.getSizeClassMask();
+
+	/* the allocation volume comes from the pool stats, which count every TLH refresh, while the size class samples only see allocations that miss the TLH */
+	uintptr_t nurseryAllocatedBytes = scavengerStats->getFlipHistory(1)->_flipBytes[0];
+	uintptr_t pretenureMask = _pretenurePredictor.update(nurseryAllocatedBytes, scavengerStats->_semiSpaceAllocBytesBySizeClassAcumulation, scavengerStats->_survivedBytesBySizeClass, scavengerStats->_tenureAge, _extensions->scavengerPretenureThreshold);
+	memset(scavengerStats->_semiSpaceAllocBytesBySizeClassAcumulation, 0, sizeof(scavengerStats->_semiSpaceAllocBytesBySizeClassAcumulation));
+
+	if (pretenureMask != previousMask) {
+		Trc_MM_Scavenger_updatePretenurePrediction_maskChanged(env->getLanguageVMThread(), scavengerStats->_gcCount, scavengerStats->_tenureAge, previousMask, pretenureMask);
+	}
+	_extensions->scavengerPretenureSizeClassMask = pretenureMask;
+}
+
 void
 MM_Scavenger::calculateRecommendedWorkingThreads(MM_EnvironmentStandard *env)
 {
@@ -575,12 +869,7 @@ MM_Scavenger::calculateRecommendedWorkingThreads(MM_EnvironmentStandard *env)
 	 *  -------------------------------------------------------------------
 	 */
 	float percentStall = ((float) totalStallTime) / ((float) scavengeTotalTime);
-	float sensitivityFactor = _extensions->adaptiveThreadingSensitivityFactor;
-	float powerExponent = 1.0f / (sensitivityFactor + 1.0f);
-	float stallComponent = (1.0f / percentStall) - 1.0f;
-	float powerBase = (1.0f / sensitivityFactor) * stallComponent;
-
-	float idealThreads = totalThreads * powf(powerBase, powerExponent);
+	float idealThreads = MM_ParallelDispatcher::calculateIdealThreadCount(_extensions, totalThreads, percentStall);
 	float adjustedAverage = MM_Math::weightedAverage((float)totalThreads, idealThreads, _extensions->adaptiveThreadingWeightActiveThreads);
 	_recommendedThreads = (uintptr_t)(adjustedAverage + _extensions->adaptiveThreadBooster);
 
@@ -855,6 +1144,28 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	for (uintptr_t i = 0; i < OMR_SCAVENGER_CACHESIZE_BINS; i++) {
 		finalGCStats->_copy_cachesize_counts[i] += scavStats->_copy_cachesize_counts[i];
 	}
+	for (uintptr_t i = 0; i <= OMR_SCAVENGER_NUMA_NODE_UNBOUND; i++) {
+		finalGCStats->_numaNodeCopiedBytes[i] += scavStats->_numaNodeCopiedBytes[i];
+	}
+	finalGCStats->_numaCopyChunkRefills += scavStats->_numaCopyChunkRefills;
+	finalGCStats->_numaRemoteChunkAllocations += scavStats->_numaRemoteChunkAllocations;
+	if (_extensions->scavengerPretenuring) {
+		for (uintptr_t age = 0; age <= OBJECT_HEADER_AGE_MAX; age++) {
+			for (uintptr_t sizeClass = 0; sizeClass < OMR_ALLOCATION_SIZE_CLASS_BINS; sizeClass++) {
+				finalGCStats->_survivedBytesBySizeClass[age][sizeClass] += scavStats->_survivedBytesBySizeClass[age][sizeClass];
+			}
+		}
+	}
+	finalGCStats->_numaLocalCacheCount += scavStats->_numaLocalCacheCount;
+	finalGCStats->_numaRemoteCacheCount += scavStats->_numaRemoteCacheCount;
+	if (0 != scavStats->_scanCacheSizeTargetCount) {
+		if ((0 == finalGCStats->_scanCacheSizeTargetCount) || (scavStats->_scanCacheSizeTargetMin < finalGCStats->_scanCacheSizeTargetMin)) {
+			finalGCStats->_scanCacheSizeTargetMin = scavStats->_scanCacheSizeTargetMin;
+		}
+		finalGCStats->_scanCacheSizeTargetMax = OMR_MAX(finalGCStats->_scanCacheSizeTargetMax, scavStats->_scanCacheSizeTargetMax);
+		finalGCStats->_scanCacheSizeTargetSum += scavStats->_scanCacheSizeTargetSum;
+		finalGCStats->_scanCacheSizeTargetCount += scavStats->_scanCacheSizeTargetCount;
+	}
 	finalGCStats->_leafObjectCount += scavStats->_leafObjectCount;
 	finalGCStats->_copy_cachesize_sum += scavStats->_copy_cachesize_sum;
 	finalGCStats->_workStallTime += scavStats->_workStallTime;
@@ -885,6 +1196,9 @@ MM_Scavenger::mergeThreadGCStats(MM_EnvironmentBase *env)
 	/* This thread is just about to complete the scavenge task, record the timestamp.
 	 * This must be done before mergeGCStatsBase or else the timestamp won't be mereged as needed by adaptive threading. */
 	env->_scavengerStats._endTime = omrtime_hires_clock();
+	if (_extensions->adaptiveScanCacheSizing && (0 != MM_EnvironmentStandard::getEnvironment(env)->_scanCacheSizeTarget)) {
+		updateScanCacheSizeTarget(MM_EnvironmentStandard::getEnvironment(env));
+	}
 	mergeGCStatsBase(env, &_extensions->incrementScavengerStats, scavStats);
 
 	/* Merge language specific statistics. No known interesting data per increment - they are merged directly to aggregate cycle stats */
@@ -1060,6 +1374,9 @@ MM_Scavenger::calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env)
 {
 	uintptr_t threadCount = _dispatcher->threadCount();
 	uintptr_t maxCacheSize = _extensions->scavengerScanCacheMaximumSize;
+	if (_extensions->adaptiveScanCacheSizing && (0 != env->_scanCacheSizeTarget)) {
+		maxCacheSize = env->_scanCacheSizeTarget;
+	}
 	uintptr_t cacheSize = maxCacheSize;
 	uintptr_t waitingThreads = _waitingCount;
 	if (waitingThreads > 0) {
@@ -1073,7 +1390,7 @@ MM_Scavenger::calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env)
 		cacheSize = OMR_MIN(cacheSizeBasedOnScanCacheCount, cacheSize);
 	}
 
-	env->_scavengerStats.countCopyCacheSize(cacheSize, maxCacheSize);
+	env->_scavengerStats.countCopyCacheSize(cacheSize, _extensions->scavengerScanCacheMaximumSize);
 
 #if defined(J9MODRON_SCAVENGER_TRACE)
     PORT_ACCESS_FROM_ENVIRONMENT(env);
@@ -1165,6 +1482,7 @@ MM_Scavenger::reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, o
 	void* addrTop = NULL;
 	MM_CopyScanCacheStandard *copyCache = NULL;
 	uintptr_t cacheSize = objectReserveSizeInBytes;
+	uintptr_t numaNode = OMR_SCAVENGER_NUMA_NODE_UNBOUND;
 
 	Assert_MM_objectAligned(env, objectReserveSizeInBytes);
 
@@ -1191,6 +1509,7 @@ retry:
 				allocateResult = true;
 				addrBase = env->_survivorTLHRemainderBase;
 				addrTop = env->_survivorTLHRemainderTop;
+				numaNode = env->_survivorTLHRemainderNUMANode;
 				Assert_MM_true(NULL != env->_survivorTLHRemainderBase);
 				env->_survivorTLHRemainderBase = NULL;
 				Assert_MM_true(NULL != env->_survivorTLHRemainderTop);
@@ -1199,19 +1518,31 @@ retry:
 			} else if (_extensions->tlhSurvivorDiscardThreshold < cacheSize) {
 				MM_AllocateDescription allocDescription(cacheSize, 0, false, true);
 
-				addrBase = _survivorMemorySubSpace->collectorAllocate(env, this, &allocDescription);
-				if(NULL != addrBase) {
-					addrTop = (void *)(((uint8_t *)addrBase) + cacheSize);
-					/* Check that there is no overflow */
-					Assert_MM_true(addrTop >= addrBase);
-					allocateResult = true;
+				if (isNUMACopyChunkCandidate(cacheSize)) {
+					bool loa = false;
+					allocateResult = allocateNUMACopyCache(env, _survivorNUMAChunks, _survivorMemorySubSpace, cacheSize, cacheSize, addrBase, addrTop, &numaNode, &loa);
+				}
+				if (!allocateResult) {
+					addrBase = _survivorMemorySubSpace->collectorAllocate(env, this, &allocDescription);
+					if(NULL != addrBase) {
+						addrTop = (void *)(((uint8_t *)addrBase) + cacheSize);
+						/* Check that there is no overflow */
+						Assert_MM_true(addrTop >= addrBase);
+						allocateResult = true;
+					}
 				}
 				env->_scavengerStats._semiSpaceAllocationCountLarge += 1;
 			} else {
 				MM_AllocateDescription allocDescription(0, 0, false, true);
 				/* Update the optimum scan cache size */
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				if (0 != _numaCopyChunkCount) {
+					bool loa = false;
+					allocateResult = allocateNUMACopyCache(env, _survivorNUMAChunks, _survivorMemorySubSpace, cacheSize, scanCacheSize, addrBase, addrTop, &numaNode, &loa);
+				}
+				if (!allocateResult) {
+					allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				}
 				env->_scavengerStats._semiSpaceAllocationCountSmall += 1;
 			}
 		}
@@ -1244,7 +1575,7 @@ retry:
 				/* clear all flags except "allocated in heap" might be set already*/
 				copyCache->flags &= OMR_COPYSCAN_CACHE_TYPE_HEAP;
 				copyCache->flags |= OMR_COPYSCAN_CACHE_TYPE_SEMISPACE | OMR_COPYSCAN_CACHE_TYPE_COPY;
-				copyCache->reinitCache(addrBase, addrTop);
+				copyCache->reinitCache(addrBase, addrTop, numaNode);
 			} else {
 				/* can not allocate a copyCache header, release allocated memory */
 				/* return memory to pool */
@@ -1279,6 +1610,7 @@ MM_Scavenger::reserveMemoryForAllocateInTenureSpace(MM_EnvironmentStandard *env,
 	MM_CopyScanCacheStandard *copyCache = NULL;
 	bool satisfiedInLOA = false;
 	uintptr_t cacheSize = objectReserveSizeInBytes;
+	uintptr_t numaNode = OMR_SCAVENGER_NUMA_NODE_UNBOUND;
 
 	Assert_MM_objectAligned(env, objectReserveSizeInBytes);
 
@@ -1306,6 +1638,7 @@ retry:
 				addrBase = env->_tenureTLHRemainderBase;
 				addrTop = env->_tenureTLHRemainderTop;
 				satisfiedInLOA = env->_loaAllocation;
+				numaNode = env->_tenureTLHRemainderNUMANode;
 				Assert_MM_true(NULL != env->_tenureTLHRemainderBase);
 				env->_tenureTLHRemainderBase = NULL;
 				Assert_MM_true(NULL != env->_tenureTLHRemainderTop);
@@ -1315,31 +1648,41 @@ retry:
 			} else if (_extensions->tlhTenureDiscardThreshold < cacheSize) {
 				MM_AllocateDescription allocDescription(cacheSize, 0, false, true);
 				allocDescription.setCollectorAllocateExpandOnFailure(true);
-				addrBase = _tenureMemorySubSpace->collectorAllocate(env, this, &allocDescription);
-				if(NULL != addrBase) {
-					addrTop = (void *)(((uint8_t *)addrBase) + cacheSize);
-					/* Check that there is no overflow */
-					Assert_MM_true(addrTop >= addrBase);
-					allocateResult = true;
+				if (isNUMACopyChunkCandidate(cacheSize)) {
+					allocateResult = allocateNUMACopyCache(env, _tenureNUMAChunks, _tenureMemorySubSpace, cacheSize, cacheSize, addrBase, addrTop, &numaNode, &satisfiedInLOA);
+				}
+				if (!allocateResult) {
+					addrBase = _tenureMemorySubSpace->collectorAllocate(env, this, &allocDescription);
+					if(NULL != addrBase) {
+						addrTop = (void *)(((uint8_t *)addrBase) + cacheSize);
+						/* Check that there is no overflow */
+						Assert_MM_true(addrTop >= addrBase);
+						allocateResult = true;
 
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
-					if (allocDescription.isLOAAllocation()) {
-						satisfiedInLOA = true;
-					}
+						if (allocDescription.isLOAAllocation()) {
+							satisfiedInLOA = true;
+						}
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
+					}
 				}
 				env->_scavengerStats._tenureSpaceAllocationCountLarge += 1;
 			} else {
 				MM_AllocateDescription allocDescription(0, 0, false, true);
 				allocDescription.setCollectorAllocateExpandOnFailure(true);
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _tenureMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				if (0 != _numaCopyChunkCount) {
+					allocateResult = allocateNUMACopyCache(env, _tenureNUMAChunks, _tenureMemorySubSpace, cacheSize, scanCacheSize, addrBase, addrTop, &numaNode, &satisfiedInLOA);
+				}
+				if (!allocateResult) {
+					allocateResult = (NULL != _tenureMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
 
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
-				if (allocateResult && allocDescription.isLOAAllocation()) {
-					satisfiedInLOA = true;
-				}
+					if (allocateResult && allocDescription.isLOAAllocation()) {
+						satisfiedInLOA = true;
+					}
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
+				}
 				env->_scavengerStats._tenureSpaceAllocationCountSmall += 1;
 			}
 		}
@@ -1378,7 +1721,7 @@ retry:
 					copyCache->flags |= OMR_COPYSCAN_CACHE_TYPE_LOA;
 				}
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
-				copyCache->reinitCache(addrBase, addrTop);
+				copyCache->reinitCache(addrBase, addrTop, numaNode);
 			} else {
 				/* can not allocate a copyCache header, release allocated memory */
 				/* return memory to pool */
@@ -1596,6 +1939,12 @@ MM_Scavenger::forwardingSucceeded(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 		scavStats->_flipBytes += objectCopySizeInBytes;
 		scavStats->getFlipHistory(0)->_flipBytes[oldObjectAge + 1] += objectReserveSizeInBytes;
 	}
+	if (0 != _numaCopyChunkCount) {
+		scavStats->_numaNodeCopiedBytes[copyCache->_numaNode] += objectCopySizeInBytes;
+	}
+	if (_extensions->scavengerPretenuring) {
+		scavStats->_survivedBytesBySizeClass[oldObjectAge][MM_AllocationStats::sizeClassForBytes(objectCopySizeInBytes)] += objectCopySizeInBytes;
+	}
 }
 
 MMINLINE omrobjectptr_t
@@ -2040,13 +2389,43 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	GC_SlotObject *slotObject = NULL;
 
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
-	while (NULL != (slotObject = objectScanner->getNextSlot())) {
-		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
-		shouldRemember |= isSlotObjectInNewSpace;
-		if (NULL != *copyCache) {
-			slotsCopied += 1;
+	if (0 == _extensions->slotPrefetchDepth) {
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
+			shouldRemember |= isSlotObjectInNewSpace;
+			if (NULL != *copyCache) {
+				slotsCopied += 1;
+			}
+			slotsScanned += 1;
+		}
+	} else {
+		/* prefetch the header of each slot target a few slots before copyAndForward() reads/forwards it */
+		MM_SlotPrefetchQueue prefetchQueue(_extensions->slotPrefetchDepth);
+		GC_SlotObject readySlot(_omrVM, NULL);
+		bool isLeaf = false;
+		bool slotsRemaining = true;
+		while (slotsRemaining || !prefetchQueue.isEmpty()) {
+			if (slotsRemaining) {
+				slotObject = objectScanner->getNextSlot();
+				if (NULL != slotObject) {
+					MM_SlotPrefetchQueue::prefetch(slotObject->readReferenceFromSlot());
+					prefetchQueue.push(slotObject, false);
+					if (!prefetchQueue.isFull()) {
+						continue;
+					}
+				} else {
+					slotsRemaining = false;
+					continue;
+				}
+			}
+			prefetchQueue.pop(&readySlot, &isLeaf);
+			bool isSlotObjectInNewSpace = copyAndForward(env, &readySlot);
+			shouldRemember |= isSlotObjectInNewSpace;
+			if (NULL != *copyCache) {
+				slotsCopied += 1;
+			}
+			slotsScanned += 1;
 		}
-		slotsScanned += 1;
 	}
 	updateCopyScanCounts(env, slotsScanned, slotsCopied);
 
@@ -2621,6 +3000,14 @@ MM_Scavenger::workThreadGarbageCollect(MM_EnvironmentStandard *env)
 	abandonSurvivorTLHRemainder(env);
 	abandonTenureTLHRemainder(env, true);
 
+	if (0 != _numaCopyChunkCount) {
+		/* all copying is done once every thread gets here, so the chunk tails can be retired before backout walks the heap */
+		if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+			abandonNUMACopyChunks(env);
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
+	}
+
 	/* If -Xgc:fvtest=forceScavengerBackout has been specified, set backout flag every 3rd scavenge */
 	if(_extensions->fvtest_forceScavengerBackout) {
 		if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
@@ -3496,6 +3883,7 @@ MM_Scavenger::clearCache(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *
 				env->_tenureTLHRemainderBase = cache->cacheAlloc;
 				Assert_MM_true(NULL == env->_tenureTLHRemainderTop);
 				env->_tenureTLHRemainderTop = cache->cacheTop;
+				env->_tenureTLHRemainderNUMANode = cache->_numaNode;
 				env->_loaAllocation = (OMR_COPYSCAN_CACHE_TYPE_LOA == (cache->flags & OMR_COPYSCAN_CACHE_TYPE_LOA));
 			}
 		} else if (0 != (cache->flags & OMR_COPYSCAN_CACHE_TYPE_SEMISPACE)) {
@@ -3510,6 +3898,7 @@ MM_Scavenger::clearCache(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *
 				env->_survivorTLHRemainderBase = cache->cacheAlloc;
 				Assert_MM_true(NULL == env->_survivorTLHRemainderTop);
 				env->_survivorTLHRemainderTop = cache->cacheTop;
+				env->_survivorTLHRemainderNUMANode = cache->_numaNode;
 			}
 		} else {
 			/*
@@ -3731,6 +4120,8 @@ MM_Scavenger::restoreMainThreadTenureTLHRemainders(MM_EnvironmentStandard *env)
 	if ((NULL != _extensions->_mainThreadTenureTLHRemainderTop) && (NULL != _extensions->_mainThreadTenureTLHRemainderBase)){
 		env->_tenureTLHRemainderBase = _extensions->_mainThreadTenureTLHRemainderBase;
 		env->_tenureTLHRemainderTop = _extensions->_mainThreadTenureTLHRemainderTop;
+		/* the node chunk the remainder may have come from is gone, so copies into it are not attributed to a node */
+		env->_tenureTLHRemainderNUMANode = OMR_SCAVENGER_NUMA_NODE_UNBOUND;
 		_extensions->_mainThreadTenureTLHRemainderTop = NULL;
 		_extensions->_mainThreadTenureTLHRemainderBase = NULL;
 	}
@@ -4291,6 +4682,14 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 
 			calculateRecommendedWorkingThreads(env);
 
+			if (_extensions->adaptiveScanCacheSizing) {
+				calculateScanCacheSizingFeedback(env);
+			}
+
+			if (_extensions->scavengerPretenuring) {
+				updatePretenurePrediction(env);
+			}
+
 			/* Merge sublists in the remembered set (if necessary) */
 			_extensions->rememberedSet.compact(env);
 
@@ -4869,6 +5268,9 @@ MM_Scavenger::globalCollectionStart(MM_EnvironmentBase *env)
 
 	scavengerStats->_semiSpaceAllocBytesAcumulation += heapStatsSemiSpace._allocBytes;
 	scavengerStats->_tenureSpaceAllocBytesAcumulation += heapStatsTenureSpace._allocBytes;
+	if (_extensions->scavengerPretenuring) {
+		accumulateNurseryAllocationBySizeClass(env);
+	}
 }
 
 void
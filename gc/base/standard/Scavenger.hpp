@@ -38,10 +38,12 @@
 #include "CopyScanCacheStandard.hpp"
 #include "CycleState.hpp"
 #include "GCExtensionsBase.hpp"
+#include "LightweightNonReentrantLock.hpp"
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 #include "MainGCThread.hpp"
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #include "ScavengerDelegate.hpp"
+#include "ScavengerPretenurePredictor.hpp"
 
 struct J9HookInterface;
 class GC_ObjectScanner;
@@ -110,6 +112,30 @@ private:
 	uintptr_t _minTenureFailureSize;
 	uintptr_t _minSemiSpaceFailureSize;
 	uintptr_t _recommendedThreads; /** Number of threads recommended to the dispatcher for the Scavenge task */
+	double _scanCacheSizingScalingFactor; /**< mean copy/scan scaling factor over the last completed scavenge, consulted by adaptive scan cache sizing */
+	double _scanCacheSizingCopyRate; /**< mean per-thread copy rate (bytes per hires tick of non-stalled time) in the last completed scavenge, 0 if unknown */
+	MM_ScavengerPretenurePredictor _pretenurePredictor; /**< size classes allocated directly in tenure space, maintained only while scavenger pretenuring is enabled */
+
+	/**
+	 * A chunk of survivor or tenure memory shared by the scavenger threads of one NUMA node. The copy caches of those
+	 * threads are carved from it, so objects are copied into memory bound to the copier's node.
+	 */
+	struct NUMACopyChunk {
+		MM_LightweightNonReentrantLock _lock; /**< Lock for carving copy caches from the chunk */
+		void *_alloc; /**< Base of the unused part of the chunk */
+		void *_top; /**< Top of the chunk */
+		bool _loa; /**< true if the chunk was allocated in the LOA (tenure chunks only) */
+
+		NUMACopyChunk()
+			: _alloc(NULL)
+			, _top(NULL)
+			, _loa(false) {
+		}
+	};
+
+	NUMACopyChunk _survivorNUMAChunks[OMR_SCAVENGER_NUMA_NODE_BINS]; /**< per-node survivor chunks, valid only while _numaCopyChunkCount is non-zero */
+	NUMACopyChunk _tenureNUMAChunks[OMR_SCAVENGER_NUMA_NODE_BINS]; /**< per-node tenure chunks, valid only while _numaCopyChunkCount is non-zero */
+	uintptr_t _numaCopyChunkCount; /**< number of nodes copy caches are allocated from in the current scavenge, 0 if copy destinations are not node-local */
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the main cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics;  /** Common collect stats (memory, time etc.) */
@@ -220,6 +246,91 @@ private:
 	 */	
 	uintptr_t calculateMaxCacheCount(uintptr_t activeMemorySize);
 
+	/**
+	 * Determine which NUMA node (index into the affinity leader array) the thread should be associated with
+	 * when distributing scan caches. Threads bound to a physical node use that node, all others are spread
+	 * round-robin by worker ID.
+	 * @return zero-based node index, or 0 if the scavenger is not NUMA-aware
+	 */
+	uintptr_t calculateScavengerNUMANode(MM_EnvironmentStandard *env);
+
+	/**
+	 * Objects above the TLH discard threshold get a copy cache of their exact size. They are carved from the node
+	 * chunks too, as long as they are small enough that discarding a chunk tail for them wastes little.
+	 * @return true if a copy cache of the given size should be carved from a node chunk
+	 */
+	MMINLINE bool
+	isNUMACopyChunkCandidate(uintptr_t size)
+	{
+		return (0 != _numaCopyChunkCount) && (size <= (OMR_MIN(_extensions->scavengerNUMACopyChunkSize, _extensions->tlhMaximumSize) / 8));
+	}
+
+	/**
+	 * Carve a copy cache from the chunk of the thread's NUMA node, refilling the chunk from the subspace when it is too
+	 * small. If the local chunk cannot be refilled, the unused parts of other nodes' chunks are tried before giving up.
+	 * @param chunks the survivor or tenure chunk array
+	 * @param subSpace the subspace the chunks are allocated from
+	 * @param minimumSize the size the copy cache must have at least
+	 * @param maximumSize the preferred copy cache size
+	 * @param[out] addrBase base of the copy cache
+	 * @param[out] addrTop top of the copy cache
+	 * @param[out] numaNode node index of the chunk the copy cache was carved from
+	 * @param[out] loa true if the copy cache is in the LOA
+	 * @return true if a copy cache was carved, false if the caller must allocate it from the subspace
+	 */
+	bool allocateNUMACopyCache(MM_EnvironmentStandard *env, NUMACopyChunk *chunks, MM_MemorySubSpace *subSpace, uintptr_t minimumSize, uintptr_t maximumSize, void* &addrBase, void* &addrTop, uintptr_t *numaNode, bool *loa);
+
+	/**
+	 * Carve a copy cache from a single node chunk.
+	 * @param refill true if the chunk may be refilled from the subspace, false to only use what is left in it
+	 * @see allocateNUMACopyCache
+	 */
+	bool allocateFromNUMACopyChunk(MM_EnvironmentStandard *env, NUMACopyChunk *chunk, uintptr_t node, MM_MemorySubSpace *subSpace, uintptr_t minimumSize, uintptr_t maximumSize, void* &addrBase, void* &addrTop, bool *loa, bool refill);
+
+	/**
+	 * Bind the memory of a freshly allocated chunk to the physical node of the affinity leader. Pages already touched
+	 * stay where they are, so the binding takes effect for the pages first written by the copy.
+	 */
+	void bindNUMACopyChunk(MM_EnvironmentStandard *env, uintptr_t node, void *base, void *top);
+
+	/**
+	 * Retire the unused parts of all node chunks to the subspaces they came from. Called by a single thread once all
+	 * copying of the scavenge is done.
+	 */
+	void abandonNUMACopyChunks(MM_EnvironmentStandard *env);
+
+	/**
+	 * Record the adaptive scan cache size target the thread used in the scavenge just completed and adjust it for
+	 * the next one. The target halves if the thread stalled for scan work or failed to find it too often, and grows
+	 * (scaled by the thread's copy rate relative to the previous scavenge's mean) if the thread barely stalled and the
+	 * copy/scan history of the previous scavenge showed work to spare.
+	 * @note called with gcStatsMutex held, after the thread's end timestamp is taken
+	 */
+	void updateScanCacheSizeTarget(MM_EnvironmentStandard *env);
+
+	/**
+	 * Capture the feedback inputs consumed by updateScanCacheSizeTarget() from a completed scavenge: the mean
+	 * MM_ScavengerCopyScanRatio scaling factor over the scavenge's update history, and the mean thread copy rate.
+	 * Must be called by the main thread after the scavenge completes.
+	 */
+	void calculateScanCacheSizingFeedback(MM_EnvironmentStandard *env);
+
+	/**
+	 * Add the new space allocation bytes recorded per size class since the last collection to the scavenger
+	 * stats accumulation. Called before every scavenge and global collection since both clear the allocation stats.
+	 */
+	void accumulateNurseryAllocationBySizeClass(MM_EnvironmentBase *env);
+
+	/**
+	 * Update the per age and size class survival rates from the scavenge that just completed and recalculate
+	 * the set of size classes allocated directly in tenure space (GCExtensions::scavengerPretenureSizeClassMask).
+	 * A size class is pretenured when the product of its survival rates up to the tenure age reaches
+	 * scavengerPretenureThreshold. It stays pretenured for a number of scavenges that doubles each time it
+	 * qualifies again, and then is sampled in new space for one scavenge to refresh its rates.
+	 * Must be called by the main thread after the scavenge completes successfully.
+	 */
+	void updatePretenurePrediction(MM_EnvironmentStandard *env);
+
 public:
 	/**
 	 * Hook callback. Called when a global collect has started
@@ -961,6 +1072,9 @@ public:
 		, _minTenureFailureSize(UDATA_MAX)
 		, _minSemiSpaceFailureSize(UDATA_MAX)
 		, _recommendedThreads(UDATA_MAX)
+		, _scanCacheSizingScalingFactor(1.0)
+		, _scanCacheSizingCopyRate(0.0)
+		, _numaCopyChunkCount(0)
 		, _cycleState()
 		, _collectionStatistics()
 		, _cachedEntryCount(0)
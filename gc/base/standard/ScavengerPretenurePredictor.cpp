@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "ScavengerPretenurePredictor.hpp"
+
+#include "Math.hpp"
+
+uintptr_t
+MM_ScavengerPretenurePredictor::update(uintptr_t nurseryAllocatedBytes, const uintptr_t *sampledAllocatedBytes, const uintptr_t survivedBytes[][OMR_ALLOCATION_SIZE_CLASS_BINS], uintptr_t tenureAge, uintptr_t thresholdPercent)
+{
+	double threshold = (double)thresholdPercent / 100.0;
+	uintptr_t sampledBytes = 0;
+	uintptr_t sizeClassMask = 0;
+
+	tenureAge = OMR_MIN(tenureAge, (uintptr_t)OBJECT_HEADER_AGE_MAX);
+	for (uintptr_t sizeClass = 0; sizeClass < OMR_ALLOCATION_SIZE_CLASS_BINS; sizeClass++) {
+		sampledBytes += sampledAllocatedBytes[sizeClass];
+	}
+	/* the samples are a subset of the nursery allocation, so they bound it from below */
+	nurseryAllocatedBytes = OMR_MAX(nurseryAllocatedBytes, sampledBytes);
+
+	for (uintptr_t sizeClass = 0; sizeClass < OMR_ALLOCATION_SIZE_CLASS_BINS; sizeClass++) {
+		uintptr_t allocatedBytes = 0;
+		if (0 != sampledAllocatedBytes[sizeClass]) {
+			allocatedBytes = (uintptr_t)((double)nurseryAllocatedBytes * ((double)sampledAllocatedBytes[sizeClass] / (double)sampledBytes));
+		}
+
+		/* age 0 survivors are measured against the bytes allocated since the last scavenge, older ones against the previous scavenge's survivors one age younger */
+		for (uintptr_t age = 0; age <= OBJECT_HEADER_AGE_MAX; age++) {
+			uintptr_t cohortBytes = (0 == age) ? allocatedBytes : _previousSurvivedBytes[age - 1][sizeClass];
+			if (0 != cohortBytes) {
+				double survivalRate = OMR_MIN(1.0, (double)survivedBytes[age][sizeClass] / (double)cohortBytes);
+				_survivalRate[age][sizeClass] = MM_Math::weightedAverage(_survivalRate[age][sizeClass], survivalRate, SCAVENGER_PRETENURE_SURVIVAL_RATE_WEIGHT);
+			}
+		}
+		for (uintptr_t age = 0; age <= OBJECT_HEADER_AGE_MAX; age++) {
+			_previousSurvivedBytes[age][sizeClass] = survivedBytes[age][sizeClass];
+		}
+
+		if (0 != _scavengesRemaining[sizeClass]) {
+			/* pretenured classes allocate in new space only when tenure space is full, so their rates are refreshed once the period ends */
+			_scavengesRemaining[sizeClass] -= 1;
+		} else if (0 != allocatedBytes) {
+			/* an object is tenured by the scavenge after the one it survives at tenure age */
+			double predictedSurvival = 1.0;
+			for (uintptr_t age = 0; age <= tenureAge; age++) {
+				predictedSurvival *= _survivalRate[age][sizeClass];
+			}
+			if (predictedSurvival >= threshold) {
+				_backoff[sizeClass] = (0 == _backoff[sizeClass]) ? SCAVENGER_PRETENURE_INITIAL_SCAVENGES : OMR_MIN(2 * _backoff[sizeClass], (uintptr_t)SCAVENGER_PRETENURE_MAXIMUM_SCAVENGES);
+				_scavengesRemaining[sizeClass] = _backoff[sizeClass];
+			} else {
+				_backoff[sizeClass] = 0;
+			}
+		}
+		if (0 != _scavengesRemaining[sizeClass]) {
+			sizeClassMask |= ((uintptr_t)1 << sizeClass);
+		}
+	}
+
+	_sizeClassMask = sizeClassMask;
+	return sizeClassMask;
+}
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(SCAVENGERPRETENUREPREDICTOR_HPP_)
+#define SCAVENGERPRETENUREPREDICTOR_HPP_
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrgcconsts.h"
+
+#include "AllocationStats.hpp"
+#include "BaseNonVirtual.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#define SCAVENGER_PRETENURE_SURVIVAL_RATE_WEIGHT 0.5 /**< weight of the history when smoothing a survival rate */
+#define SCAVENGER_PRETENURE_INITIAL_SCAVENGES 4 /**< scavenges a size class is pretenured for the first time it qualifies */
+#define SCAVENGER_PRETENURE_MAXIMUM_SCAVENGES 64 /**< upper bound of the doubling pretenure period */
+
+/**
+ * Predicts which object size classes survive to tenure age and should be allocated directly in tenure space.
+ *
+ * After each successful scavenge the survival rate of every age/size class cohort is smoothed, and the predicted
+ * survival to tenure age is the product of those rates. A size class at or above the threshold is pretenured for
+ * a number of scavenges that doubles each time it qualifies again, and is then sampled in new space for one
+ * scavenge to refresh its rates.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ScavengerPretenurePredictor : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+private:
+	double _survivalRate[OBJECT_HEADER_AGE_MAX + 1][OMR_ALLOCATION_SIZE_CLASS_BINS]; /**< smoothed fraction of the bytes of each age and size class that survive one more scavenge */
+	uintptr_t _previousSurvivedBytes[OBJECT_HEADER_AGE_MAX + 1][OMR_ALLOCATION_SIZE_CLASS_BINS]; /**< bytes of each age and size class that survived the previous scavenge */
+	uintptr_t _scavengesRemaining[OMR_ALLOCATION_SIZE_CLASS_BINS]; /**< scavenges left before a pretenured size class is sampled in new space again */
+	uintptr_t _backoff[OMR_ALLOCATION_SIZE_CLASS_BINS]; /**< number of scavenges a size class was last pretenured for, 0 if its last sample did not qualify */
+	uintptr_t _sizeClassMask; /**< bit n set if size class n is currently pretenured */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Fold the results of a successful scavenge into the prediction and recalculate the pretenured size classes.
+	 * The bytes allocated in new space are attributed to size classes in proportion to the sampled allocation
+	 * bytes, since only allocations that miss the inline TLH path are seen by size class.
+	 * @param[in] nurseryAllocatedBytes total bytes allocated in new space since the previous scavenge
+	 * @param[in] sampledAllocatedBytes sampled new space allocation bytes per size class over the same period
+	 * @param[in] survivedBytes bytes copied by the scavenge per pre-scavenge object age and size class
+	 * @param[in] tenureAge the age at which the scavenger currently tenures objects
+	 * @param[in] thresholdPercent predicted percentage of allocated bytes surviving to tenure age at which a size class is pretenured
+	 * @return the new size class mask
+	 */
+	uintptr_t update(uintptr_t nurseryAllocatedBytes, const uintptr_t *sampledAllocatedBytes, const uintptr_t survivedBytes[][OMR_ALLOCATION_SIZE_CLASS_BINS], uintptr_t tenureAge, uintptr_t thresholdPercent);
+
+	/**
+	 * @return the mask of size classes currently pretenured (bit n set for size class n)
+	 */
+	MMINLINE uintptr_t getSizeClassMask() { return _sizeClassMask; }
+
+	/**
+	 * Create a predictor with no survival history and no pretenured size class.
+	 */
+	MM_ScavengerPretenurePredictor()
+		: MM_BaseNonVirtual()
+		, _sizeClassMask(0)
+	{
+		_typeId = __FUNCTION__;
+		memset(_survivalRate, 0, sizeof(_survivalRate));
+		memset(_previousSurvivedBytes, 0, sizeof(_previousSurvivedBytes));
+		memset(_scavengesRemaining, 0, sizeof(_scavengesRemaining));
+		memset(_backoff, 0, sizeof(_backoff));
+	}
+};
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
+#endif /* SCAVENGERPRETENUREPREDICTOR_HPP_ */
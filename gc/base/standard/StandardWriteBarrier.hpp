@@ -29,6 +29,7 @@
 #include "Configuration.hpp"
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
+#include "GlobalCollector.hpp"
 #include "ObjectModel.hpp"
 #include "Scavenger.hpp"
 #include "SlotObject.hpp"
@@ -49,7 +50,7 @@ struct OMR_VMThread;
 MMINLINE void
 standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrobjectptr_t childObject)
 {
-#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_SEGREGATED_HEAP)
 	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -67,7 +68,12 @@ standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrob
 		extensions->cardTable->dirtyCard(env, parentObject);
 	}
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
-#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (extensions->segregatedGenerational) {
+		extensions->getGlobalCollector()->rememberReference(env, parentObject, childObject);
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_SEGREGATED_HEAP) */
 }
 
 /**
@@ -0,0 +1,223 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "CollectionSetSelector.hpp"
+
+#include "omrcomp.h"
+#include "Forge.hpp"
+#include "HeapRegionStateTable.hpp"
+#include "RegionRememberedSet.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace OMR {
+namespace GC {
+
+CollectionSetSelector *CollectionSetSelector::newInstance(Forge *forge, uintptr_t regionCount, uintptr_t regionSize, RegionRememberedSet *rememberedSet)
+{
+	CollectionSetSelector* selector = ::new(forge, AllocationCategory::FIXED, OMR_GET_CALLSITE(), std::nothrow) CollectionSetSelector();
+	if(NULL != selector) {
+		bool success = selector->initialize(forge, regionCount, regionSize, rememberedSet);
+		if (! success) {
+			selector->kill(forge);
+			selector = NULL;
+		}
+	}
+	return selector;
+}
+
+bool
+CollectionSetSelector::initialize(Forge *forge, uintptr_t regionCount, uintptr_t regionSize, RegionRememberedSet *rememberedSet)
+{
+	if ((0 == regionCount) || (0 == regionSize)) {
+		return false;
+	}
+
+	_regionCount = regionCount;
+	_regionSize = regionSize;
+	_rememberedSet = rememberedSet;
+
+	_regions = (RegionData *) forge->allocate(sizeof(RegionData) * regionCount, AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _regions) {
+		return false;
+	}
+	memset(_regions, 0, sizeof(RegionData) * regionCount);
+
+	_candidates = (Candidate *) forge->allocate(sizeof(Candidate) * regionCount, AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _candidates) {
+		return false;
+	}
+
+	_selected = (uintptr_t *) forge->allocate(sizeof(uintptr_t) * regionCount, AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _selected) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+CollectionSetSelector::kill(Forge *forge)
+{
+	tearDown(forge);
+	forge->free(this);
+}
+
+void
+CollectionSetSelector::tearDown(Forge *forge)
+{
+	if (NULL != _selected) {
+		forge->free(_selected);
+		_selected = NULL;
+	}
+	if (NULL != _candidates) {
+		forge->free(_candidates);
+		_candidates = NULL;
+	}
+	if (NULL != _regions) {
+		forge->free(_regions);
+		_regions = NULL;
+	}
+}
+
+void
+CollectionSetSelector::setRegion(uintptr_t regionIndex, RegionKind kind, uintptr_t usedBytes, uintptr_t liveBytes)
+{
+	RegionData *region = &_regions[regionIndex];
+	region->kind = kind;
+	region->usedBytes = usedBytes;
+	/* live bytes estimated from survival rates may exceed what is in use */
+	region->liveBytes = (liveBytes > usedBytes) ? usedBytes : liveBytes;
+}
+
+double
+CollectionSetSelector::predictRegionCost(uintptr_t regionIndex)
+{
+	double cost = _regionOverheadMicros + ((double)_regions[regionIndex].liveBytes / _copyBytesPerMicro);
+	if (NULL != _rememberedSet) {
+		cost += (double)_rememberedSet->getCardCount(regionIndex) / _scanCardsPerMicro;
+	}
+	return cost;
+}
+
+int
+CollectionSetSelector::compareCandidates(const void *element1, const void *element2)
+{
+	const Candidate *candidate1 = (const Candidate *)element1;
+	const Candidate *candidate2 = (const Candidate *)element2;
+
+	/* most efficient first; ties go to the lower region so that selection is deterministic */
+	if (candidate1->efficiency > candidate2->efficiency) {
+		return -1;
+	} else if (candidate1->efficiency < candidate2->efficiency) {
+		return 1;
+	} else if (candidate1->regionIndex < candidate2->regionIndex) {
+		return -1;
+	} else if (candidate1->regionIndex > candidate2->regionIndex) {
+		return 1;
+	}
+	return 0;
+}
+
+uintptr_t
+CollectionSetSelector::select(double pauseTargetMicros, HeapRegionStateTable *stateTable, uint8_t selectedState)
+{
+	uintptr_t candidateCount = 0;
+	double predictedPause = 0.0;
+	double minimumGarbageBytes = _minimumGarbageFraction * (double)_regionSize;
+
+	_selectedCount = 0;
+
+	for (uintptr_t regionIndex = 0; regionIndex < _regionCount; regionIndex++) {
+		RegionData *region = &_regions[regionIndex];
+		if (REGION_REQUIRED == region->kind) {
+			predictedPause += predictRegionCost(regionIndex);
+			_selected[_selectedCount++] = regionIndex;
+		} else if (REGION_CANDIDATE == region->kind) {
+			uintptr_t garbageBytes = region->usedBytes - region->liveBytes;
+			if (((double)garbageBytes >= minimumGarbageBytes) && (0 != garbageBytes)
+				&& ((NULL == _rememberedSet) || !_rememberedSet->isOverflowed(regionIndex))
+			) {
+				Candidate *candidate = &_candidates[candidateCount++];
+				candidate->cost = predictRegionCost(regionIndex);
+				candidate->efficiency = (double)garbageBytes / candidate->cost;
+				candidate->regionIndex = regionIndex;
+			}
+		}
+	}
+
+	J9_SORT(_candidates, candidateCount, sizeof(Candidate), compareCandidates);
+
+	/* take candidates in order of efficiency, skipping those that no longer fit so that cheaper ones can fill the remaining budget */
+	for (uintptr_t i = 0; i < candidateCount; i++) {
+		Candidate *candidate = &_candidates[i];
+		if ((predictedPause + candidate->cost) <= pauseTargetMicros) {
+			predictedPause += candidate->cost;
+			_selected[_selectedCount++] = candidate->regionIndex;
+		}
+	}
+
+	if (NULL != stateTable) {
+		for (uintptr_t i = 0; i < _selectedCount; i++) {
+			stateTable->setRegionStateAtIndex(_selected[i], selectedState);
+		}
+	}
+
+	_predictedPauseMicros = predictedPause;
+	return _selectedCount;
+}
+
+double
+CollectionSetSelector::updateRate(double rate, double measuredRate)
+{
+	return (rate * (1.0 - COLLECTION_SET_SELECTOR_RATE_WEIGHT)) + (measuredRate * COLLECTION_SET_SELECTOR_RATE_WEIGHT);
+}
+
+void
+CollectionSetSelector::recordCopy(uintptr_t copiedBytes, double micros)
+{
+	if ((0 != copiedBytes) && (micros > 0.0)) {
+		_copyBytesPerMicro = updateRate(_copyBytesPerMicro, (double)copiedBytes / micros);
+	}
+}
+
+void
+CollectionSetSelector::recordCardScan(uintptr_t scannedCards, double micros)
+{
+	if ((0 != scannedCards) && (micros > 0.0)) {
+		_scanCardsPerMicro = updateRate(_scanCardsPerMicro, (double)scannedCards / micros);
+	}
+}
+
+void
+CollectionSetSelector::recordRegionOverhead(uintptr_t regionCount, double micros)
+{
+	if (0 != regionCount) {
+		_regionOverheadMicros = updateRate(_regionOverheadMicros, micros / (double)regionCount);
+	}
+}
+
+} // namespace GC
+} // namespace OMR
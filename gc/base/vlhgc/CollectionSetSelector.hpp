@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(COLLECTIONSETSELECTOR_HPP)
+#define COLLECTIONSETSELECTOR_HPP
+
+#include <omrcfg.h>
+
+#include "omrgcconsts.h"
+
+#include "BaseVirtual.hpp"
+
+#include <stdint.h>
+
+/**
+ * Weight given to a new measurement when updating the cost model rates (exponential moving average).
+ */
+#define COLLECTION_SET_SELECTOR_RATE_WEIGHT 0.3
+
+namespace OMR {
+namespace GC {
+
+class Forge;
+class HeapRegionStateTable;
+class RegionRememberedSet;
+
+/**
+ * Chooses the collection set of a region-based evacuating collection so that the predicted
+ * pause stays within a target.
+ *
+ * Required regions (typically eden) are always selected. The remaining candidate regions are
+ * ranked by reclaimable bytes per predicted microsecond of evacuation work (garbage first) and
+ * added while the predicted pause fits the target. The cost of a region is predicted from its
+ * live bytes, the size of its remembered set and a fixed per-region overhead, using rates that
+ * the collector feeds back after each collection. Regions whose remembered set has overflowed
+ * cannot be evacuated independently and are never selected as candidates.
+ *
+ * Only built with OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD, for the downstream concurrent copy forward collector.
+ */
+class CollectionSetSelector : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+  public:
+	enum RegionKind {
+		REGION_UNUSED = 0, /**< free or otherwise not collectable region */
+		REGION_CANDIDATE, /**< region that may be selected if it is worth evacuating */
+		REGION_REQUIRED /**< region that must be part of every collection set */
+	};
+
+  protected:
+  private:
+	struct RegionData {
+		uintptr_t usedBytes; /**< bytes allocated in the region */
+		uintptr_t liveBytes; /**< live (or estimated live) bytes in the region */
+		uintptr_t kind; /**< RegionKind */
+	};
+
+	struct Candidate {
+		double efficiency; /**< garbage bytes reclaimed per predicted microsecond */
+		double cost; /**< predicted microseconds to evacuate the region */
+		uintptr_t regionIndex;
+	};
+
+	RegionData *_regions;
+	Candidate *_candidates; /**< scratch space used to rank candidate regions */
+	uintptr_t *_selected; /**< indices of the regions in the last collection set */
+	uintptr_t _selectedCount;
+	uintptr_t _regionCount;
+	uintptr_t _regionSize;
+	RegionRememberedSet *_rememberedSet; /**< remembered sets used to price card scanning (may be NULL) */
+
+	double _copyBytesPerMicro; /**< predicted evacuation rate */
+	double _scanCardsPerMicro; /**< predicted remembered set card scanning rate */
+	double _regionOverheadMicros; /**< predicted fixed cost of each region in the collection set */
+	double _minimumGarbageFraction; /**< candidates with less garbage than this fraction of the region are never selected */
+	double _predictedPauseMicros; /**< predicted pause of the last collection set */
+
+	/*
+	 * Function members
+	 */
+  public:
+
+	static CollectionSetSelector *newInstance(Forge *forge, uintptr_t regionCount, uintptr_t regionSize, RegionRememberedSet *rememberedSet);
+
+	bool initialize(Forge *forge, uintptr_t regionCount, uintptr_t regionSize, RegionRememberedSet *rememberedSet);
+
+	void kill(Forge *forge);
+
+	void tearDown(Forge *forge);
+
+	/**
+	 * Record the state of a region ahead of selection.
+	 * @param regionIndex index of the region
+	 * @param kind one of RegionKind
+	 * @param usedBytes bytes allocated in the region
+	 * @param liveBytes live bytes in the region, as found by the last mark or estimated from survival rates
+	 */
+	void setRegion(uintptr_t regionIndex, RegionKind kind, uintptr_t usedBytes, uintptr_t liveBytes);
+
+	/**
+	 * @return the predicted microseconds needed to evacuate the region
+	 */
+	double predictRegionCost(uintptr_t regionIndex);
+
+	/**
+	 * Select the collection set for a pause of at most pauseTargetMicros (required regions are
+	 * selected even if they alone exceed the target).
+	 * @param pauseTargetMicros the pause time target
+	 * @param stateTable if not NULL, the state of every selected region is set to selectedState
+	 * @param selectedState the state to set in stateTable
+	 * @return the number of selected regions
+	 */
+	uintptr_t select(double pauseTargetMicros, HeapRegionStateTable *stateTable, uint8_t selectedState);
+
+	MMINLINE uintptr_t *getSelectedRegions() { return _selected; }
+	MMINLINE uintptr_t getSelectedCount() { return _selectedCount; }
+	MMINLINE double getPredictedPauseMicros() { return _predictedPauseMicros; }
+
+	/**
+	 * Feed back the measured cost of the parts of a collection to the cost model.
+	 */
+	void recordCopy(uintptr_t copiedBytes, double micros);
+	void recordCardScan(uintptr_t scannedCards, double micros);
+	void recordRegionOverhead(uintptr_t regionCount, double micros);
+
+	MMINLINE void setMinimumGarbageFraction(double fraction) { _minimumGarbageFraction = fraction; }
+
+	CollectionSetSelector()
+		: _regions(NULL)
+		, _candidates(NULL)
+		, _selected(NULL)
+		, _selectedCount(0)
+		, _regionCount(0)
+		, _regionSize(0)
+		, _rememberedSet(NULL)
+		, _copyBytesPerMicro(1000.0)
+		, _scanCardsPerMicro(20.0)
+		, _regionOverheadMicros(10.0)
+		, _minimumGarbageFraction(0.1)
+		, _predictedPauseMicros(0.0)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+  protected:
+  private:
+	static int compareCandidates(const void *element1, const void *element2);
+	static double updateRate(double rate, double measuredRate);
+};
+
+} // namespace GC
+} // namespace OMR
+
+#endif /* defined(COLLECTIONSETSELECTOR_HPP) */
@@ -94,6 +94,18 @@ class HeapRegionStateTable : public MM_BaseVirtual
 		_table[getIndex(heapAddress)] = state;
 	}
 
+	MMINLINE uint8_t
+	getRegionStateAtIndex(uintptr_t index)
+	{
+		return _table[index];
+	}
+
+	MMINLINE void
+	setRegionStateAtIndex(uintptr_t index, uint8_t state)
+	{
+		_table[index] = state;
+	}
+
   protected:
   private:
 };
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "RegionRememberedSet.hpp"
+
+#include "omrcomp.h"
+#include "Forge.hpp"
+
+#include <cstring>
+
+namespace OMR {
+namespace GC {
+
+RegionRememberedSet *RegionRememberedSet::newInstance(Forge *forge, uintptr_t regionCount, uintptr_t capacity)
+{
+	RegionRememberedSet* rememberedSet = ::new(forge, AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE(), std::nothrow) RegionRememberedSet();
+	if(NULL != rememberedSet) {
+		bool success = rememberedSet->initialize(forge, regionCount, capacity);
+		if (! success) {
+			rememberedSet->kill(forge);
+			rememberedSet = NULL;
+		}
+	}
+	return rememberedSet;
+}
+
+bool
+RegionRememberedSet::initialize(Forge *forge, uintptr_t regionCount, uintptr_t capacity)
+{
+	if ((0 == regionCount) || (0 == capacity)) {
+		return false;
+	}
+
+	_regionCount = regionCount;
+	_capacity = capacity;
+
+	_counts = (volatile uintptr_t *) forge->allocate(sizeof(uintptr_t) * regionCount, AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL == _counts) {
+		return false;
+	}
+	clearAll();
+
+	_cards = (uint32_t *) forge->allocate(sizeof(uint32_t) * regionCount * capacity, AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL == _cards) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+RegionRememberedSet::clearAll()
+{
+	memset((void *)_counts, 0, sizeof(uintptr_t) * _regionCount);
+}
+
+void
+RegionRememberedSet::kill(Forge *forge)
+{
+	tearDown(forge);
+	forge->free(this);
+}
+
+void
+RegionRememberedSet::tearDown(Forge *forge)
+{
+	if (NULL != _cards) {
+		forge->free(_cards);
+		_cards = NULL;
+	}
+	if (NULL != _counts) {
+		forge->free((void *)_counts);
+		_counts = NULL;
+	}
+}
+
+} // namespace GC
+} // namespace OMR
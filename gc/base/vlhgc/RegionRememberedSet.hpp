@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(REGIONREMEMBEREDSET_HPP)
+#define REGIONREMEMBEREDSET_HPP
+
+#include <omrcfg.h>
+
+#include "omrgcconsts.h"
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+
+#include <stdint.h>
+
+namespace OMR {
+namespace GC {
+
+class Forge;
+
+/**
+ * Per-region remembered set for a region-based evacuating collector. Each region owns a
+ * bounded list of the cards, outside the region, which hold references into it, so that
+ * evacuating the region only requires scanning those cards rather than the whole heap.
+ *
+ * Cards are appended lock free by the write barrier / card cleaning threads. When a list
+ * fills up the region is marked overflowed and must not be evacuated independently (it
+ * would need a full heap scan to find its referents).
+ *
+ * Card indices are stored as 32-bit values, which covers heaps of up to 2^32 cards.
+ *
+ * Only built with OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD, for the downstream concurrent copy forward collector.
+ */
+class RegionRememberedSet : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+  public:
+  protected:
+  private:
+	uint32_t *_cards; /**< regionCount lists of _capacity card indices */
+	volatile uintptr_t *_counts; /**< per region card count; greater than _capacity once the region has overflowed */
+	uintptr_t _regionCount;
+	uintptr_t _capacity; /**< maximum number of cards remembered for a region */
+
+	/*
+	 * Function members
+	 */
+  public:
+
+	static RegionRememberedSet *newInstance(Forge *forge, uintptr_t regionCount, uintptr_t capacity);
+
+	bool initialize(Forge *forge, uintptr_t regionCount, uintptr_t capacity);
+
+	void kill(Forge *forge);
+
+	void tearDown(Forge *forge);
+
+	RegionRememberedSet()
+		: _cards(NULL)
+		, _counts(NULL)
+		, _regionCount(0)
+		, _capacity(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	/**
+	 * Remember that card cardIndex holds a reference into region regionIndex. Consecutive
+	 * duplicates are filtered; other duplicates are tolerated and removed by the consumer.
+	 */
+	MMINLINE void
+	remember(uintptr_t regionIndex, uint32_t cardIndex)
+	{
+		uintptr_t count = _counts[regionIndex];
+		if (count <= _capacity) {
+			uint32_t *cards = &_cards[regionIndex * _capacity];
+			if ((0 != count) && (cardIndex == cards[count - 1])) {
+				return;
+			}
+			/* once the count passes _capacity the region is overflowed and stays that way until cleared */
+			uintptr_t slot = MM_AtomicOperations::add(&_counts[regionIndex], 1) - 1;
+			if (slot < _capacity) {
+				cards[slot] = cardIndex;
+			}
+		}
+	}
+
+	MMINLINE bool isOverflowed(uintptr_t regionIndex) { return _counts[regionIndex] > _capacity; }
+
+	/**
+	 * @return the number of cards remembered for the region (the remembered cards are
+	 * incomplete if the region has overflowed)
+	 */
+	MMINLINE uintptr_t
+	getCardCount(uintptr_t regionIndex)
+	{
+		uintptr_t count = _counts[regionIndex];
+		return (count > _capacity) ? _capacity : count;
+	}
+
+	MMINLINE uint32_t *getCards(uintptr_t regionIndex) { return &_cards[regionIndex * _capacity]; }
+
+	MMINLINE void clear(uintptr_t regionIndex) { _counts[regionIndex] = 0; }
+
+	void clearAll();
+
+	MMINLINE uintptr_t getRegionCount() { return _regionCount; }
+	MMINLINE uintptr_t getCapacity() { return _capacity; }
+
+  protected:
+  private:
+};
+
+} // namespace GC
+} // namespace OMR
+
+#endif /* defined(REGIONREMEMBEREDSET_HPP) */
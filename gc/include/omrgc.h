@@ -42,6 +42,9 @@ omrobjectptr_t OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, uintptr_t alloc
 
 omr_error_t OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode);
 
+/* Write the allocation samples gathered so far (-Xgc:allocationSamplingInterval=) to fileName in collapsed stack format and reset them */
+omr_error_t OMR_GC_WriteAllocationProfile(OMR_VMThread* omrVMThread, const char *fileName);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
@@ -25,6 +25,7 @@
 #include "objectdescription.h"
 
 #include "AllocateInitialization.hpp"
+#include "AllocationProfiler.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
@@ -46,6 +47,21 @@ OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, uintptr_t allocationCategory,
 	return OMR_GC_AllocateObject(omrVMThread, &allocator);
 }
 
+omr_error_t
+OMR_GC_WriteAllocationProfile(OMR_VMThread* omrVMThread, const char *fileName)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_AllocationProfiler *profiler = env->getExtensions()->allocationProfiler;
+	omr_error_t result = OMR_ERROR_NONE;
+
+	if (NULL == profiler) {
+		result = OMR_ERROR_NOT_AVAILABLE;
+	} else if (!profiler->drain(env, fileName)) {
+		result = OMR_ERROR_FILE_UNAVAILABLE;
+	}
+	return result;
+}
+
 omr_error_t
 OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode)
 {
@@ -26,6 +26,7 @@
 #include "objectdescription.h"
 
 #include "AllocateDescription.hpp"
+#include "AllocationProfiler.hpp"
 #include "AtomicOperations.hpp"
 #include "Collector.hpp"
 #include "CollectorLanguageInterface.hpp"
@@ -191,6 +192,15 @@ heapCreationHelper(OMR_VM *omrVM, MM_StartupManager *startupManager, bool create
 		extensions->verboseGCManager->setInitializedTime(omrtime_hires_clock());
 	}
 
+	if (0 != extensions->allocationSamplingInterval) {
+		extensions->allocationProfiler = MM_AllocationProfiler::newInstance(&envBase, startupManager->getAllocationProfileFileName());
+		if (NULL == extensions->allocationProfiler) {
+			omrtty_printf("Failed to create allocation profiler.\n");
+			rc = OMR_ERROR_INTERNAL;
+			goto done;
+		}
+	}
+
 done:
 	return rc;
 }
@@ -330,6 +340,12 @@ OMR_GC_ShutdownHeap(OMR_VM *omrVM)
 			extensions->verboseGCManager = NULL;
 		}
 
+		if (NULL != extensions->allocationProfiler) {
+			/* writes the profile if -Xgc:allocationProfileFile= was specified */
+			extensions->allocationProfiler->kill(&env);
+			extensions->allocationProfiler = NULL;
+		}
+
 		if (NULL != extensions->configuration) {
 			extensions->configuration->kill(&env);
 		}
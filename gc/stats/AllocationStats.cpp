@@ -47,6 +47,11 @@ MM_AllocationStats::clear()
 	_discardedBytes = 0;
 	_allocationSearchCount = 0;
 	_allocationSearchCountMax = 0;
+	_allocationSampleCount = 0;
+	_allocationSampledBytes = 0;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	memset(_nurseryAllocationBytesBySizeClass, 0, sizeof(_nurseryAllocationBytesBySizeClass));
+#endif /* OMR_GC_MODRON_SCAVENGER */
 }
 
 void
@@ -79,6 +84,15 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 	MM_AtomicOperations::add(&_continuationObjectCount, stats->_continuationObjectCount);
 	MM_AtomicOperations::add(&_discardedBytes, stats->_discardedBytes);
 	MM_AtomicOperations::add(&_allocationSearchCount, stats->_allocationSearchCount);
+	MM_AtomicOperations::add(&_allocationSampleCount, stats->_allocationSampleCount);
+	MM_AtomicOperations::add(&_allocationSampledBytes, stats->_allocationSampledBytes);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	for (uintptr_t sizeClass = 0; sizeClass < OMR_ALLOCATION_SIZE_CLASS_BINS; sizeClass++) {
+		if (0 != stats->_nurseryAllocationBytesBySizeClass[sizeClass]) {
+			MM_AtomicOperations::add(&_nurseryAllocationBytesBySizeClass[sizeClass], stats->_nurseryAllocationBytesBySizeClass[sizeClass]);
+		}
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
 	/* looping to set a maximum value in _tlhMaxAbandonedListSize */
 	for (
 			uintptr_t prevMax = _allocationSearchCountMax;
@@ -23,10 +23,18 @@
 #if !defined(ALLOCATIONSTATS_HPP_)
 #define ALLOCATIONSTATS_HPP_
 
+#include <string.h>
+
 #include "omrcfg.h"
 #include "omrcomp.h"
 
 #include "Base.hpp"
+#include "Math.hpp"
+
+/**
+ * Number of power-of-two object size classes tracked for nursery allocation (class n holds sizes in [2^n, 2^(n+1)) bytes)
+ */
+#define OMR_ALLOCATION_SIZE_CLASS_BINS 32
 
 class MM_AllocationStats : public MM_Base
 {
@@ -54,12 +62,28 @@ public:
 	uintptr_t _discardedBytes;
 	uintptr_t _allocationSearchCount;
 	uintptr_t _allocationSearchCountMax;
+	uintptr_t _allocationSampleCount; /**< Number of allocations sampled by the allocation profiler */
+	uintptr_t _allocationSampledBytes; /**< Bytes allocated that are represented by the sampled allocations */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	uintptr_t _nurseryAllocationBytesBySizeClass[OMR_ALLOCATION_SIZE_CLASS_BINS]; /**< Bytes allocated in new space per object size class (recorded only while scavenger pretenuring is enabled) */
+#endif /* OMR_GC_MODRON_SCAVENGER */
 
 	void clear();
 	void clearOwnableSynchronizer() { _ownableSynchronizerObjectCount = 0; }
 	void clearContinuation() { _continuationObjectCount = 0; }
 	void merge(MM_AllocationStats * stats);
 
+	/**
+	 * Map an object size to its power-of-two size class.
+	 * @param[in] sizeInBytes the object size (must be non-zero)
+	 * @return the size class index, saturated to the last bin
+	 */
+	MMINLINE static uintptr_t
+	sizeClassForBytes(uintptr_t sizeInBytes)
+	{
+		return OMR_MIN(MM_Math::floorLog2(sizeInBytes), OMR_ALLOCATION_SIZE_CLASS_BINS - 1);
+	}
+
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 	uintptr_t tlhBytesAllocated() { return _tlhAllocatedFresh - _tlhDiscardedBytes; }
 	uintptr_t tlhBytesAllocatedUsed() { return _tlhAllocatedUsed; }
@@ -105,8 +129,14 @@ public:
 		_continuationObjectCount(0),
 		_discardedBytes(0),
 		_allocationSearchCount(0),
-		_allocationSearchCountMax(0)
-	{}
+		_allocationSearchCountMax(0),
+		_allocationSampleCount(0),
+		_allocationSampledBytes(0)
+	{
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		memset(_nurseryAllocationBytesBySizeClass, 0, sizeof(_nurseryAllocationBytesBySizeClass));
+#endif /* OMR_GC_MODRON_SCAVENGER */
+	}
 };
 
 #endif /* ALLOCATIONSTATS_HPP_ */
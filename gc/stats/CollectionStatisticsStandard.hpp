@@ -61,6 +61,8 @@ public:
 	uint32_t _tenureFragmentation; /**< fragmentation indicator, can be NO_FRAGMENTATION, MICRO_FRAGMENTATION, MACRO_FRAGMENTATION, indicate if fragmentation info are ready in _microFragmentedSize and _macroFragmentedSize */
 	uintptr_t _microFragmentedSize; /**< Micro Fragmentation in Byte */
 	uintptr_t _macroFragmentedSize; /**< Macro Fragmentation in Byte*/
+	uintptr_t _freeListIndexHits; /**< Tenure free list searches that started from the free list size index */
+	uintptr_t _freeListIndexMisses; /**< Tenure free list searches for which the free list size index had no usable entry */
 private:
 protected:
 public:
@@ -128,6 +130,16 @@ public:
 			stats->_microFragmentedSize = 0;
 			stats->_macroFragmentedSize = 0;
 		}
+
+		MM_MemorySubSpace *tenureMemorySubspace = extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace();
+		MM_MemoryPool *tenureMemoryPool = (NULL == tenureMemorySubspace) ? NULL : tenureMemorySubspace->getMemoryPool();
+		if (NULL != tenureMemoryPool) {
+			stats->_freeListIndexHits = tenureMemoryPool->getFreeListIndexHits();
+			stats->_freeListIndexMisses = tenureMemoryPool->getFreeListIndexMisses();
+		} else {
+			stats->_freeListIndexHits = 0;
+			stats->_freeListIndexMisses = 0;
+		}
 	}
 
 	/* Reset both Macro and Micro Fragmentation Stats after compact */
@@ -163,6 +175,8 @@ public:
 		, _tenureFragmentation(NO_FRAGMENTATION)
 		, _microFragmentedSize(0)
 		, _macroFragmentedSize(0)
+		, _freeListIndexHits(0)
+		, _freeListIndexMisses(0)
 	{};
 };
 
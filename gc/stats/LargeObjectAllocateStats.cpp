@@ -201,6 +201,8 @@ MM_LargeObjectAllocateStats::resetCurrent()
 {
 	spaceSavingClear(_spaceSavingSizes);
 	spaceSavingClear(_spaceSavingSizeClasses);
+	_freeListIndexHits = 0;
+	_freeListIndexMisses = 0;
 }
 
 void
@@ -248,6 +250,9 @@ MM_LargeObjectAllocateStats::mergeCurrent(MM_LargeObjectAllocateStats *statsToMe
 	for(i = 0; i < spaceSavingGetCurSize(spaceSavingToMerge); i++ ){
 		spaceSavingUpdate(_spaceSavingSizeClasses, spaceSavingGetKthMostFreq(spaceSavingToMerge, i + 1), spaceSavingGetKthMostFreqCount(spaceSavingToMerge, i + 1));
 	}
+
+	_freeListIndexHits += statsToMerge->_freeListIndexHits;
+	_freeListIndexMisses += statsToMerge->_freeListIndexMisses;
 }
 
 void
@@ -68,6 +68,8 @@ private:
 	uint64_t _timeEstimateFragmentation;					 /**< The amount of time spent for estimating Fragmentation */
 	uint64_t _cpuTimeEstimateFragmentation;					 /**< The amount of cputime spent for estimating Fragmentation */
 	uint64_t _timeMergeAverage;								 /**< The amount of time spent for merging and averaging LargeAllocateStats */
+	uintptr_t _freeListIndexHits;	/**< Free list searches that started from the free list size index */
+	uintptr_t _freeListIndexMisses;	/**< Free list searches for which the size index had no usable entry */
 	uintptr_t _remainingFreeMemoryAfterEstimate;			 /**< result of estimateFragmentation */
 	uintptr_t _freeMemoryBeforeEstimate;					 /**< initial free memory before estimateFragmentation */
 	uintptr_t _maxHeapSize;
@@ -215,6 +217,10 @@ public:
 	uint64_t getTimeMergeAverage() { return _timeMergeAverage; }
 	void setTimeMergeAverage(uint64_t time) { _timeMergeAverage = time; }
 	void addTimeMergeAverage(uint64_t time) { _timeMergeAverage += time; }
+	void incrementFreeListIndexHits() { _freeListIndexHits += 1; }
+	void incrementFreeListIndexMisses() { _freeListIndexMisses += 1; }
+	uintptr_t getFreeListIndexHits() { return _freeListIndexHits; }
+	uintptr_t getFreeListIndexMisses() { return _freeListIndexMisses; }
 	uintptr_t getRemainingFreeMemoryAfterEstimate() { return _remainingFreeMemoryAfterEstimate; }
 	void resetRemainingFreeMemoryAfterEstimate() { _remainingFreeMemoryAfterEstimate= 0; }
 	uintptr_t getFreeMemoryBeforeEstimate() { return _freeMemoryBeforeEstimate; }
@@ -243,6 +249,8 @@ public:
 		_timeEstimateFragmentation(0),
 		_cpuTimeEstimateFragmentation(0),
 		_timeMergeAverage(0),
+		_freeListIndexHits(0),
+		_freeListIndexMisses(0),
 		_remainingFreeMemoryAfterEstimate(0),
 		_freeMemoryBeforeEstimate(0),
 		_maxHeapSize(0),
@@ -91,6 +91,14 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_tenureExpandedTime(0)
 	,_leafObjectCount(0)
 	,_copy_cachesize_sum(0)
+	,_numaCopyChunkRefills(0)
+	,_numaRemoteChunkAllocations(0)
+	,_numaLocalCacheCount(0)
+	,_numaRemoteCacheCount(0)
+	,_scanCacheSizeTargetCount(0)
+	,_scanCacheSizeTargetMin(0)
+	,_scanCacheSizeTargetMax(0)
+	,_scanCacheSizeTargetSum(0)
 	,_slotsCopied(0)
 	,_slotsScanned(0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -100,8 +108,11 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_flipHistoryNewIndex(0)
 {
 	memset(_flipHistory, 0, sizeof(_flipHistory));
+	memset(_semiSpaceAllocBytesBySizeClassAcumulation, 0, sizeof(_semiSpaceAllocBytesBySizeClassAcumulation));
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
+	memset(_numaNodeCopiedBytes, 0, sizeof(_numaNodeCopiedBytes));
+	memset(_survivedBytesBySizeClass, 0, sizeof(_survivedBytesBySizeClass));
 }
 
 struct MM_ScavengerStats::FlipHistory*
@@ -209,8 +220,18 @@ MM_ScavengerStats::clear(bool firstIncrement)
 
 	_leafObjectCount = 0;
 	_copy_cachesize_sum = 0;
+	_numaCopyChunkRefills = 0;
+	_numaRemoteChunkAllocations = 0;
+	_numaLocalCacheCount = 0;
+	_numaRemoteCacheCount = 0;
+	_scanCacheSizeTargetCount = 0;
+	_scanCacheSizeTargetMin = 0;
+	_scanCacheSizeTargetMax = 0;
+	_scanCacheSizeTargetSum = 0;
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
+	memset(_numaNodeCopiedBytes, 0, sizeof(_numaNodeCopiedBytes));
+	memset(_survivedBytesBySizeClass, 0, sizeof(_survivedBytesBySizeClass));
 }
 
 bool
@@ -32,10 +32,13 @@ class MM_EnvironmentBase;
 #include "modronopt.h"
 #include "objectdescription.h"
 
+#include "AllocationStats.hpp"
 #include "Math.hpp"
 
 #define OMR_SCAVENGER_DISTANCE_BINS 32
 #define OMR_SCAVENGER_CACHESIZE_BINS 16
+#define OMR_SCAVENGER_NUMA_NODE_BINS 8
+#define OMR_SCAVENGER_NUMA_NODE_UNBOUND OMR_SCAVENGER_NUMA_NODE_BINS
 
 #define SCAVENGER_FLIP_HISTORY_SIZE 16
 
@@ -131,6 +134,7 @@ public:
 
 	uintptr_t _semiSpaceAllocBytesAcumulation; /**< Bytes allocated in new space between scavenges, updated on global collects. */
 	uintptr_t _tenureSpaceAllocBytesAcumulation; /**< Bytes allocated in tenure space between scavenges, updated on global collects. */
+	uintptr_t _semiSpaceAllocBytesBySizeClassAcumulation[OMR_ALLOCATION_SIZE_CLASS_BINS]; /**< Bytes allocated in new space per size class between scavenges, updated on global collects (only while pretenuring is enabled). */
 
 	uintptr_t _semiSpaceAllocationCountLarge;
 	uintptr_t _semiSpaceAllocationCountSmall;
@@ -146,6 +150,19 @@ public:
 	uint64_t _copy_cachesize_counts[OMR_SCAVENGER_CACHESIZE_BINS];
 	uint64_t _copy_cachesize_sum;
 
+	uintptr_t _numaNodeCopiedBytes[OMR_SCAVENGER_NUMA_NODE_BINS + 1]; /**< Bytes copied (flipped and tenured) into memory of each NUMA node, the last bin counts copies into memory that is not node-local */
+	uintptr_t _numaCopyChunkRefills; /**< Number of node copy chunks allocated from the survivor and tenure subspaces */
+	uintptr_t _numaRemoteChunkAllocations; /**< Number of copy caches carved from the chunk of another NUMA node because the local chunk could not be refilled */
+	uintptr_t _numaLocalCacheCount; /**< Number of scan/free caches acquired from a sublist of the acquiring thread's own NUMA node */
+	uintptr_t _numaRemoteCacheCount; /**< Number of scan/free caches acquired from a sublist of another NUMA node */
+
+	uintptr_t _survivedBytesBySizeClass[OBJECT_HEADER_AGE_MAX+1][OMR_ALLOCATION_SIZE_CLASS_BINS]; /**< Bytes copied (flipped and tenured) per pre-scavenge object age and size class (only while pretenuring is enabled) */
+
+	uintptr_t _scanCacheSizeTargetCount; /**< Number of threads that reported an adaptive scan cache size target */
+	uintptr_t _scanCacheSizeTargetMin; /**< Smallest adaptive scan cache size target used by a thread (valid only if _scanCacheSizeTargetCount is non-zero) */
+	uintptr_t _scanCacheSizeTargetMax; /**< Largest adaptive scan cache size target used by a thread */
+	uint64_t _scanCacheSizeTargetSum; /**< Sum of the adaptive scan cache size targets used by all reporting threads */
+
 	uint64_t _slotsCopied; /**< The number of slots copied by the thread since _slotsScanned was last sampled and reset */
 	uint64_t _slotsScanned; /**< The number of slots scanned by the thread since _slotsCopied was last sampled and reset */
 	
@@ -47,6 +47,8 @@ public:
 	uintptr_t workPacketsAcquired;
 	uintptr_t workPacketsReleased;
 	uintptr_t workPacketsExchanged; /**< The number of output packets converted into input packets without being returned to the shared pool first */
+	uintptr_t workStealAttempts; /**< The number of steals attempted from other threads' marking deques (markingWorkStealing only) */
+	uintptr_t workStealSuccesses; /**< The number of attempted steals that returned an object */
 	uintptr_t _workStallCount; /**< The number of times the thread stalled, and subsequently received more work */
 	uintptr_t _completeStallCount; /**< The number of times the thread stalled, and waited for all other threads to complete working */
 	uint64_t _workStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting to receive more work */
@@ -73,6 +75,8 @@ public:
 		workPacketsAcquired = 0;
 		workPacketsReleased = 0;
 		workPacketsExchanged = 0;
+		workStealAttempts = 0;
+		workStealSuccesses = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -91,6 +95,8 @@ public:
 		workPacketsAcquired += statsToMerge->workPacketsAcquired;
 		workPacketsReleased += statsToMerge->workPacketsReleased;
 		workPacketsExchanged += statsToMerge->workPacketsExchanged;
+		workStealAttempts += statsToMerge->workStealAttempts;
+		workStealSuccesses += statsToMerge->workStealSuccesses;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -147,6 +153,8 @@ public:
 		,workPacketsAcquired(0)
 		,workPacketsReleased(0)
 		,workPacketsExchanged(0)
+		,workStealAttempts(0)
+		,workStealSuccesses(0)
 		,_workStallCount(0)
 		,_completeStallCount(0)
 		,_workStallTime(0)
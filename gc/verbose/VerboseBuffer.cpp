@@ -28,6 +28,7 @@
 
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "VerboseEventStream.hpp"
 
 #define INDENT_SPACER "  "
 
@@ -148,8 +149,8 @@ MM_VerboseBuffer::ensureCapacity(MM_EnvironmentBase *env, uintptr_t spaceNeeded)
 			_bufferTop = _buffer + newSize;
 			reset();
 		
-			/* Copy across the contents of the old buffer */
-			strcpy(_buffer, oldBuffer);
+			/* Copy across the contents of the old buffer, which are binary when recording events */
+			memcpy(_buffer, oldBuffer, currentSize + 1);
 			_bufferAlloc += currentSize;
 				
 			/* Delete the old buffer */
@@ -216,6 +217,11 @@ MM_VerboseBuffer::formatAndOutputV(MM_EnvironmentBase *env, uintptr_t indent, co
 	/* Ensure we have a  buffer. */
 	Assert_VGC_true(NULL != _buffer);
 
+	if (_recordEvents) {
+		recordEvent(env, indent, format, args);
+		return;
+	}
+
 	for (uintptr_t i = 0; i < indent; ++i) {
 		add(env, INDENT_SPACER);
 	}
@@ -232,3 +238,91 @@ MM_VerboseBuffer::formatAndOutput(MM_EnvironmentBase *env, uintptr_t indent, con
 	formatAndOutputV(env, indent, format, args);
 	va_end(args);
 }
+
+bool
+MM_VerboseBuffer::recordEvent(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	bool result = true;
+
+	Assert_VGC_true('\0' == _bufferAlloc[0]);
+
+	/* keep room for the '\0' which follows the contents */
+	uintptr_t spaceFree = freeSpace() - 1;
+	uintptr_t spaceUsed = MM_VerboseEventStream::encode((uint8_t *)_bufferAlloc, spaceFree, indent, 0, format, args);
+	if (0 == spaceUsed) {
+		/* The format cannot be encoded: record the formatted text instead */
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		va_list argsCopy;
+		COPY_VA_LIST(argsCopy, args);
+		uintptr_t textLength = omrstr_vprintf(NULL, 0, format, argsCopy);
+		END_VA_LIST_COPY(argsCopy);
+		char *text = (char *)env->getForge()->allocate(textLength, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == text) {
+			return false;
+		}
+		COPY_VA_LIST(argsCopy, args);
+		omrstr_vprintf(text, textLength, format, argsCopy);
+		END_VA_LIST_COPY(argsCopy);
+		spaceUsed = MM_VerboseEventStream::encodeString((uint8_t *)_bufferAlloc, spaceFree, indent, 0, text);
+		if (spaceUsed > spaceFree) {
+			if (ensureCapacity(env, spaceUsed + 1)) {
+				MM_VerboseEventStream::encodeString((uint8_t *)_bufferAlloc, freeSpace() - 1, indent, 0, text);
+			} else {
+				result = false;
+			}
+		}
+		env->getForge()->free(text);
+	} else if (spaceUsed > spaceFree) {
+		/* grow the buffer and try again */
+		if (ensureCapacity(env, spaceUsed + 1)) {
+			MM_VerboseEventStream::encode((uint8_t *)_bufferAlloc, freeSpace() - 1, indent, 0, format, args);
+		} else {
+			result = false;
+		}
+	}
+
+	if (result) {
+		_bufferAlloc += spaceUsed;
+		_bufferAlloc[0] = '\0';
+	}
+
+	return result;
+}
+
+bool
+MM_VerboseBuffer::formatEvents(MM_EnvironmentBase *env, const char *events, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	const char *eventsTop = events + length;
+	bool result = true;
+
+	Assert_VGC_true(!_recordEvents);
+
+	while (result && (events < eventsTop)) {
+		const uint8_t *event = (const uint8_t *)events;
+		uintptr_t spaceNeeded = MM_VerboseEventStream::render(OMRPORTLIB, event, _bufferAlloc, freeSpace());
+		if (spaceNeeded >= freeSpace()) {
+			/* undo the truncated text and grow the buffer */
+			_bufferAlloc[0] = '\0';
+			if (ensureCapacity(env, spaceNeeded + 1)) {
+				MM_VerboseEventStream::render(OMRPORTLIB, event, _bufferAlloc, freeSpace());
+			} else {
+				result = false;
+			}
+		}
+		if (result) {
+			_bufferAlloc += spaceNeeded;
+			Assert_VGC_true('\0' == _bufferAlloc[0]);
+		}
+		events += MM_VerboseEventStream::getEventLength(event);
+	}
+
+	return result;
+}
+
+void
+MM_VerboseBuffer::setRecordEvents(bool recordEvents)
+{
+	Assert_VGC_true(0 == currentSize());
+	_recordEvents = recordEvents;
+}
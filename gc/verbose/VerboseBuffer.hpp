@@ -53,6 +53,7 @@ private:
 	char *_buffer; /**< Pointer to the base of the buffer */
 	char *_bufferAlloc; /**< Pointer to the next char in the buffer */
 	char *_bufferTop; /**< Pointer to the top of the buffer (non-inclusive) */
+	bool _recordEvents; /**< Store each formatAndOutput() call as an MM_VerboseEventStream event instead of text */
 protected:
 public:
 
@@ -71,6 +72,12 @@ private:
 	 */
 	bool ensureCapacity(MM_EnvironmentBase *env, uintptr_t spaceNeeded);
 
+	/**
+	 * Append an event recording a formatAndOutput() call.
+	 * @return true on success, false if the buffer could not be expanded
+	 */
+	bool recordEvent(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+
 protected:
 	
 public:
@@ -102,12 +109,29 @@ public:
 	 * @return true on success, false if the buffer could not be expanded
 	 */
 	bool vprintf(MM_EnvironmentBase *env, const char *format, va_list args);
+
+	/**
+	 * Render a stream of events recorded by another buffer and append the text.
+	 * @param env[in] the current thread
+	 * @param events[in] the events, as returned by contents() of a buffer recording events
+	 * @param length[in] the number of bytes of events
+	 * @return true on success, false if the buffer could not be expanded
+	 */
+	bool formatEvents(MM_EnvironmentBase *env, const char *events, uintptr_t length);
+
+	/**
+	 * Choose between formatting text and recording events. The buffer must be empty.
+	 * @param recordEvents[in] true to record MM_VerboseEventStream events, false to format text
+	 */
+	void setRecordEvents(bool recordEvents);
+	MMINLINE bool isRecordingEvents() { return _recordEvents; }
 	
 	MM_VerboseBuffer(MM_EnvironmentBase *env) :
 		MM_Base(),
 		_buffer(NULL),
 		_bufferAlloc(NULL),
-		_bufferTop(NULL)
+		_bufferTop(NULL),
+		_recordEvents(false)
 	{}
 };
 
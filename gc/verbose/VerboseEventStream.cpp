@@ -0,0 +1,426 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "VerboseEventStream.hpp"
+
+#include "omrstdarg.h"
+
+#define INDENT_SPACER "  "
+#define INDENT_SPACER_LENGTH 2
+
+/* Longest conversion specification rendered, with '*' replaced by its value */
+#define MAXIMUM_SPECIFICATION_LENGTH 64
+
+/**
+ * Append bytes to an event, only storing them if the whole of them fits.
+ */
+static void
+appendBytes(uint8_t *buffer, uintptr_t bufferSize, uintptr_t *length, const void *bytes, uintptr_t count)
+{
+	if ((*length + count) <= bufferSize) {
+		memcpy(buffer + *length, bytes, count);
+	}
+	*length += count;
+}
+
+/**
+ * Append text to a rendering, storing as much of it as fits while leaving room for the NUL.
+ */
+static void
+appendText(char *buffer, uintptr_t bufferSize, uintptr_t *length, const char *text, uintptr_t count)
+{
+	if ((*length + 1) < bufferSize) {
+		uintptr_t available = bufferSize - 1 - *length;
+		memcpy(buffer + *length, text, (count < available) ? count : available);
+	}
+	*length += count;
+}
+
+static uintptr_t
+appendDecimal(char *buffer, uint32_t value)
+{
+	char digits[10];
+	uintptr_t count = 0;
+	do {
+		digits[count] = (char)('0' + (value % 10));
+		count += 1;
+		value /= 10;
+	} while (0 != value);
+	for (uintptr_t i = 0; i < count; i++) {
+		buffer[i] = digits[count - 1 - i];
+	}
+	return count;
+}
+
+const char *
+MM_VerboseEventStream::parseConversion(const char *cursor, Conversion *conversion)
+{
+	conversion->start = cursor;
+	conversion->widthArgument = false;
+	conversion->precisionArgument = false;
+	conversion->type = ARGUMENT_NONE;
+
+	/* skip the '%' */
+	cursor += 1;
+
+	const char *digits = cursor;
+	while (('0' <= *digits) && ('9' >= *digits)) {
+		digits += 1;
+	}
+	if ('$' == *digits) {
+		/* positional arguments are not supported */
+		return NULL;
+	}
+
+	while (('-' == *cursor) || ('+' == *cursor) || (' ' == *cursor) || ('#' == *cursor) || ('0' == *cursor)) {
+		cursor += 1;
+	}
+
+	if ('*' == *cursor) {
+		conversion->widthArgument = true;
+		cursor += 1;
+	} else {
+		while (('0' <= *cursor) && ('9' >= *cursor)) {
+			cursor += 1;
+		}
+	}
+
+	if ('.' == *cursor) {
+		cursor += 1;
+		if ('*' == *cursor) {
+			conversion->precisionArgument = true;
+			cursor += 1;
+		} else {
+			while (('0' <= *cursor) && ('9' >= *cursor)) {
+				cursor += 1;
+			}
+		}
+	}
+
+	/* omrstr_vprintf() reads %l as 32 bits, %ll as 64 bits and %z as the pointer size */
+	bool wide = false;
+	if ('z' == *cursor) {
+#if defined(OMR_ENV_DATA64)
+		wide = true;
+#endif /* OMR_ENV_DATA64 */
+		cursor += 1;
+	} else if ('l' == *cursor) {
+		cursor += 1;
+		if ('l' == *cursor) {
+			wide = true;
+			cursor += 1;
+		}
+	}
+
+	switch (*cursor) {
+	case 'c':
+		conversion->type = ARGUMENT_U32;
+		break;
+	case 'i':
+	case 'd':
+	case 'u':
+	case 'x':
+	case 'X':
+		conversion->type = wide ? ARGUMENT_U64 : ARGUMENT_U32;
+		break;
+	case 'p':
+		conversion->type = ARGUMENT_POINTER;
+		break;
+	case 's':
+		conversion->type = ARGUMENT_STRING;
+		break;
+	case 'f':
+	case 'e':
+	case 'E':
+	case 'F':
+	case 'g':
+	case 'G':
+		conversion->type = ARGUMENT_DOUBLE;
+		break;
+	default:
+		return NULL;
+	}
+
+	conversion->end = cursor + 1;
+	return conversion->end;
+}
+
+uintptr_t
+MM_VerboseEventStream::encode(uint8_t *buffer, uintptr_t bufferSize, uintptr_t indent, uintptr_t flags, const char *format, va_list args)
+{
+	uintptr_t length = sizeof(EventHeader);
+	va_list argsCopy;
+
+	appendBytes(buffer, bufferSize, &length, format, strlen(format) + 1);
+
+	COPY_VA_LIST(argsCopy, args);
+	const char *cursor = format;
+	while ('\0' != *cursor) {
+		if ('%' != *cursor) {
+			cursor += 1;
+		} else if ('%' == cursor[1]) {
+			cursor += 2;
+		} else {
+			Conversion conversion;
+			cursor = parseConversion(cursor, &conversion);
+			if (NULL == cursor) {
+				END_VA_LIST_COPY(argsCopy);
+				return 0;
+			}
+			if (conversion.widthArgument) {
+				uint32_t width = va_arg(argsCopy, uint32_t);
+				appendBytes(buffer, bufferSize, &length, &width, sizeof(width));
+			}
+			if (conversion.precisionArgument) {
+				uint32_t precision = va_arg(argsCopy, uint32_t);
+				appendBytes(buffer, bufferSize, &length, &precision, sizeof(precision));
+			}
+			switch (conversion.type) {
+			case ARGUMENT_U32:
+			{
+				uint32_t value = va_arg(argsCopy, uint32_t);
+				appendBytes(buffer, bufferSize, &length, &value, sizeof(value));
+				break;
+			}
+			case ARGUMENT_U64:
+			{
+				uint64_t value = va_arg(argsCopy, uint64_t);
+				appendBytes(buffer, bufferSize, &length, &value, sizeof(value));
+				break;
+			}
+			case ARGUMENT_DOUBLE:
+			{
+				double value = va_arg(argsCopy, double);
+				appendBytes(buffer, bufferSize, &length, &value, sizeof(value));
+				break;
+			}
+			case ARGUMENT_POINTER:
+			{
+				uint64_t value = (uint64_t)(uintptr_t)va_arg(argsCopy, void *);
+				appendBytes(buffer, bufferSize, &length, &value, sizeof(value));
+				break;
+			}
+			case ARGUMENT_STRING:
+			{
+				const char *value = va_arg(argsCopy, const char *);
+				uint8_t present = (NULL != value) ? 1 : 0;
+				appendBytes(buffer, bufferSize, &length, &present, sizeof(present));
+				if (NULL != value) {
+					appendBytes(buffer, bufferSize, &length, value, strlen(value) + 1);
+				}
+				break;
+			}
+			default:
+				break;
+			}
+		}
+	}
+	END_VA_LIST_COPY(argsCopy);
+
+	if (length <= bufferSize) {
+		EventHeader header;
+		header.length = (uint32_t)length;
+		header.indent = (uint16_t)indent;
+		header.flags = (uint16_t)flags;
+		memcpy(buffer, &header, sizeof(header));
+	}
+	return length;
+}
+
+uintptr_t
+MM_VerboseEventStream::encodeString(uint8_t *buffer, uintptr_t bufferSize, uintptr_t indent, uintptr_t flags, const char *text)
+{
+	uintptr_t length = sizeof(EventHeader);
+	uint8_t present = 1;
+
+	appendBytes(buffer, bufferSize, &length, "%s", sizeof("%s"));
+	appendBytes(buffer, bufferSize, &length, &present, sizeof(present));
+	appendBytes(buffer, bufferSize, &length, text, strlen(text) + 1);
+
+	if (length <= bufferSize) {
+		EventHeader header;
+		header.length = (uint32_t)length;
+		header.indent = (uint16_t)indent;
+		header.flags = (uint16_t)flags;
+		memcpy(buffer, &header, sizeof(header));
+	}
+	return length;
+}
+
+uintptr_t
+MM_VerboseEventStream::getEventLength(const uint8_t *event)
+{
+	EventHeader header;
+	memcpy(&header, event, sizeof(header));
+	return header.length;
+}
+
+uintptr_t
+MM_VerboseEventStream::getValueLength(ArgumentType type, const uint8_t *value)
+{
+	uintptr_t length = 0;
+
+	switch (type) {
+	case ARGUMENT_U32:
+		length = sizeof(uint32_t);
+		break;
+	case ARGUMENT_U64:
+	case ARGUMENT_DOUBLE:
+	case ARGUMENT_POINTER:
+		length = sizeof(uint64_t);
+		break;
+	case ARGUMENT_STRING:
+		length = 1;
+		if (0 != *value) {
+			length += strlen((const char *)(value + 1)) + 1;
+		}
+		break;
+	default:
+		break;
+	}
+
+	return length;
+}
+
+uintptr_t
+MM_VerboseEventStream::formatValue(OMRPortLibrary *portLibrary, char *buffer, uintptr_t bufferSize, const char *specification, ArgumentType type, const uint8_t *value)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uintptr_t result = 0;
+
+	switch (type) {
+	case ARGUMENT_U32:
+	{
+		uint32_t number = 0;
+		memcpy(&number, value, sizeof(number));
+		result = omrstr_printf(buffer, bufferSize, specification, number);
+		break;
+	}
+	case ARGUMENT_U64:
+	{
+		uint64_t number = 0;
+		memcpy(&number, value, sizeof(number));
+		result = omrstr_printf(buffer, bufferSize, specification, number);
+		break;
+	}
+	case ARGUMENT_DOUBLE:
+	{
+		double number = 0.0;
+		memcpy(&number, value, sizeof(number));
+		result = omrstr_printf(buffer, bufferSize, specification, number);
+		break;
+	}
+	case ARGUMENT_POINTER:
+	{
+		uint64_t pointer = 0;
+		memcpy(&pointer, value, sizeof(pointer));
+		result = omrstr_printf(buffer, bufferSize, specification, (void *)(uintptr_t)pointer);
+		break;
+	}
+	case ARGUMENT_STRING:
+		result = omrstr_printf(buffer, bufferSize, specification, (0 != *value) ? (const char *)(value + 1) : (const char *)NULL);
+		break;
+	default:
+		break;
+	}
+
+	return result;
+}
+
+uintptr_t
+MM_VerboseEventStream::render(OMRPortLibrary *portLibrary, const uint8_t *event, char *buffer, uintptr_t bufferSize)
+{
+	EventHeader header;
+	uintptr_t length = 0;
+
+	memcpy(&header, event, sizeof(header));
+	const char *format = (const char *)(event + sizeof(header));
+	const uint8_t *value = (const uint8_t *)(format + strlen(format) + 1);
+
+	for (uintptr_t i = 0; i < header.indent; i++) {
+		appendText(buffer, bufferSize, &length, INDENT_SPACER, INDENT_SPACER_LENGTH);
+	}
+
+	const char *cursor = format;
+	while ('\0' != *cursor) {
+		if ('%' != *cursor) {
+			const char *literal = cursor;
+			while (('\0' != *cursor) && ('%' != *cursor)) {
+				cursor += 1;
+			}
+			appendText(buffer, bufferSize, &length, literal, cursor - literal);
+		} else if ('%' == cursor[1]) {
+			appendText(buffer, bufferSize, &length, "%", 1);
+			cursor += 2;
+		} else {
+			Conversion conversion;
+			cursor = parseConversion(cursor, &conversion);
+			if (NULL == cursor) {
+				/* encode() does not produce events with conversions it cannot parse */
+				break;
+			}
+
+			/* Copy the specification, replacing '*' with the stored width or precision */
+			char specification[MAXIMUM_SPECIFICATION_LENGTH];
+			uintptr_t specificationLength = 0;
+			for (const char *character = conversion.start; character < conversion.end; character++) {
+				if ((specificationLength + 11) >= sizeof(specification)) {
+					break;
+				}
+				if ('*' == *character) {
+					uint32_t star = 0;
+					memcpy(&star, value, sizeof(star));
+					value += sizeof(star);
+					specificationLength += appendDecimal(specification + specificationLength, star);
+				} else {
+					specification[specificationLength] = *character;
+					specificationLength += 1;
+				}
+			}
+			specification[specificationLength] = '\0';
+
+			/* Format in place, measuring separately only when the text may have been truncated */
+			char *target = ((length + 1) < bufferSize) ? (buffer + length) : NULL;
+			uintptr_t available = (NULL != target) ? (bufferSize - length) : 0;
+			uintptr_t needed = 0;
+			if (NULL != target) {
+				needed = formatValue(portLibrary, target, available, specification, conversion.type, value);
+			}
+			if ((NULL == target) || ((needed + 1) >= available)) {
+				needed = formatValue(portLibrary, NULL, 0, specification, conversion.type, value) - 1;
+			}
+			value += getValueLength(conversion.type, value);
+			length += needed;
+		}
+	}
+
+	if (0 == (header.flags & EVENT_FLAG_NO_NEWLINE)) {
+		appendText(buffer, bufferSize, &length, "\n", 1);
+	}
+
+	if (0 != bufferSize) {
+		buffer[(length < bufferSize) ? length : (bufferSize - 1)] = '\0';
+	}
+	return length;
+}
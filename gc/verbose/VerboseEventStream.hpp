@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(VERBOSEEVENTSTREAM_HPP_)
+#define VERBOSEEVENTSTREAM_HPP_
+
+#include <stdarg.h>
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+
+/* First bytes of a file written by -Xgc:asyncLoggingBinary, followed by events */
+#define VERBOSE_EVENT_STREAM_MAGIC "OMRVGCE1"
+#define VERBOSE_EVENT_STREAM_MAGIC_LENGTH 8
+
+/**
+ * Binary encoding of verbose output.
+ *
+ * An event records one formatAndOutput() call without formatting it: the indent, the format string and
+ * each argument in binary form, with %s arguments copied since they usually live on the caller's stack.
+ * Rendering an event produces exactly the text MM_VerboseBuffer::formatAndOutput() would have produced.
+ * Arguments are read the way omrstr_vprintf() reads them, so any format it accepts can be encoded, apart
+ * from positional (%n$) arguments.
+ *
+ * Events are unaligned and self-delimiting, so a stream of them can be copied, queued or written to a
+ * file as is. A stream is only meaningful on a platform with the same endianness as the one that wrote it.
+ * @ingroup GC_verbose_output_agents
+ */
+class MM_VerboseEventStream
+{
+	/*
+	 * Data members
+	 */
+public:
+	typedef struct EventHeader {
+		uint32_t length; /**< bytes in the event, including this header */
+		uint16_t indent; /**< indent level the event is rendered at */
+		uint16_t flags; /**< EventFlags */
+	} EventHeader;
+
+	typedef enum EventFlags {
+		EVENT_FLAG_NO_NEWLINE = 1 /**< do not end the rendered text with a newline (file header and footer) */
+	} EventFlags;
+
+protected:
+private:
+	/* How an argument is read from the va_list and stored in the event, following omrstr_vprintf() */
+	typedef enum ArgumentType {
+		ARGUMENT_NONE = 0,
+		ARGUMENT_U32, /**< 4 bytes */
+		ARGUMENT_U64, /**< 8 bytes */
+		ARGUMENT_DOUBLE, /**< 8 bytes */
+		ARGUMENT_POINTER, /**< 8 bytes */
+		ARGUMENT_STRING /**< 1 byte (0 for NULL), then the NUL terminated string if not NULL */
+	} ArgumentType;
+
+	/* A conversion specification, from its '%' to its type character */
+	typedef struct Conversion {
+		const char *start;
+		const char *end; /**< one past the type character */
+		bool widthArgument; /**< width is given by a U32 argument ('*') */
+		bool precisionArgument; /**< precision is given by a U32 argument ('.*') */
+		ArgumentType type;
+	} Conversion;
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Encode a formatAndOutput() call.
+	 * @param buffer[out] where to store the event, may be NULL if bufferSize is 0
+	 * @param bufferSize[in] bytes available at buffer
+	 * @param indent[in] indent level
+	 * @param flags[in] EventFlags
+	 * @param format[in] format string accepted by omrstr_vprintf()
+	 * @param args[in] arguments for format
+	 * @return the size of the event, which was only stored if it is no larger than bufferSize, or 0 if
+	 * format cannot be encoded (see encodeString())
+	 */
+	static uintptr_t encode(uint8_t *buffer, uintptr_t bufferSize, uintptr_t indent, uintptr_t flags, const char *format, va_list args);
+
+	/**
+	 * Encode already formatted text, used for formats that encode() rejects.
+	 * @return the size of the event, which was only stored if it is no larger than bufferSize
+	 */
+	static uintptr_t encodeString(uint8_t *buffer, uintptr_t bufferSize, uintptr_t indent, uintptr_t flags, const char *text);
+
+	/**
+	 * @param event[in] an event
+	 * @return the size of the event
+	 */
+	static uintptr_t getEventLength(const uint8_t *event);
+
+	/**
+	 * Render an event as text.
+	 * @param portLibrary[in] the port library used to format arguments
+	 * @param event[in] the event to render
+	 * @param buffer[out] where to store the NUL terminated text, truncated to fit, may be NULL if bufferSize is 0
+	 * @param bufferSize[in] bytes available at buffer
+	 * @return the length of the complete text, excluding the NUL; the text was truncated if this is not less than bufferSize
+	 */
+	static uintptr_t render(OMRPortLibrary *portLibrary, const uint8_t *event, char *buffer, uintptr_t bufferSize);
+
+protected:
+private:
+	static const char *parseConversion(const char *cursor, Conversion *conversion);
+	static uintptr_t getValueLength(ArgumentType type, const uint8_t *value);
+
+	/**
+	 * Format one stored argument.
+	 * @return what omrstr_printf() returned
+	 */
+	static uintptr_t formatValue(OMRPortLibrary *portLibrary, char *buffer, uintptr_t bufferSize, const char *specification, ArgumentType type, const uint8_t *value);
+};
+
+#endif /* VERBOSEEVENTSTREAM_HPP_ */
@@ -35,7 +35,8 @@ typedef enum {
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS = 6
 } WriterType;
 
 /**
@@ -69,6 +70,22 @@ public:
 
 	virtual void outputString(MM_EnvironmentBase *env, const char* string) = 0;
 
+	/**
+	 * Writers that return true are given MM_VerboseEventStream events through outputEvents() and format
+	 * them later, instead of text through outputString(). Output is only recorded as events while every
+	 * writer in the chain accepts them.
+	 * @return true if the writer accepts events
+	 */
+	virtual bool acceptsEvents() { return false; }
+
+	/**
+	 * Output a stream of MM_VerboseEventStream events. Only called if acceptsEvents() returns true.
+	 * @param[in] env the current environment.
+	 * @param[in] events the events
+	 * @param[in] length the number of bytes of events
+	 */
+	virtual void outputEvents(MM_EnvironmentBase *env, const char *events, uintptr_t length) {}
+
 	virtual bool reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount, uintptr_t iterations) = 0;
 
 	virtual void endOfCycle(MM_EnvironmentBase *env) = 0;
@@ -35,6 +35,7 @@
 MM_VerboseWriterChain::MM_VerboseWriterChain()
 	: MM_Base()
 	,_buffer(NULL)
+	,_textBuffer(NULL)
 	,_writers(NULL)
 {}
 
@@ -68,11 +69,49 @@ void
 MM_VerboseWriterChain::flush(MM_EnvironmentBase *env)
 {
 	MM_VerboseWriter* writer = _writers;
-	while (NULL != writer) {
-		writer->outputString(env, _buffer->contents());
-		writer = writer->getNextWriter();
+	if (_buffer->isRecordingEvents()) {
+		while (NULL != writer) {
+			if (writer->acceptsEvents()) {
+				writer->outputEvents(env, _buffer->contents(), _buffer->currentSize());
+			} else {
+				/* a writer was added since the events were recorded */
+				if (NULL == _textBuffer) {
+					_textBuffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+				}
+				if (NULL != _textBuffer) {
+					if (0 == _textBuffer->currentSize()) {
+						_textBuffer->formatEvents(env, _buffer->contents(), _buffer->currentSize());
+					}
+					writer->outputString(env, _textBuffer->contents());
+				}
+			}
+			writer = writer->getNextWriter();
+		}
+		if (NULL != _textBuffer) {
+			_textBuffer->reset();
+		}
+	} else {
+		while (NULL != writer) {
+			writer->outputString(env, _buffer->contents());
+			writer = writer->getNextWriter();
+		}
 	}
 	_buffer->reset();
+	updateRecordEvents();
+}
+
+void
+MM_VerboseWriterChain::updateRecordEvents()
+{
+	if (0 == _buffer->currentSize()) {
+		bool recordEvents = (NULL != _writers);
+		MM_VerboseWriter* writer = _writers;
+		while (recordEvents && (NULL != writer)) {
+			recordEvents = writer->acceptsEvents();
+			writer = writer->getNextWriter();
+		}
+		_buffer->setRecordEvents(recordEvents);
+	}
 }
 
 void
@@ -82,6 +121,10 @@ MM_VerboseWriterChain::tearDown(MM_EnvironmentBase* env)
 		_buffer->kill(env);
 		_buffer = NULL;
 	}
+	if (NULL != _textBuffer) {
+		_textBuffer->kill(env);
+		_textBuffer = NULL;
+	}
 	MM_VerboseWriter* writer = _writers;
 	while (NULL != writer) {
 		MM_VerboseWriter* nextWriter = writer->getNextWriter();
@@ -115,6 +158,7 @@ MM_VerboseWriterChain::addWriter(MM_VerboseWriter* writer)
 {
 	writer->setNextWriter(_writers);
 	_writers = writer;
+	updateRecordEvents();
 }
 
 void
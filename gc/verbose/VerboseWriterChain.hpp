@@ -44,6 +44,7 @@ public:
 protected:
 private:
 	MM_VerboseBuffer *_buffer;
+	MM_VerboseBuffer *_textBuffer; /**< Text of recorded events for writers that do not accept events, allocated on first use */
 	MM_VerboseWriter *_writers;
 
 public:
@@ -79,6 +80,10 @@ protected:
 	void tearDown(MM_EnvironmentBase *env);
 	bool initialize(MM_EnvironmentBase* env);
 private:
+	/**
+	 * Record events in the buffer if every writer accepts them, otherwise format text.
+	 */
+	void updateRecordEvents();
 };
 
 #endif /* VERBOSEWRITERCHAIN_HPP_ */
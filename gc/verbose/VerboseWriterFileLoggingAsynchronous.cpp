@@ -0,0 +1,530 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrutil.h"
+#include "VerboseManager.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+
+#include "AtomicOperations.hpp"
+#include "GCExtensionsBase.hpp"
+#include "EnvironmentBase.hpp"
+#include "Math.hpp"
+#include "VerboseBuffer.hpp"
+#include "VerboseEventStream.hpp"
+#include "VerboseHandlerOutput.hpp"
+
+#include <string.h>
+
+/* Smallest ring accepted, so that a typical stanza always fits */
+#define ASYNC_WRITER_MINIMUM_BUFFER_SIZE ((uintptr_t)64 * 1024)
+/* Longest the writer thread sleeps before polling the ring, bounding latency when a wakeup is missed */
+#define ASYNC_WRITER_WAIT_MILLIS 50
+
+static int J9THREAD_PROC
+verbose_writer_thread_proc(void *info)
+{
+	((MM_VerboseWriterFileLoggingAsynchronous *)info)->writerThreadEntryPoint();
+	return 0;
+}
+
+MM_VerboseWriterFileLoggingAsynchronous::MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS)
+	,_logFileStream(NULL)
+	,_records(NULL)
+	,_recordsSize(0)
+	,_reserveCursor(0)
+	,_consumeCursor(0)
+	,_droppedRecords(0)
+	,_reportedDroppedRecords(0)
+	,_writerMonitor(NULL)
+	,_renderBuffer(NULL)
+	,_binary(false)
+	,_writerThreadState(WRITER_THREAD_NONE)
+	,_omrVM(env->getOmrVM())
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsynchronous instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsynchronous.
+ */
+MM_VerboseWriterFileLoggingAsynchronous *
+MM_VerboseWriterFileLoggingAsynchronous::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsynchronous *agent = (MM_VerboseWriterFileLoggingAsynchronous *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsynchronous), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsynchronous(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsynchronous instance.
+ * Allocates the record ring, opens the first file and starts the writer thread.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	_recordsSize = ASYNC_WRITER_MINIMUM_BUFFER_SIZE;
+	while (_recordsSize < extensions->asyncLoggingBufferSize) {
+		_recordsSize <<= 1;
+	}
+	_records = (uint8_t *)extensions->getForge()->allocate(_recordsSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _records) {
+		return false;
+	}
+	/* An uncommitted record reads as ASYNC_RECORD_NONE, consumed records are cleared again by the writer */
+	memset(_records, 0, _recordsSize);
+	_reserveCursor = 0;
+	_consumeCursor = 0;
+	_droppedRecords = 0;
+	_reportedDroppedRecords = 0;
+	_binary = extensions->asyncLoggingBinary;
+
+	_renderBuffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+	if (NULL == _renderBuffer) {
+		return false;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_writerMonitor, 0, "MM_VerboseWriterFileLoggingAsynchronous::writer")) {
+		return false;
+	}
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	return startWriterThread(env);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingAsynchronous.
+ * Stops the writer thread once everything queued has been written, and closes the file.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	stopWriterThread(env);
+
+	if (NULL != _writerMonitor) {
+		omrthread_monitor_enter(_writerMonitor);
+		if (NULL != _records) {
+			drainRecords(env);
+		}
+		closeFile(env);
+		omrthread_monitor_exit(_writerMonitor);
+		omrthread_monitor_destroy(_writerMonitor);
+		_writerMonitor = NULL;
+	}
+
+	if (NULL != _records) {
+		extensions->getForge()->free(_records);
+		_records = NULL;
+	}
+
+	if (NULL != _renderBuffer) {
+		_renderBuffer->kill(env);
+		_renderBuffer = NULL;
+	}
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::startWriterThread(MM_EnvironmentBase *env)
+{
+	omrthread_t thread = NULL;
+
+	omrthread_monitor_enter(_writerMonitor);
+	_writerThreadState = WRITER_THREAD_NONE;
+	intptr_t threadForkResult = createThreadWithCategory(&thread, OMR_OS_STACK_SIZE, J9THREAD_PRIORITY_NORMAL,
+														0, verbose_writer_thread_proc, (void *)this, J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == threadForkResult) {
+		while (WRITER_THREAD_NONE == _writerThreadState) {
+			omrthread_monitor_wait(_writerMonitor);
+		}
+	}
+	omrthread_monitor_exit(_writerMonitor);
+
+	return (0 == threadForkResult);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::stopWriterThread(MM_EnvironmentBase *env)
+{
+	if (NULL != _writerMonitor) {
+		omrthread_monitor_enter(_writerMonitor);
+		if (WRITER_THREAD_RUNNING == _writerThreadState) {
+			_writerThreadState = WRITER_THREAD_SHUTDOWN;
+			omrthread_monitor_notify_all(_writerMonitor);
+			while (WRITER_THREAD_TERMINATED != _writerThreadState) {
+				omrthread_monitor_wait(_writerMonitor);
+			}
+		}
+		omrthread_monitor_exit(_writerMonitor);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writerThreadEntryPoint()
+{
+	MM_EnvironmentBase env(_omrVM);
+	OMRPORT_ACCESS_FROM_OMRPORT(env.getPortLibrary());
+
+	omrthread_monitor_enter(_writerMonitor);
+	_writerThreadState = WRITER_THREAD_RUNNING;
+	omrthread_monitor_notify_all(_writerMonitor);
+
+	while (WRITER_THREAD_SHUTDOWN != _writerThreadState) {
+		if (drainRecords(&env)) {
+			/* Keep the file current while idle, the flush happens on this thread rather than in a pause */
+			if (NULL != _logFileStream) {
+				omrfilestream_sync(_logFileStream);
+			}
+		} else {
+			omrthread_monitor_wait_timed(_writerMonitor, ASYNC_WRITER_WAIT_MILLIS, 0);
+		}
+	}
+	drainRecords(&env);
+
+	_writerThreadState = WRITER_THREAD_TERMINATED;
+	omrthread_monitor_notify_all(_writerMonitor);
+	omrthread_exit(_writerMonitor);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::notifyWriterThread()
+{
+	/* Never block a producer: if the writer holds the monitor it is already draining, otherwise its timed wait will pick the record up */
+	if (0 == omrthread_monitor_try_enter(_writerMonitor)) {
+		omrthread_monitor_notify(_writerMonitor);
+		omrthread_monitor_exit(_writerMonitor);
+	}
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::appendRecord(MM_EnvironmentBase *env, AsyncRecordType type, const char *payload, uintptr_t length)
+{
+	uintptr_t recordSize = MM_Math::roundToCeiling(sizeof(AsyncRecordHeader), sizeof(AsyncRecordHeader) + length);
+	if (recordSize > (_recordsSize / 2)) {
+		MM_AtomicOperations::add(&_droppedRecords, 1);
+		return false;
+	}
+
+	while (true) {
+		uintptr_t reserve = _reserveCursor;
+		uintptr_t offset = reserve & (_recordsSize - 1);
+		uintptr_t padding = ((_recordsSize - offset) < recordSize) ? (_recordsSize - offset) : 0;
+		if (((reserve + padding + recordSize) - _consumeCursor) > _recordsSize) {
+			MM_AtomicOperations::add(&_droppedRecords, 1);
+			return false;
+		}
+		/* Unsigned arithmetic keeps the fill level right when the cursors wrap around the address space */
+		if (reserve == MM_AtomicOperations::lockCompareExchange(&_reserveCursor, reserve, reserve + padding + recordSize)) {
+			if (0 != padding) {
+				AsyncRecordHeader *paddingHeader = (AsyncRecordHeader *)(_records + offset);
+				paddingHeader->length = (uint32_t)(padding - sizeof(AsyncRecordHeader));
+				MM_AtomicOperations::writeBarrier();
+				paddingHeader->type = ASYNC_RECORD_PADDING;
+				offset = 0;
+			}
+			AsyncRecordHeader *header = (AsyncRecordHeader *)(_records + offset);
+			header->length = (uint32_t)length;
+			memcpy(header + 1, payload, length);
+			/* Publish the payload before the type commits the record */
+			MM_AtomicOperations::writeBarrier();
+			header->type = type;
+			return true;
+		}
+	}
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::drainRecords(MM_EnvironmentBase *env)
+{
+	bool consumed = false;
+	uintptr_t consume = _consumeCursor;
+
+	while (consume != _reserveCursor) {
+		AsyncRecordHeader *header = (AsyncRecordHeader *)(_records + (consume & (_recordsSize - 1)));
+		uint32_t type = header->type;
+		if (ASYNC_RECORD_NONE == type) {
+			/* Reserved but the producer has not committed it yet */
+			break;
+		}
+		MM_AtomicOperations::readBarrier();
+
+		uintptr_t length = header->length;
+		const char *payload = (const char *)(header + 1);
+		switch (type) {
+		case ASYNC_RECORD_STRING:
+			/* the payload includes the NUL */
+			writeText(env, payload, false);
+			break;
+		case ASYNC_RECORD_EVENTS:
+			writeEvents(env, payload, length);
+			break;
+		case ASYNC_RECORD_ROTATE:
+			closeFile(env);
+			_currentFile = (_currentFile + 1) % _numFiles;
+			openFile(env);
+			writeEvents(env, payload, length);
+			break;
+		default:
+			break;
+		}
+
+		uintptr_t recordSize = MM_Math::roundToCeiling(sizeof(AsyncRecordHeader), sizeof(AsyncRecordHeader) + length);
+		memset(header, 0, recordSize);
+		/* The cleared record must be visible before producers may reuse the space */
+		MM_AtomicOperations::writeBarrier();
+		consume += recordSize;
+		_consumeCursor = consume;
+		consumed = true;
+	}
+
+	uintptr_t droppedRecords = _droppedRecords;
+	if (droppedRecords != _reportedDroppedRecords) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		char warning[128];
+		omrstr_printf(warning, sizeof(warning), "<warning details=\"asynchronous verbose writer buffer full, records dropped\" count=\"%zu\" />", droppedRecords - _reportedDroppedRecords);
+		writeText(env, warning, true);
+		_reportedDroppedRecords = droppedRecords;
+	}
+
+	return consumed;
+}
+
+/**
+ * Opens the file to log output to and prints the header.
+ * Called before the writer thread starts or while holding _writerMonitor.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	int32_t openFlags =  EsOpenWrite | EsOpenCreate | _manager->fileOpenMode(env);
+
+	_logFileStream = omrfilestream_open(filenameToOpen, openFlags, 0666);
+	if(NULL == _logFileStream) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileStream = omrfilestream_open(filenameToOpen, openFlags, 0666);
+		if (NULL == _logFileStream) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	if (_binary) {
+		omrfilestream_write(_logFileStream, VERBOSE_EVENT_STREAM_MAGIC, VERBOSE_EVENT_STREAM_MAGIC_LENGTH);
+	}
+	writeText(env, getHeader(env), false);
+	/* Print an Initialized Stanza in new file */
+	if (printInitializedHeader) {
+		MM_VerboseBuffer* buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+		if (NULL != buffer) {
+			buffer->setRecordEvents(true);
+			_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, buffer);
+			writeEvents(env, buffer->contents(), buffer->currentSize());
+			buffer->kill(env);
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Prints the footer and closes the file being logged to.
+ * Called while holding _writerMonitor or once the writer thread has stopped.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(NULL != _logFileStream) {
+		writeText(env, getFooter(env), true);
+		omrfilestream_close(_logFileStream);
+		_logFileStream = NULL;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeString(MM_EnvironmentBase *env, const char *string, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(NULL == _logFileStream) {
+		/**
+		 * Under normal circumstances, new file should be opened when a rotate record is written.
+		 * This path works as one backup, in case we failed to open the file,  we’ll attempt to open it again before outputting the string.
+		 */
+		openFile(env);
+	}
+
+	if(NULL != _logFileStream){
+		if (_binary) {
+			omrfilestream_write(_logFileStream, string, length);
+		} else {
+			omrfilestream_write_text(_logFileStream, string, length, J9STR_CODE_PLATFORM_RAW);
+		}
+	} else if (!_binary) {
+		omrfilestream_write_text(OMRPORT_STREAM_ERR, string, length, J9STR_CODE_PLATFORM_RAW);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeEvents(MM_EnvironmentBase *env, const char *events, uintptr_t length)
+{
+	if (_binary) {
+		writeString(env, events, length);
+	} else {
+		_renderBuffer->reset();
+		_renderBuffer->formatEvents(env, events, length);
+		writeString(env, _renderBuffer->contents(), _renderBuffer->currentSize());
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeText(MM_EnvironmentBase *env, const char *text, bool newline)
+{
+	if (_binary) {
+		uintptr_t flags = newline ? 0 : MM_VerboseEventStream::EVENT_FLAG_NO_NEWLINE;
+		uintptr_t length = MM_VerboseEventStream::encodeString(NULL, 0, 0, flags, text);
+		uint8_t *event = (uint8_t *)env->getForge()->allocate(length, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL != event) {
+			MM_VerboseEventStream::encodeString(event, length, 0, flags, text);
+			writeString(env, (const char *)event, length);
+			env->getForge()->free(event);
+		}
+	} else {
+		writeString(env, text, strlen(text));
+		if (newline) {
+			writeString(env, "\n", 1);
+		}
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	if (appendRecord(env, ASYNC_RECORD_STRING, string, strlen(string) + 1)) {
+		notifyWriterThread();
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputEvents(MM_EnvironmentBase *env, const char *events, uintptr_t length)
+{
+	if (appendRecord(env, ASYNC_RECORD_EVENTS, events, length)) {
+		notifyWriterThread();
+	}
+}
+
+/**
+ * Queues a file rotation if this cycle completes the current file.
+ * The initialized stanza for the next file is recorded here, where a GC environment is available,
+ * and travels with the rotate record.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::endOfCycle(MM_EnvironmentBase *env)
+{
+	if((0 < _numFiles) && (0 < _numCycles)) {
+		_currentCycle = (_currentCycle + 1) % _numCycles;
+		if(0 == _currentCycle) {
+			MM_VerboseBuffer* buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+			if (NULL != buffer) {
+				buffer->setRecordEvents(true);
+				_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, buffer);
+				appendRecord(env, ASYNC_RECORD_ROTATE, buffer->contents(), buffer->currentSize());
+				buffer->kill(env);
+			} else {
+				appendRecord(env, ASYNC_RECORD_ROTATE, "", 0);
+			}
+		}
+	}
+	notifyWriterThread();
+}
+
+/**
+ * Closes the agent's output stream once everything queued so far has been written.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeStream(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_writerMonitor);
+	drainRecords(env);
+	closeFile(env);
+	omrthread_monitor_exit(_writerMonitor);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::openStream(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_writerMonitor);
+	drainRecords(env);
+	/* Pass in true to print the verbose initialize header in the file being opened. */
+	bool result = openFile(env, true);
+	omrthread_monitor_exit(_writerMonitor);
+	return result;
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	tearDown(env);
+	return initialize(env, filename, numFiles, numCycles);
+}
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseWriterFileLogging.hpp"
+
+class MM_VerboseBuffer;
+
+/**
+ * Output agent which directs verbosegc output to file from a background thread.
+ *
+ * Threads producing verbose output neither format nor write it: the writer chain records each stanza as
+ * MM_VerboseEventStream events, which are copied into a ring of binary records (see AsyncRecordHeader).
+ * The writer thread drains the ring in order, renders the events as XML and writes them, rotating files
+ * as it goes. With -Xgc:asyncLoggingBinary it writes the events unrendered instead, for vgcrender to turn
+ * into XML later. If the ring is full the record is dropped and a warning stanza reports the loss later.
+ */
+class MM_VerboseWriterFileLoggingAsynchronous : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	/**
+	 * Header of each record in the ring. Records are 8-byte aligned and never wrap:
+	 * a padding record fills the tail of the ring when the next record does not fit.
+	 * A type of ASYNC_RECORD_NONE means the record is reserved but not yet committed.
+	 */
+	typedef struct AsyncRecordHeader {
+		uint32_t length; /**< payload bytes following the header */
+		volatile uint32_t type; /**< one of AsyncRecordType, stored last to commit the record */
+	} AsyncRecordHeader;
+
+	typedef enum AsyncRecordType {
+		ASYNC_RECORD_NONE = 0,
+		ASYNC_RECORD_PADDING, /**< skip to the start of the ring */
+		ASYNC_RECORD_STRING, /**< payload is text to append to the current file */
+		ASYNC_RECORD_EVENTS, /**< payload is MM_VerboseEventStream events to append to the current file */
+		ASYNC_RECORD_ROTATE /**< close the current file and open the next one, payload is the initialized stanza as events */
+	} AsyncRecordType;
+
+	typedef enum WriterThreadState {
+		WRITER_THREAD_NONE = 0,
+		WRITER_THREAD_RUNNING,
+		WRITER_THREAD_SHUTDOWN,
+		WRITER_THREAD_TERMINATED
+	} WriterThreadState;
+
+	OMRFileStream *_logFileStream; /**< the filestream being written to, only used while holding _writerMonitor once the writer thread is running */
+	uint8_t *_records; /**< ring of AsyncRecordHeader prefixed records */
+	uintptr_t _recordsSize; /**< size of the ring in bytes, a power of two */
+	volatile uintptr_t _reserveCursor; /**< bytes ever reserved by producers, modulo the address space (the ring size divides it) */
+	volatile uintptr_t _consumeCursor; /**< bytes ever consumed by the writer, only stored by the writer */
+	volatile uintptr_t _droppedRecords; /**< records dropped because the ring was full */
+	uintptr_t _reportedDroppedRecords; /**< dropped records already reported in the log */
+	omrthread_monitor_t _writerMonitor; /**< protects the file and wakes the writer thread */
+	MM_VerboseBuffer *_renderBuffer; /**< text of the events being written, only used while holding _writerMonitor */
+	bool _binary; /**< write events unrendered (-Xgc:asyncLoggingBinary) */
+	volatile WriterThreadState _writerThreadState;
+	OMR_VM *_omrVM; /**< used to build the writer thread environment */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsynchronous *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+	virtual bool acceptsEvents() { return true; }
+	virtual void outputEvents(MM_EnvironmentBase *env, const char *events, uintptr_t length);
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+	virtual bool reconfigure(MM_EnvironmentBase *env, const char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	void closeStream(MM_EnvironmentBase *env);
+	bool openStream(MM_EnvironmentBase *env);
+
+	/**
+	 * Main loop of the writer thread.
+	 */
+	void writerThreadEntryPoint();
+
+protected:
+	MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+	void closeFile(MM_EnvironmentBase *env);
+
+	bool startWriterThread(MM_EnvironmentBase *env);
+	void stopWriterThread(MM_EnvironmentBase *env);
+
+	/**
+	 * Copy a record into the ring without blocking.
+	 * @return true if the record was queued, false if it was dropped
+	 */
+	bool appendRecord(MM_EnvironmentBase *env, AsyncRecordType type, const char *payload, uintptr_t length);
+
+	/**
+	 * Write all committed records to the file. The caller must hold _writerMonitor.
+	 * @return true if any record was consumed
+	 */
+	bool drainRecords(MM_EnvironmentBase *env);
+
+	void writeString(MM_EnvironmentBase *env, const char *string, uintptr_t length);
+
+	/**
+	 * Write events, rendered as text unless the file is binary.
+	 */
+	void writeEvents(MM_EnvironmentBase *env, const char *events, uintptr_t length);
+
+	/**
+	 * Write text that did not come from the writer chain (file header and footer, warnings), as an
+	 * event if the file is binary.
+	 * @param newline[in] true to end the text with a newline
+	 */
+	void writeText(MM_EnvironmentBase *env, const char *text, bool newline);
+
+	void notifyWriterThread();
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_ */
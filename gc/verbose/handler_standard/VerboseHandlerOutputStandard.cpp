@@ -25,11 +25,13 @@
 #include "omrgcconsts.h"
 #include "gcutils.h"
 
+#include "Bits.hpp"
 #include "ConcurrentGCStats.hpp"
 #include "ConcurrentMarkPhaseStats.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
 #include "VerboseHandlerOutputStandard.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -74,6 +76,10 @@ static void verboseHandlerConcurrentCollectionStart(J9HookInterface** hook, uint
 static void verboseHandlerConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+static void verboseHandlerConcurrentSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutputStandard::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
 {
@@ -155,6 +161,9 @@ MM_VerboseHandlerOutputStandard::enableVerbose()
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COMPLETE_TRACING_END, verboseHandlerConcurrentTracingEnd, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_END, verboseHandlerConcurrentCardCleaningEnd, OMR_GET_CALLSITE(), (void *)this);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COMPLETED_CONCURRENT_SWEEP, verboseHandlerConcurrentSweepEnd, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 
 	/* Excessive GC */
 	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_EXCESSIVEGC_RAISED, verboseHandlerExcessiveGCRaised, OMR_GET_CALLSITE(), this);
@@ -214,6 +223,9 @@ MM_VerboseHandlerOutputStandard::disableVerbose()
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COMPLETE_TRACING_END, verboseHandlerConcurrentTracingEnd, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_END, verboseHandlerConcurrentCardCleaningEnd, NULL);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COMPLETED_CONCURRENT_SWEEP, verboseHandlerConcurrentSweepEnd, NULL);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 
 	/* Excessive GC */
 	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_EXCESSIVEGC_RAISED, verboseHandlerExcessiveGCRaised, NULL);
@@ -412,6 +424,12 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 	if (event->cycleEnd) {
 		writer->formatAndOutput(env, 1, "<scavenger-info tenureage=\"%zu\" tenuremask=\"%4zx\" tiltratio=\"%zu\" />",
 				cycleScavengerStats->_tenureAge, cycleScavengerStats->getFlipHistory(0)->_tenureMask, cycleScavengerStats->_tiltRatio);
+		if (extensions->scavengerPretenuring) {
+			/* the size classes pretenured while the mutator filled the nursery this scavenge evacuated */
+			uintptr_t pretenureMask = extensions->scavengerPretenureSizeClassMask;
+			writer->formatAndOutput(env, 1, "<pretenuring sizeclassmask=\"%zx\" sizeclasses=\"%zu\" tenurebytes=\"%zu\" />",
+					pretenureMask, MM_Bits::populationCount(pretenureMask), cycleScavengerStats->getFlipHistory(1)->_tenureBytes[0]);
+		}
 	}
 
 	if (0 != scavengerStats->_flipCount) {
@@ -422,6 +440,21 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<memory-copied type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" bytesdiscarded=\"%zu\" />",
 				scavengerStats->_tenureAggregateCount, scavengerStats->_tenureAggregateBytes, scavengerStats->_tenureDiscardBytes);
 	}
+	if (extensions->scavengerNUMAAware && (1 < extensions->_numaManager.getAffinityLeaderCount())) {
+		uintptr_t nodeBins = OMR_MIN(extensions->_numaManager.getAffinityLeaderCount(), (uintptr_t)OMR_SCAVENGER_NUMA_NODE_BINS);
+		for (uintptr_t node = 0; node < nodeBins; node++) {
+			writer->formatAndOutput(env, 1, "<numa-memory-copied node=\"%zu\" bytes=\"%zu\" />", node, scavengerStats->_numaNodeCopiedBytes[node]);
+		}
+		writer->formatAndOutput(env, 1, "<numa-copy-chunks refills=\"%zu\" remote=\"%zu\" unboundbytes=\"%zu\" />",
+				scavengerStats->_numaCopyChunkRefills, scavengerStats->_numaRemoteChunkAllocations, scavengerStats->_numaNodeCopiedBytes[OMR_SCAVENGER_NUMA_NODE_UNBOUND]);
+		writer->formatAndOutput(env, 1, "<numa-scan-caches local=\"%zu\" remote=\"%zu\" />",
+				scavengerStats->_numaLocalCacheCount, scavengerStats->_numaRemoteCacheCount);
+	}
+	if (extensions->adaptiveScanCacheSizing && (0 != scavengerStats->_scanCacheSizeTargetCount)) {
+		writer->formatAndOutput(env, 1, "<scan-cache-sizing threads=\"%zu\" min=\"%zu\" max=\"%zu\" avg=\"%llu\" />",
+				scavengerStats->_scanCacheSizeTargetCount, scavengerStats->_scanCacheSizeTargetMin, scavengerStats->_scanCacheSizeTargetMax,
+				scavengerStats->_scanCacheSizeTargetSum / scavengerStats->_scanCacheSizeTargetCount);
+	}
 	if (0 != scavengerStats->_failedFlipCount) {
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"nursery\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedFlipCount, scavengerStats->_failedFlipBytes);
@@ -872,6 +905,73 @@ MM_VerboseHandlerOutputStandard::handleConcurrentAbortedInternal(MM_EnvironmentB
 }
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+const char *
+MM_VerboseHandlerOutputStandard::getSweepCompletionReasonString(uintptr_t reason)
+{
+	switch (reason) {
+	case ABOUT_TO_GC:
+		return "about to gc";
+	case COMPACTION_REQUIRED:
+		return "compaction required";
+	case CONTRACTION_REQUIRED:
+		return "contraction required";
+	case EXPANSION_REQUIRED:
+		return "expansion required";
+	case LOA_RESIZE:
+		return "loa resize";
+	case SYSTEM_GC:
+		return "system gc";
+	default:
+		return "unknown";
+	}
+}
+
+void
+MM_VerboseHandlerOutputStandard::handleConcurrentSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_CompletedConcurrentSweep *event = (MM_CompletedConcurrentSweep *)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_VerboseManager* manager = getManager();
+	MM_VerboseWriterChain* writer = manager->getWriterChain();
+
+	char tagTemplate[200];
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), omrtime_current_time_millis());
+	enterAtomicReportingBlock();
+	writer->formatAndOutput(env, 0, "<concurrent-sweep-end id=\"%zu\" reason=\"%s\" bytesSwept=\"%zu\" sweepms=\"%llu.%03.3llu\" bytesConnected=\"%zu\" connectms=\"%llu.%03.3llu\" %s/>",
+		manager->getIdAndIncrement(), getSweepCompletionReasonString(event->reason),
+		event->bytesSwept, event->timeElapsedSweep / 1000, event->timeElapsedSweep % 1000,
+		event->bytesConnected, event->timeElapsedConnect / 1000, event->timeElapsedConnect % 1000,
+		tagTemplate);
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+
+bool
+MM_VerboseHandlerOutputStandard::hasCycleEndInnerStanzas()
+{
+	return _extensions->hugePageAdvise;
+}
+
+void
+MM_VerboseHandlerOutputStandard::handleCycleEndInnerStanzas(J9HookInterface** hook, uintptr_t eventNum, void* eventData, uintptr_t indentDepth)
+{
+	MM_GCPostCycleEndEvent* event = (MM_GCPostCycleEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	MM_Heap *heap = _extensions->heap;
+
+	/* Huge page backing is read from the OS (/proc/self/smaps on Linux), so it is only queried for verbose output, once per cycle */
+	if (_extensions->isScavengerEnabled()) {
+		writer->formatAndOutput(env, indentDepth, "<huge-pages nursery=\"%zu\" tenure=\"%zu\" />",
+				heap->getHugePageBackedMemorySize(MEMORY_TYPE_NEW), heap->getHugePageBackedMemorySize(MEMORY_TYPE_OLD));
+	} else {
+		writer->formatAndOutput(env, indentDepth, "<huge-pages tenure=\"%zu\" />", heap->getHugePageBackedMemorySize(MEMORY_TYPE_OLD));
+	}
+}
+
 bool
 MM_VerboseHandlerOutputStandard::hasOutputMemoryInfoInnerStanza()
 {
@@ -954,6 +1054,11 @@ MM_VerboseHandlerOutputStandard::outputMemoryInfoInnerStanza(MM_EnvironmentBase
 	if (stats->_scavengerEnabled) {
 		writer->formatAndOutput(env, indent, "<remembered-set count=\"%zu\" />", stats->_rememberedSetCount);
 	}
+
+	/* Counts restart whenever the tenure allocate stats are reset (sweep, scavenge start), so only report non-empty ones */
+	if ((0 != stats->_freeListIndexHits) || (0 != stats->_freeListIndexMisses)) {
+		writer->formatAndOutput(env, indent, "<free-list-index hits=\"%zu\" misses=\"%zu\" />", stats->_freeListIndexHits, stats->_freeListIndexMisses);
+	}
 }
 
 void
@@ -1149,3 +1254,11 @@ verboseHandlerExcessiveGCRaised(J9HookInterface** hook, uintptr_t eventNum, void
 {
 	((MM_VerboseHandlerOutput *)userData)->handleExcessiveGCRaised(hook, eventNum, eventData);
 }
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+void
+verboseHandlerConcurrentSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandard *)userData)->handleConcurrentSweepEnd(hook, eventNum, eventData);
+}
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
@@ -61,6 +61,8 @@ protected:
 
 	void handleGCOPStanza(MM_EnvironmentBase* env, const char *type, uintptr_t contextID, uint64_t duration, bool deltaTimeSuccess);
 
+	virtual bool hasCycleEndInnerStanzas();
+	virtual void handleCycleEndInnerStanzas(J9HookInterface** hook, uintptr_t eventNum, void* eventData, uintptr_t indentDepth);
 	virtual bool hasOutputMemoryInfoInnerStanza();
 	virtual void outputMemoryInfoInnerStanzaInternal(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
 	virtual void outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
@@ -217,6 +219,22 @@ public:
 	 */
 	void handleConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	/**
+	 * Return the reason for completing a concurrent sweep as a string
+	 * @param reason SweepCompletionReason value
+	 */
+	const char *getSweepCompletionReasonString(uintptr_t reason);
+
+	/**
+	 * Write verbose stanza for the completion of a concurrent sweep (all chunks swept and connected).
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleConcurrentSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 };
 
 #endif /* VERBOSEHANDLEROUTPUTSTANDARD_HPP_ */
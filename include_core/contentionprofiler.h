@@ -0,0 +1,72 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(CONTENTIONPROFILER_H_)
+#define CONTENTIONPROFILER_H_
+
+/*
+ * @ddr_namespace: default
+ */
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define OMR_CONTENTION_PROFILER_MAX_FRAMES 32
+#define OMR_CONTENTION_PROFILER_MAX_NAME 64
+
+typedef struct OMRContentionSample {
+	volatile uintptr_t complete; /* set once the rest of the sample has been written */
+	uint64_t blockedTime; /* in getTimebase() ticks */
+	uintptr_t frameCount;
+	uintptr_t frames[OMR_CONTENTION_PROFILER_MAX_FRAMES]; /* instruction pointers, innermost first */
+	char monitorName[OMR_CONTENTION_PROFILER_MAX_NAME];
+} OMRContentionSample;
+
+typedef struct OMRContentionProfiler {
+	OMRPortLibrary *portLib;
+	OMRContentionSample *samples;
+	uintptr_t maxSamples;
+	volatile uintptr_t sampleCount; /* slots claimed so far, may exceed maxSamples */
+	uint64_t startTicks;
+	uint64_t startNanos;
+} OMRContentionProfiler;
+
+/* The profiler is driven by the contention sampler of the thread library, which requires OMR_THR_JLM. */
+#if defined(OMR_THR_JLM)
+OMRContentionProfiler *contentionProfilerNew(OMRPortLibrary *portLibrary, uintptr_t maxSamples);
+void contentionProfilerFree(OMRContentionProfiler *profiler);
+intptr_t contentionProfilerStart(OMRContentionProfiler *profiler, uintptr_t samplePeriod);
+void contentionProfilerStop(OMRContentionProfiler *profiler);
+uintptr_t contentionProfilerGetSampleCount(OMRContentionProfiler *profiler);
+intptr_t contentionProfilerDump(OMRContentionProfiler *profiler, intptr_t fd);
+#endif /* defined(OMR_THR_JLM) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONTENTIONPROFILER_H_ */
@@ -89,6 +89,7 @@ typedef struct J9Pool {
 #define POOL_ALWAYS_KEEP_SORTED  4
 #define POOL_ALLOC_TYPE_PUDDLE_LIST  2
 #define POOL_ALLOC_TYPE_POOL  0
+#define POOL_CONCURRENT  64
 
 /*
  * @ddr_namespace: map_to_type=J9PoolState
@@ -578,6 +578,15 @@ typedef struct OMRCgroupMetricIteratorState {
 #define OMRPORT_VMEM_ZTPF_USE_31BIT_MALLOC 64
 #define OMRPORT_VMEM_ADDRESS_HINT 128
 
+/**
+ * @name Virtual Memory Huge Page Advice
+ * Advice values for omrvmem_advise_huge_pages
+ *
+ */
+#define OMRPORT_VMEM_HUGE_PAGE_ADVICE_ENABLE 1
+#define OMRPORT_VMEM_HUGE_PAGE_ADVICE_DISABLE 2
+#define OMRPORT_VMEM_HUGE_PAGE_ADVICE_COLLAPSE 3
+
 /**
  * @name Virtual Memory Address
  * highest memory address on platform
@@ -2125,6 +2134,10 @@ typedef struct OMRPortLibrary {
 	int32_t (*vmem_get_available_physical_memory)(struct OMRPortLibrary *portLibrary, uint64_t *freePhysicalMemorySize);
 	/** see @ref omrvmem.c::omrvmem_get_process_memory_size "omrvmem_get_process_memory_size"*/
 	int32_t (*vmem_get_process_memory_size)(struct OMRPortLibrary *portLibrary, J9VMemMemoryQuery queryType, uint64_t *memorySize);
+	/** see @ref omrvmem.c::omrvmem_advise_huge_pages "omrvmem_advise_huge_pages"*/
+	int32_t (*vmem_advise_huge_pages)(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t advice);
+	/** see @ref omrvmem.c::omrvmem_get_huge_page_backed_size "omrvmem_get_huge_page_backed_size"*/
+	int32_t (*vmem_get_huge_page_backed_size)(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uint64_t *backedSize);
 	/** see @ref omrstr.c::omrstr_startup "omrstr_startup"*/
 	int32_t (*str_startup)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrstr.c::omrstr_shutdown "omrstr_shutdown"*/
@@ -2914,6 +2927,8 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrvmem_numa_get_node_details(param1,param2) privateOmrPortLibrary->vmem_numa_get_node_details(privateOmrPortLibrary, (param1), (param2))
 #define omrvmem_get_available_physical_memory(param1) privateOmrPortLibrary->vmem_get_available_physical_memory(privateOmrPortLibrary, (param1))
 #define omrvmem_get_process_memory_size(param1,param2) privateOmrPortLibrary->vmem_get_process_memory_size(privateOmrPortLibrary, (param1), (param2))
+#define omrvmem_advise_huge_pages(param1,param2,param3) privateOmrPortLibrary->vmem_advise_huge_pages(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrvmem_get_huge_page_backed_size(param1,param2,param3) privateOmrPortLibrary->vmem_get_huge_page_backed_size(privateOmrPortLibrary, (param1), (param2), (param3))
 #define omrstr_startup() privateOmrPortLibrary->str_startup(privateOmrPortLibrary)
 #define omrstr_shutdown() privateOmrPortLibrary->str_shutdown(privateOmrPortLibrary)
 #define omrstr_printf(...) privateOmrPortLibrary->str_printf(privateOmrPortLibrary, __VA_ARGS__)
@@ -47,6 +47,7 @@ typedef intptr_t omrthread_os_errno_t;
 typedef struct J9Thread *omrthread_t;
 typedef struct J9ThreadMonitor *omrthread_monitor_t;
 typedef struct J9Semaphore *j9sem_t;
+typedef void (*omrthread_contention_sampler_t)(omrthread_t self, omrthread_monitor_t monitor, uint64_t blockedTime, void *userData);
 
 #include "omrthread_generated.h"
 
@@ -95,6 +96,7 @@ or omrthread priority value.
 #define J9THREAD_LIB_FLAG_JLM_TIME_STAMPS_ENABLED  0x8000
 #define J9THREAD_LIB_FLAG_JLMHST_ENABLED  0x10000
 #define J9THREAD_LIB_FLAG_JLM_HAS_BEEN_ENABLED  0x20000
+#define J9THREAD_LIB_FLAG_ADAPTIVE_SPIN_TUNING_ENABLED  0x40000
 #define J9THREAD_LIB_FLAG_JLM_ENABLED_ALL  (J9THREAD_LIB_FLAG_JLM_ENABLED|J9THREAD_LIB_FLAG_JLM_TIME_STAMPS_ENABLED|J9THREAD_LIB_FLAG_JLMHST_ENABLED)
 #define J9THREAD_LIB_FLAG_JLM_HOLDTIME_SAMPLING_ENABLED  0x100000
 #define J9THREAD_LIB_FLAG_JLM_SLOW_SAMPLING_ENABLED  0x200000
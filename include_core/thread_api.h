@@ -51,6 +51,9 @@ extern "C" {
 #define J9THREAD_RWMUTEX_FAIL	 	 1
 #define J9THREAD_RWMUTEX_WOULDBLOCK -1
 
+/* omrthread_rwmutex_init flags */
+#define J9THREAD_RWMUTEX_READER_BIASED 0x1 /* readers use striped counters; writers drain them */
+
 /* Define conversions for units of time used in thrprof.c */
 #define SEC_TO_NANO_CONVERSION_CONSTANT		(1000 * 1000 * 1000)
 #define MICRO_TO_NANO_CONVERSION_CONSTANT	1000
@@ -598,6 +601,18 @@ intptr_t
 omrthread_jlm_init(uintptr_t flags);
 #endif /* defined(OMR_THR_JLM) */
 
+#if defined(OMR_THR_JLM)
+/**
+* @brief
+* @param sampler
+* @param userData
+* @param samplePeriod
+* @return intptr_t
+*/
+intptr_t
+omrthread_jlm_set_contention_sampler(omrthread_contention_sampler_t sampler, void *userData, uintptr_t samplePeriod);
+#endif /* defined(OMR_THR_JLM) */
+
 #if defined(OMR_THR_ADAPTIVE_SPIN)
 /**
  * @brief initializes jlm for capturing data needed by the adaptive spin options
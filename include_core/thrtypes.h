@@ -54,6 +54,9 @@ typedef struct J9Thread {
 #if !defined(OMR_OS_WINDOWS)
 	uintptr_t key_deletion_attempts;
 #endif /* !OMR_OS_WINDOWS */
+#if defined(OMR_THR_JLM)
+	uintptr_t contentionSampleCountdown;
+#endif /* OMR_THR_JLM */
 } J9Thread;
 
 /*
@@ -112,6 +115,10 @@ typedef struct J9ThreadLibrary {
 	struct J9Pool *thread_tracing_pool;
 	struct J9ThreadMonitorTracing *gc_lock_tracing;
 	uint64_t clock_skew;
+	omrthread_contention_sampler_t contentionSampler;
+	void *contentionSamplerUserData;
+	uintptr_t contentionSamplePeriod;
+	volatile uintptr_t contentionSamplersActive;
 #endif /* OMR_THR_JLM */
 #if defined(OMR_THR_THREE_TIER_LOCKING)
 	uintptr_t defaultMonitorSpinCount1;
@@ -25,6 +25,7 @@
 #include <vector>
 #include <iterator>
 #include <numeric>
+#include <string>
 #include <stdio.h>
 
 #include "pugixml.hpp"
@@ -37,13 +38,39 @@ const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
 const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
 const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']";
 const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
+const char* XPATH_GET_ALL_SCAVENGE_TIME = "/verbosegc/gc-op[@type='scavenge']";
+const char* XPATH_GET_ALL_PAUSE_TIME = "/verbosegc/exclusive-end";
+const char* XPATH_GET_ALL_MUTATOR_TIME = "/verbosegc/exclusive-start";
+const char* XPATH_GET_ALL_ALLOCATED_BYTES = "/verbosegc/allocation-stats";
+const char* XPATH_GET_ALL_GC_END_MEMINFO = "/verbosegc/gc-end/mem-info";
 const char* SRC_DIR = "./";
 const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
+const char* JSON_OPTION = "-json=";
+const char* DEFAULT_JSON_FILE = "omrperfgctest.json";
+
+/**
+ * Per-log summary reported in the JSON output, for regression tracking across runs.
+ */
+struct PauseSummary {
+	std::string workload;
+	uintptr_t pauseCount;
+	double p50Pause;
+	double p99Pause;
+	double maxPause;
+	double totalPause;
+	double totalMutator;
+	double throughputPercent;
+	double allocationRate;
+	double avgOccupancyPercent;
+	double maxOccupancyPercent;
+};
 
 double getAvg(std::vector<double> v);
-void analyze(char* fileName, OMRPortLibrary portLibrary);
+double getPercentile(std::vector<double> v, double percentile);
+void analyze(char* fileName, OMRPortLibrary portLibrary, std::vector<PauseSummary> *summaries);
+bool writeJSON(const char *jsonFileName, std::vector<PauseSummary> *summaries, OMRPortLibrary portLibrary);
 
-int main(void)
+int main(int argc, char *argv[])
 {
 	int32_t totalFiles = 0;
 	intptr_t rc = 0;
@@ -51,6 +78,17 @@ int main(void)
 	uintptr_t rcFile;
 	uintptr_t handle;
 	OMRPortLibrary portLibrary;
+	const char *jsonFileName = DEFAULT_JSON_FILE;
+	std::vector<PauseSummary> summaries;
+
+	for (int i = 1; i < argc; i++) {
+		if (0 == strncmp(argv[i], JSON_OPTION, strlen(JSON_OPTION))) {
+			jsonFileName = argv[i] + strlen(JSON_OPTION);
+		} else {
+			fprintf(stderr, "Unrecognized option: %s (usage: omrperfgctest [%s<file>])\n", argv[i], JSON_OPTION);
+			return -1;
+		}
+	}
 
 	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
 	if (0 != rc) {
@@ -75,7 +113,7 @@ int main(void)
 
 	while ((uintptr_t)-1 != rcFile) {
 		if (strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX)) == 0) {
-			analyze(resultBuffer, portLibrary);
+			analyze(resultBuffer, portLibrary, &summaries);
 			totalFiles++;
 			/* Clean up verbose log file */
 			omrfile_unlink(resultBuffer);
@@ -88,6 +126,10 @@ int main(void)
 
 	if(totalFiles < 1) {
 		omrtty_printf("Failed to find any verbose GC file to process!\n\n");
+	} else if (!writeJSON(jsonFileName, &summaries, portLibrary)) {
+		omrtty_printf("Failed to write results to %s\n", jsonFileName);
+	} else {
+		omrtty_printf("Results for %d verbose GC file(s) written to %s\n", totalFiles, jsonFileName);
 	}
 
 	portLibrary.port_shutdown_library(&portLibrary);
@@ -102,18 +144,99 @@ getAvg(std::vector<double> v)
 	return avg;
 }
 
+/**
+ * Nearest-rank percentile of v; 0 if v is empty.
+ */
+double
+getPercentile(std::vector<double> v, double percentile)
+{
+	double result = 0;
+	if (!v.empty()) {
+		std::sort(v.begin(), v.end());
+		size_t rank = (size_t)((percentile / 100.0) * v.size() + 0.999999);
+		if (0 == rank) {
+			rank = 1;
+		}
+		result = v[std::min(rank, v.size()) - 1];
+	}
+	return result;
+}
+
+/**
+ * Derive the workload name from the verbose log name by dropping the VerboseGC prefix
+ * and the _<pid>_<time>.xml suffix appended by GCConfigTest.
+ */
+static std::string
+getWorkloadName(const char *fileName)
+{
+	std::string name(fileName);
+	if (0 == name.compare(0, strlen(VERBOSE_GC_FILE_PREFIX), VERBOSE_GC_FILE_PREFIX)) {
+		name.erase(0, strlen(VERBOSE_GC_FILE_PREFIX));
+		if (!name.empty() && (('_' == name[0]) || ('-' == name[0]))) {
+			name.erase(0, 1);
+		}
+	}
+	for (int i = 0; i < 2; i++) {
+		size_t separator = name.rfind('_');
+		if (std::string::npos != separator) {
+			name.erase(separator);
+		}
+	}
+	return name;
+}
+
+bool
+writeJSON(const char *jsonFileName, std::vector<PauseSummary> *summaries, OMRPortLibrary portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+	intptr_t fd = omrfile_open(jsonFileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		return false;
+	}
+
+	omrfile_printf(fd, "{\n  \"results\": [");
+	for (std::vector<PauseSummary>::const_iterator it = summaries->begin(); it != summaries->end(); ++it) {
+		omrfile_printf(fd, "%s\n    {\n", (it == summaries->begin()) ? "" : ",");
+		omrfile_printf(fd, "      \"workload\": \"%s\",\n", it->workload.c_str());
+		omrfile_printf(fd, "      \"pauses\": %zu,\n", (size_t)it->pauseCount);
+		omrfile_printf(fd, "      \"pauseMs\": { \"p50\": %.3f, \"p99\": %.3f, \"max\": %.3f, \"total\": %.3f },\n",
+				it->p50Pause, it->p99Pause, it->maxPause, it->totalPause);
+		omrfile_printf(fd, "      \"mutatorMs\": %.3f,\n", it->totalMutator);
+		omrfile_printf(fd, "      \"throughputPercent\": %.2f,\n", it->throughputPercent);
+		omrfile_printf(fd, "      \"allocationMBPerSec\": %.2f,\n", it->allocationRate);
+		omrfile_printf(fd, "      \"heapOccupancyPercent\": { \"avg\": %.2f, \"max\": %.2f }\n",
+				it->avgOccupancyPercent, it->maxOccupancyPercent);
+		omrfile_printf(fd, "    }");
+	}
+	omrfile_printf(fd, "\n  ]\n}\n");
+
+	return 0 == omrfile_close(fd);
+}
+
 void
-analyze(char* fileName, OMRPortLibrary portLibrary)
+analyze(char* fileName, OMRPortLibrary portLibrary, std::vector<PauseSummary> *summaries)
 {
 	std::vector<double> mark_values;
 	std::vector<double> sweep_values;
 	std::vector<double> expand_values;
 	std::vector<double> gcduration_values;
+	std::vector<double> scavenge_values;
+	std::vector<double> pause_values;
+	std::vector<double> occupancy_values;
 
 	pugi::xpath_node_set markTimes;
 	pugi::xpath_node_set sweepTimes;
 	pugi::xpath_node_set expandTimes;
 	pugi::xpath_node_set gcTimes;
+	pugi::xpath_node_set scavengeTimes;
+
+	/* bytes traced by mark and copied by scavenge, to normalize phase times to ms per GB */
+	double markBytes = 0;
+	double scavengeBytes = 0;
+
+	/* time between exclusive accesses, and bytes allocated in it, for throughput and allocation rate */
+	double totalMutator = 0;
+	double allocatedBytes = 0;
 
 	double maxMark = 0;
 	double minMark = 0;
@@ -147,6 +270,7 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	    pugi::xpath_node node = *it;
 	    double value = node.node().attribute("timems").as_double();
 	    mark_values.push_back(value);
+	    markBytes += node.node().child("trace-info").attribute("scanbytes").as_double();
 	}
 
 	sweepTimes = doc.select_nodes(XPATH_GET_ALL_SWEEP_TIME);
@@ -170,6 +294,39 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	    gcduration_values.push_back(value);
 	}
 
+	scavengeTimes = doc.select_nodes(XPATH_GET_ALL_SCAVENGE_TIME);
+	for (pugi::xpath_node_set::const_iterator it = scavengeTimes.begin(); it != scavengeTimes.end(); ++it) {
+	    pugi::xpath_node node = *it;
+	    double value = node.node().attribute("timems").as_double();
+	    scavenge_values.push_back(value);
+	    for (pugi::xml_node copied = node.node().child("memory-copied"); copied; copied = copied.next_sibling("memory-copied")) {
+	        scavengeBytes += copied.attribute("bytes").as_double();
+	    }
+	}
+
+	pugi::xpath_node_set pauseTimes = doc.select_nodes(XPATH_GET_ALL_PAUSE_TIME);
+	for (pugi::xpath_node_set::const_iterator it = pauseTimes.begin(); it != pauseTimes.end(); ++it) {
+	    pause_values.push_back(it->node().attribute("durationms").as_double());
+	}
+
+	pugi::xpath_node_set mutatorTimes = doc.select_nodes(XPATH_GET_ALL_MUTATOR_TIME);
+	for (pugi::xpath_node_set::const_iterator it = mutatorTimes.begin(); it != mutatorTimes.end(); ++it) {
+	    totalMutator += it->node().attribute("intervalms").as_double();
+	}
+
+	pugi::xpath_node_set allocationStats = doc.select_nodes(XPATH_GET_ALL_ALLOCATED_BYTES);
+	for (pugi::xpath_node_set::const_iterator it = allocationStats.begin(); it != allocationStats.end(); ++it) {
+	    allocatedBytes += it->node().attribute("totalBytes").as_double();
+	}
+
+	pugi::xpath_node_set memInfos = doc.select_nodes(XPATH_GET_ALL_GC_END_MEMINFO);
+	for (pugi::xpath_node_set::const_iterator it = memInfos.begin(); it != memInfos.end(); ++it) {
+	    double total = it->node().attribute("total").as_double();
+	    if (0 < total) {
+	        occupancy_values.push_back(100.0 * (total - it->node().attribute("free").as_double()) / total);
+	    }
+	}
+
 	if (!mark_values.empty()) {
 		maxMark = *std::max_element(mark_values.begin(), mark_values.end());
 		minMark = *std::min_element(mark_values.begin(), mark_values.end());
@@ -204,4 +361,32 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 
 	omrtty_printf("Average : %f        %f        %f        %f\n\n",
 								avgMark, avgSweep, avgExpand, avgGCDuration);
+
+	const double bytesPerGB = 1024.0 * 1024.0 * 1024.0;
+	double totalMark = std::accumulate(mark_values.begin(), mark_values.end(), 0.0);
+	double totalScavenge = std::accumulate(scavenge_values.begin(), scavenge_values.end(), 0.0);
+	omrtty_printf("            Mark ms/GB      Scavenge ms/GB\n");
+	omrtty_printf("-------------------------------------------------------------------\n");
+	omrtty_printf("Total   : %f        %f\n\n",
+								(0 < markBytes) ? (totalMark * bytesPerGB / markBytes) : 0.0,
+								(0 < scavengeBytes) ? (totalScavenge * bytesPerGB / scavengeBytes) : 0.0);
+
+	PauseSummary summary;
+	summary.workload = getWorkloadName(fileName);
+	summary.pauseCount = pause_values.size();
+	summary.p50Pause = getPercentile(pause_values, 50);
+	summary.p99Pause = getPercentile(pause_values, 99);
+	summary.maxPause = pause_values.empty() ? 0 : *std::max_element(pause_values.begin(), pause_values.end());
+	summary.totalPause = std::accumulate(pause_values.begin(), pause_values.end(), 0.0);
+	summary.totalMutator = totalMutator;
+	summary.throughputPercent = (0 < (totalMutator + summary.totalPause)) ? (100.0 * totalMutator / (totalMutator + summary.totalPause)) : 0.0;
+	summary.allocationRate = (0 < totalMutator) ? ((allocatedBytes / (1024.0 * 1024.0)) / (totalMutator / 1000.0)) : 0.0;
+	summary.avgOccupancyPercent = occupancy_values.empty() ? 0 : getAvg(occupancy_values);
+	summary.maxOccupancyPercent = occupancy_values.empty() ? 0 : *std::max_element(occupancy_values.begin(), occupancy_values.end());
+	summaries->push_back(summary);
+
+	omrtty_printf("            Pause p50       Pause p99       Pause max       Throughput %%   Occupancy %%\n");
+	omrtty_printf("-------------------------------------------------------------------\n");
+	omrtty_printf("Total   : %f        %f        %f        %f        %f\n\n",
+								summary.p50Pause, summary.p99Pause, summary.maxPause, summary.throughputPercent, summary.avgOccupancyPercent);
 }
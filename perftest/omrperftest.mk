@@ -46,4 +46,17 @@ omr_perfgctest:
 	./omrgctest --gtest_filter="perfTest*" -keepVerboseLog
 	./omrperfgctest
 
-.PHONY: all test omr_perfgctest 
+OMR_PAUSE_BENCHMARK_JSON ?= omrpausebenchmark.json
+
+OMR_PAUSE_BENCHMARK_GC_THREADS ?= 1 4
+
+# Runs the pause benchmark matrix (perftest/gctest/configuration/pause_<policy>_<workload>.xml) once per
+# thread count in OMR_PAUSE_BENCHMARK_GC_THREADS and writes per-workload pause percentiles, throughput
+# and heap occupancy as JSON (workloads are reported as pause_<policy>_<workload>_t<n>).
+omr_pausebenchmark:
+	for threads in $(OMR_PAUSE_BENCHMARK_GC_THREADS); do \
+		./omrgctest --gtest_filter="pauseBenchmark*" -keepVerboseLog -gcThreadCount=$$threads || exit 1; \
+	done
+	./omrperfgctest -json=$(OMR_PAUSE_BENCHMARK_JSON)
+
+.PHONY: all test omr_perfgctest omr_pausebenchmark 
@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * Renders verbose GC logs written with -Xgc:asyncLoggingBinary as the XML the other writers produce
+ * (gc/verbose/schema.xsd).
+ *
+ * usage: omrvgcrender <binary log> [<xml file>]
+ * The XML is written to standard output if no xml file is given.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "VerboseEventStream.hpp"
+
+static bool
+readFile(const char *fileName, std::vector<uint8_t> *contents)
+{
+	FILE *file = fopen(fileName, "rb");
+	if (NULL == file) {
+		return false;
+	}
+	uint8_t chunk[64 * 1024];
+	size_t count = 0;
+	while (0 != (count = fread(chunk, 1, sizeof(chunk), file))) {
+		contents->insert(contents->end(), chunk, chunk + count);
+	}
+	bool result = (0 == ferror(file));
+	fclose(file);
+	return result;
+}
+
+/**
+ * Render every event of a binary log.
+ * @return 0 on success, -1 if the log is not a binary verbose GC log or is truncated
+ */
+static int
+render(OMRPortLibrary *portLibrary, const char *inputName, std::vector<uint8_t> *log, FILE *output)
+{
+	if ((log->size() < VERBOSE_EVENT_STREAM_MAGIC_LENGTH) || (0 != memcmp(&(*log)[0], VERBOSE_EVENT_STREAM_MAGIC, VERBOSE_EVENT_STREAM_MAGIC_LENGTH))) {
+		fprintf(stderr, "%s is not a binary verbose GC log (written with -Xgc:asyncLoggingBinary)\n", inputName);
+		return -1;
+	}
+
+	std::vector<char> text(4096);
+	uintptr_t cursor = VERBOSE_EVENT_STREAM_MAGIC_LENGTH;
+	while (cursor < log->size()) {
+		const uint8_t *event = &(*log)[cursor];
+		uintptr_t remaining = log->size() - cursor;
+		if ((remaining < sizeof(MM_VerboseEventStream::EventHeader))
+			|| (MM_VerboseEventStream::getEventLength(event) < sizeof(MM_VerboseEventStream::EventHeader))
+			|| (MM_VerboseEventStream::getEventLength(event) > remaining)
+		) {
+			fprintf(stderr, "%s is truncated at offset %zu\n", inputName, (size_t)cursor);
+			return -1;
+		}
+
+		uintptr_t length = MM_VerboseEventStream::render(portLibrary, event, &text[0], text.size());
+		if (length >= text.size()) {
+			text.resize(length + 1);
+			MM_VerboseEventStream::render(portLibrary, event, &text[0], text.size());
+		}
+		fwrite(&text[0], 1, length, output);
+		cursor += MM_VerboseEventStream::getEventLength(event);
+	}
+
+	return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+	OMRPortLibrary portLibrary;
+	std::vector<uint8_t> log;
+	FILE *output = stdout;
+	int rc = 0;
+
+	if ((argc < 2) || (argc > 3)) {
+		fprintf(stderr, "usage: omrvgcrender <binary log> [<xml file>]\n");
+		return -1;
+	}
+
+	if (!readFile(argv[1], &log)) {
+		fprintf(stderr, "Failed to read %s\n", argv[1]);
+		return -1;
+	}
+
+	if (0 != omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT)) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed\n");
+		return -1;
+	}
+
+	if (0 != omrport_init_library(&portLibrary, sizeof(OMRPortLibrary))) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)) failed\n");
+		omrthread_detach(NULL);
+		return -1;
+	}
+
+	if (3 == argc) {
+		output = fopen(argv[2], "wb");
+		if (NULL == output) {
+			fprintf(stderr, "Failed to open %s\n", argv[2]);
+			rc = -1;
+		}
+	}
+
+	if (0 == rc) {
+		rc = render(&portLibrary, argv[1], &log, output);
+		if (stdout != output) {
+			fclose(output);
+		}
+	}
+
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return rc;
+}
@@ -433,3 +433,40 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 {
 	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
 }
+
+/**
+ * Advise the operating system on transparent huge page backing for a range of committed virtual memory.
+ * The range is rounded inwards to the base page size.
+ *
+ * @param [in] portLibrary port library
+ * @param [in] address The starting address of the range
+ * @param [in] byteAmount The size of the range in bytes
+ * @param [in] advice One of OMRPORT_VMEM_HUGE_PAGE_ADVICE_ENABLE (allow huge pages to back the range),
+ * OMRPORT_VMEM_HUGE_PAGE_ADVICE_DISABLE (prevent huge pages from backing the range) or
+ * OMRPORT_VMEM_HUGE_PAGE_ADVICE_COLLAPSE (synchronously back the range with huge pages where possible)
+ *
+ * @return 0 on success, OMRPORT_ERROR_VMEM_OPFAILED if an error occurred, or OMRPORT_ERROR_VMEM_NOT_SUPPORTED.
+ */
+int32_t
+omrvmem_advise_huge_pages(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t advice)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
+
+/**
+ * Get the number of bytes of a range of virtual memory that are currently backed by transparent huge pages.
+ * Where the operating system only reports huge page usage per mapping, mappings that partially overlap the
+ * range are attributed in proportion to the overlap.
+ *
+ * @param [in] portLibrary port library
+ * @param [in] address The starting address of the range
+ * @param [in] byteAmount The size of the range in bytes
+ * @param [out] backedSize pointer to variable to receive result
+ *
+ * @return 0 on success, OMRPORT_ERROR_VMEM_OPFAILED if an error occurred, or OMRPORT_ERROR_VMEM_NOT_SUPPORTED.
+ */
+int32_t
+omrvmem_get_huge_page_backed_size(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uint64_t *backedSize)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
@@ -55,6 +55,13 @@
 #if !defined(MADV_HUGEPAGE)
 #define MADV_HUGEPAGE 14
 #endif /* MADV_HUGEPAGE */
+#if !defined(MADV_NOHUGEPAGE)
+#define MADV_NOHUGEPAGE 15
+#endif /* MADV_NOHUGEPAGE */
+/* MADV_COLLAPSE is only defined by Linux 6.1 and later headers; older kernels reject it with EINVAL */
+#if !defined(MADV_COLLAPSE)
+#define MADV_COLLAPSE 25
+#endif /* MADV_COLLAPSE */
 
 #if !defined(MFD_HUGETLB)
 #define MFD_HUGETLB 0x4
@@ -88,6 +95,7 @@
 #define VMEM_MEMINFO_SIZE_MAX   2048
 #define VMEM_PROC_MEMINFO_FNAME "/proc/meminfo"
 #define VMEM_PROC_MAPS_FNAME    "/proc/self/maps"
+#define VMEM_PROC_SMAPS_FNAME   "/proc/self/smaps"
 
 #define VMEM_TRANSPARENT_HUGEPAGE_FNAME "/sys/kernel/mm/transparent_hugepage/enabled"
 #define VMEM_TRANSPARENT_HUGEPAGE_MADVISE "always [madvise] never"
@@ -2357,3 +2365,88 @@ addressIterator_next(AddressIterator *iterator, ADDRESS *address)
 
 	return hasNext;
 }
+
+int32_t
+omrvmem_advise_huge_pages(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t advice)
+{
+	uintptr_t pageSize = PPG_vmem_pageSize[0];
+	uintptr_t start = (uintptr_t)address;
+	uintptr_t end = (uintptr_t)address + byteAmount;
+	int madviseAdvice = 0;
+
+	switch (advice) {
+	case OMRPORT_VMEM_HUGE_PAGE_ADVICE_ENABLE:
+		madviseAdvice = MADV_HUGEPAGE;
+		break;
+	case OMRPORT_VMEM_HUGE_PAGE_ADVICE_DISABLE:
+		madviseAdvice = MADV_NOHUGEPAGE;
+		break;
+	case OMRPORT_VMEM_HUGE_PAGE_ADVICE_COLLAPSE:
+		madviseAdvice = MADV_COLLAPSE;
+		break;
+	default:
+		return OMRPORT_ERROR_VMEM_OPFAILED;
+	}
+
+	/* madvise requires a page aligned start, so round the range inwards */
+	start = start + ((start % pageSize) ? (pageSize - (start % pageSize)) : 0);
+	end = end - (end % pageSize);
+	if (start < end) {
+		if (0 != madvise((void *)start, end - start, madviseAdvice)) {
+			int madviseErrno = errno;
+			Trc_PRT_vmem_advise_huge_pages_failed(address, byteAmount, advice, madviseErrno);
+			if (EINVAL == madviseErrno) {
+				/* kernel predates the advice (MADV_COLLAPSE needs Linux 6.1) or was built without THP */
+				return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+			}
+			return OMRPORT_ERROR_VMEM_OPFAILED;
+		}
+	}
+	return 0;
+}
+
+int32_t
+omrvmem_get_huge_page_backed_size(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uint64_t *backedSize)
+{
+	uintptr_t rangeStart = (uintptr_t)address;
+	uintptr_t rangeEnd = (uintptr_t)address + byteAmount;
+	uintptr_t mappingStart = 0;
+	uintptr_t mappingEnd = 0;
+	uint64_t result = 0;
+	char *line = NULL;
+	size_t lineSize = 0;
+	FILE *smapsStream = fopen(VMEM_PROC_SMAPS_FNAME, "r");
+
+	if (NULL == smapsStream) {
+		Trc_PRT_vmem_get_huge_page_backed_size_failed(VMEM_PROC_SMAPS_FNAME, errno);
+		return OMRPORT_ERROR_VMEM_OPFAILED;
+	}
+
+	/* Each mapping starts with a "start-end perms ..." header line followed by "Key: value" lines.  Header lines end
+	 * with the mapped path, which has no length limit, so whole lines are read with getline() rather than into a fixed
+	 * buffer, whose tail would otherwise be parsed as a line of its own.  getline() expects a malloc()ed buffer which it
+	 * can resize, so it cannot come from the port library allocators.
+	 */
+	while (-1 != getline(&line, &lineSize, smapsStream)) {
+		uintptr_t headerStart = 0;
+		uintptr_t headerEnd = 0;
+		unsigned long anonHugePagesKB = 0;
+		if (2 == sscanf(line, "%" SCNxPTR "-%" SCNxPTR " ", &headerStart, &headerEnd)) {
+			mappingStart = headerStart;
+			mappingEnd = headerEnd;
+		} else if ((1 == sscanf(line, "AnonHugePages: %lu kB", &anonHugePagesKB)) && (0 != anonHugePagesKB)) {
+			uintptr_t overlapStart = OMR_MAX(mappingStart, rangeStart);
+			uintptr_t overlapEnd = OMR_MIN(mappingEnd, rangeEnd);
+			if (overlapStart < overlapEnd) {
+				/* smaps only reports per mapping, attribute huge pages in proportion to the overlap */
+				uint64_t mappingBacked = (uint64_t)anonHugePagesKB * 1024;
+				result += (uint64_t)((double)mappingBacked * ((double)(overlapEnd - overlapStart) / (double)(mappingEnd - mappingStart)));
+			}
+		}
+	}
+	free(line);
+	fclose(smapsStream);
+
+	*backedSize = result;
+	return 0;
+}
@@ -913,6 +913,10 @@ extern J9_CFUNC int32_t
 omrvmem_get_available_physical_memory(struct OMRPortLibrary *portLibrary, uint64_t *freePhysicalMemorySize);
 extern J9_CFUNC int32_t
 omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemoryQuery queryType, uint64_t *memorySize);
+extern J9_CFUNC int32_t
+omrvmem_advise_huge_pages(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t advice);
+extern J9_CFUNC int32_t
+omrvmem_get_huge_page_backed_size(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uint64_t *backedSize);
 
 /* J9SourcePort*/
 extern J9_CFUNC int32_t
@@ -1580,3 +1580,15 @@ omrvmem_create_double_mapped_region(struct OMRPortLibrary *portLibrary, void* re
 	portLibrary->error_set_last_error(portLibrary,  errno, OMRPORT_ERROR_VMEM_NOT_SUPPORTED);
 	return NULL;
 }
+
+int32_t
+omrvmem_advise_huge_pages(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t advice)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
+
+int32_t
+omrvmem_get_huge_page_backed_size(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uint64_t *backedSize)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
@@ -254,6 +254,11 @@ omrthread_init(omrthread_library_t lib)
 	lib->stack_usage = 0;
 #endif /* defined(OMR_OS_WINDOWS) */
 	lib->flags = 0;
+#if defined(OMR_THR_JLM)
+	lib->contentionSampler = NULL;
+	lib->contentionSamplePeriod = 0;
+	lib->contentionSamplersActive = 0;
+#endif /* OMR_THR_JLM */
 
 	omrthread_mem_init(lib);
 
@@ -960,6 +965,9 @@ postForkResetMonitors(omrthread_t self)
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
 					entry->spinThreads = 0;
 #endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
+#if defined(OMR_THR_FUTEX_LOCKS)
+					entry->futexWaiters = 0;
+#endif /* defined(OMR_THR_FUTEX_LOCKS) */
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
 				} else {
 #if defined(OMR_THR_THREE_TIER_LOCKING)
@@ -3747,6 +3755,9 @@ monitor_init(omrthread_monitor_t monitor, uintptr_t flags, omrthread_library_t l
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
 	monitor->spinThreads = 0;
 #endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
+#if defined(OMR_THR_FUTEX_LOCKS)
+	monitor->futexWaiters = 0;
+#endif /* defined(OMR_THR_FUTEX_LOCKS) */
 
 	ASSERT(monitor->spinCount1 != 0);
 	ASSERT(monitor->spinCount2 != 0);
@@ -3980,6 +3991,7 @@ static intptr_t
 monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable)
 {
 	int blockedCount = 0;
+	uint64_t blockStart = 0;
 #if defined(OMR_THR_MCS_LOCKS)
 	omrthread_mcs_node_t mcsNode = omrthread_mcs_node_allocate(self);
 #endif /* defined(OMR_THR_MCS_LOCKS) */
@@ -4004,6 +4016,30 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 			break;
 		}
 
+#if defined(OMR_THR_FUTEX_LOCKS)
+		if (SET_ABORTABLE != isAbortable) {
+			/*
+			 * Sleep on the spinlock word itself instead of the monitor mutex. Abortable enters
+			 * stay on the mutex path below, where omrthread_abort() can wake them. The monitor
+			 * mutex is not taken: the thread is not queued on monitor->blocking, but is counted
+			 * in monitor->futexWaiters and marked blocked on the monitor for introspection.
+			 */
+			if (J9THREAD_MONITOR_SPINLOCK_UNOWNED != omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED)) {
+				CONTENTION_SAMPLE_BLOCK(self, blockedCount, blockStart);
+				blockedCount++;
+				THREAD_LOCK(self, CALLER_MONITOR_ENTER_THREE_TIER2);
+				self->flags |= J9THREAD_FLAG_BLOCKED;
+				self->monitor = monitor;
+				THREAD_UNLOCK(self);
+
+				omrthread_spinlock_futex_block(monitor);
+			}
+			monitor->owner = self;
+			monitor->count = 1;
+			break;
+		}
+#endif /* defined(OMR_THR_FUTEX_LOCKS) */
+
 		MONITOR_LOCK(monitor, CALLER_MONITOR_ENTER_THREE_TIER1);
 
 #if !defined(OMR_THR_MCS_LOCKS)
@@ -4017,6 +4053,7 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 		}
 #endif /* !defined(OMR_THR_MCS_LOCKS) */
 
+		CONTENTION_SAMPLE_BLOCK(self, blockedCount, blockStart);
 		blockedCount++;
 
 		THREAD_LOCK(self, CALLER_MONITOR_ENTER_THREE_TIER2);
@@ -4107,6 +4144,7 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 	}
 
 	UPDATE_JLM_MON_ENTER(self, monitor, !IS_RECURSIVE_ENTER, (blockedCount > 0));
+	CONTENTION_SAMPLE_ENTER(self, monitor, blockStart);
 
 	ASSERT(!(self->flags & J9THREAD_FLAG_BLOCKED));
 	ASSERT(0 == self->monitor);
@@ -4152,6 +4190,27 @@ unblock_spinlock_threads(omrthread_t self, omrthread_monitor_t monitor)
 	}
 }
 
+#if defined(OMR_THR_FUTEX_LOCKS)
+/**
+ * Wake the threads sleeping on a monitor's spinlockState, once the caller has swapped
+ * SPINLOCK_EXCEEDED out of it, up to the same limit as unblock_spinlock_threads.
+ *
+ * Unlike the mutex path, this ignores monitor->spinThreads: a spinner that takes the
+ * spinlock sets it OWNED, so its release would not wake the sleepers.
+ *
+ * Does not need the monitor's mutex.
+ */
+static void
+unblock_spinlock_futex_threads(omrthread_t self, omrthread_monitor_t monitor)
+{
+#if defined(OMR_THR_SPIN_WAKE_CONTROL)
+	omrthread_spinlock_futex_wake(monitor, self->library->maxWakeThreads);
+#else /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
+	omrthread_spinlock_futex_wake(monitor, UDATA_MAX);
+#endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
+}
+#endif /* defined(OMR_THR_FUTEX_LOCKS) */
+
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS) */
 
 
@@ -4357,7 +4416,20 @@ monitor_exit(omrthread_t self, omrthread_monitor_t monitor)
 		}
 		MONITOR_UNLOCK(monitor);
 #else /* defined(OMR_THR_MCS_LOCKS) */
-#if defined(OMR_THR_SPIN_WAKE_CONTROL)
+#if defined(OMR_THR_FUTEX_LOCKS)
+		if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+			unblock_spinlock_futex_threads(self, monitor);
+			/*
+			 * Only abortable enters and notified waiters block on the mutex. They are queued
+			 * before they set SPINLOCK_EXCEEDED, so an empty queue needs no mutex.
+			 */
+			if (NULL != monitor->blocking) {
+				MONITOR_LOCK(monitor, CALLER_MONITOR_EXIT1);
+				unblock_spinlock_threads(self, monitor);
+				MONITOR_UNLOCK(monitor);
+			}
+		}
+#elif defined(OMR_THR_SPIN_WAKE_CONTROL)
 		omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
  		MONITOR_LOCK(monitor, CALLER_MONITOR_EXIT1);
  		if (0 == monitor->spinThreads) {
@@ -4625,7 +4697,12 @@ monitor_wait_original(omrthread_t self, omrthread_monitor_t monitor,
 		NOTIFY_WRAPPER(nextThread);
 	}
 #else /* defined(OMR_THR_MCS_LOCKS) */
-#if defined(OMR_THR_SPIN_WAKE_CONTROL)
+#if defined(OMR_THR_FUTEX_LOCKS)
+	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+		unblock_spinlock_futex_threads(self, monitor);
+		unblock_spinlock_threads(self, monitor);
+	}
+#elif defined(OMR_THR_SPIN_WAKE_CONTROL)
 	omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
 	if (0 == monitor->spinThreads) {
 		unblock_spinlock_threads(self, monitor);
@@ -4893,7 +4970,12 @@ monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor,
 		NOTIFY_WRAPPER(nextThread);
 	}
 #else /* defined(OMR_THR_MCS_LOCKS) */
-#if defined(OMR_THR_SPIN_WAKE_CONTROL)
+#if defined(OMR_THR_FUTEX_LOCKS)
+	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+		unblock_spinlock_futex_threads(self, monitor);
+		unblock_spinlock_threads(self, monitor);
+	}
+#elif defined(OMR_THR_SPIN_WAKE_CONTROL)
 	omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
 	if (0 == monitor->spinThreads) {
 		unblock_spinlock_threads(self, monitor);
@@ -29,8 +29,10 @@
 #include "omrcfg.h"
 #include "omrcomp.h"
 #include "omrthread.h"
+#include "omrutilbase.h"
 #include "threaddef.h"
 #include "thread_internal.h"
+#include "ut_j9thr.h"
 
 /*
  * This file should be compiled only if OMR_THR_JLM is #defined.
@@ -191,6 +193,12 @@ jlm_adaptive_spin_init(void)
 	if (0 != *(uintptr_t *)omrthread_global("adaptSpinSlowPercentEnable")) {
 		adaptiveFlags |= J9THREAD_LIB_FLAG_JLM_SLOW_SAMPLING_ENABLED;
 	}
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+	if (0 != *(uintptr_t *)omrthread_global("adaptSpinTuneEnable")) {
+		/* Tuning is driven by the sampled hold times. */
+		adaptiveFlags |= J9THREAD_LIB_FLAG_JLM_HOLDTIME_SAMPLING_ENABLED | J9THREAD_LIB_FLAG_ADAPTIVE_SPIN_TUNING_ENABLED;
+	}
+#endif /* OMR_THR_THREE_TIER_LOCKING */
 
 #if defined(OMR_THR_CUSTOM_SPIN_OPTIONS)
 	if (0 != *(uintptr_t *)omrthread_global("customAdaptSpinEnabled")) {
@@ -215,6 +223,68 @@ jlm_adaptive_spin_init(void)
 
 	return 0;
 }
+
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+/**
+ * Adjust a monitor's spin counts from one sampled hold time.
+ *
+ * Spinning only pays off if the owner releases the monitor before a contending
+ * thread gives up and blocks. Hold times above adaptSpinHoldtime, and holds during
+ * which the owner was paused, shrink the yield tier (spinCount3) and then the spin
+ * tier (spinCount2), halving them down to 1. Hold times below half of
+ * adaptSpinHoldtime grow them back, in the opposite order, up to the monitor's
+ * default counts. A short hold whose enter still blocked lets spinCount2 grow past
+ * its default, up to ADAPT_SPIN_TUNE_MAX_SCALE times it.
+ *
+ * Must be called by the owner of the monitor, before it is released.
+ *
+ * @param[in] self the current thread
+ * @param[in] monitor the monitor being exited
+ * @param[in] holdTime the sampled hold time, or U_64_MAX if the owner was paused while holding the monitor
+ * @return none
+ */
+void
+jlm_adaptive_spin_tune(omrthread_t self, omrthread_monitor_t monitor, uint64_t holdTime)
+{
+	omrthread_library_t lib = self->library;
+	uint64_t threshold = (uint64_t)lib->adaptSpinHoldtime;
+	uintptr_t defaultSpinCount2 = lib->defaultMonitorSpinCount2;
+	uintptr_t defaultSpinCount3 = lib->defaultMonitorSpinCount3;
+	uintptr_t spinCount2 = monitor->spinCount2;
+	uintptr_t spinCount3 = monitor->spinCount3;
+
+#if defined(OMR_THR_CUSTOM_SPIN_OPTIONS)
+	if (NULL != monitor->customSpinOptions) {
+		defaultSpinCount2 = monitor->customSpinOptions->customThreeTierSpinCount2;
+		defaultSpinCount3 = monitor->customSpinOptions->customThreeTierSpinCount3;
+	}
+#endif /* OMR_THR_CUSTOM_SPIN_OPTIONS */
+
+	if (holdTime > threshold) {
+		if (spinCount2 > defaultSpinCount2) {
+			spinCount2 = defaultSpinCount2;
+		} else if (spinCount3 > 1) {
+			spinCount3 /= 2;
+		} else if (spinCount2 > 1) {
+			spinCount2 /= 2;
+		}
+	} else if (holdTime <= (threshold / 2)) {
+		if (spinCount2 < defaultSpinCount2) {
+			spinCount2 = OMR_MIN(spinCount2 * 2, defaultSpinCount2);
+		} else if (spinCount3 < defaultSpinCount3) {
+			spinCount3 = OMR_MIN(spinCount3 * 2, defaultSpinCount3);
+		} else if (OMR_ARE_ALL_BITS_SET(monitor->flags, J9THREAD_MONITOR_SLOW_ENTER)) {
+			spinCount2 = OMR_MIN(spinCount2 * 2, defaultSpinCount2 * ADAPT_SPIN_TUNE_MAX_SCALE);
+		}
+	}
+
+	if ((spinCount2 != monitor->spinCount2) || (spinCount3 != monitor->spinCount3)) {
+		monitor->spinCount2 = spinCount2;
+		monitor->spinCount3 = spinCount3;
+		Trc_THR_Adapt_TuneSpinning((IS_OBJECT_MONITOR(monitor) ? "object" : "system"), monitor, holdTime, threshold, spinCount2, spinCount3);
+	}
+}
+#endif /* OMR_THR_THREE_TIER_LOCKING */
 #endif /* OMR_THR_ADAPTIVE_SPIN */
 
 
@@ -294,6 +364,82 @@ omrthread_jlm_get_gc_lock_tracing(void)
 }
 
 
+/**
+ * Install or remove the contention sampler.
+ *
+ * Every samplePeriod'th time a thread has to block to enter a three-tier monitor, it times
+ * the block and, once it owns the monitor, calls sampler with the monitor and the blocked time
+ * in GET_HIRES_CLOCK() units. The sampler runs on the blocked thread while it holds the monitor,
+ * so it should be short, should not allocate memory or block, and must not call this function;
+ * monitors it enters are not sampled.
+ * Full JLM does not need to be enabled.
+ *
+ * Returns once no thread is running the previous sampler, so the caller may free its userData.
+ *
+ * @param[in] sampler function to call for each sample, or NULL to stop sampling
+ * @param[in] userData passed to sampler
+ * @param[in] samplePeriod number of blocking enters per thread for each sample (0 is taken as 1)
+ * @return 0 on success
+ */
+intptr_t
+omrthread_jlm_set_contention_sampler(omrthread_contention_sampler_t sampler, void *userData, uintptr_t samplePeriod)
+{
+	omrthread_t self = MACRO_SELF();
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+
+	ASSERT(self);
+	ASSERT(lib);
+
+	GLOBAL_LOCK(self, CALLER_JLM_SET_CONTENTION_SAMPLER);
+
+	lib->contentionSamplePeriod = 0;
+	lib->contentionSampler = NULL;
+	issueReadWriteBarrier();
+	while (0 != lib->contentionSamplersActive) {
+		omrthread_yield();
+	}
+
+	if (NULL != sampler) {
+		lib->contentionSamplerUserData = userData;
+		issueReadWriteBarrier();
+		lib->contentionSampler = sampler;
+		lib->contentionSamplePeriod = (0 == samplePeriod) ? 1 : samplePeriod;
+	}
+
+	GLOBAL_UNLOCK(self);
+
+	return 0;
+}
+
+
+/**
+ * Pass a sampled contended enter to the contention sampler.
+ *
+ * @param[in] self the thread that now owns monitor
+ * @param[in] monitor the monitor that was entered
+ * @param[in] blockedTime time spent blocked, in GET_HIRES_CLOCK() units
+ */
+void
+jlm_contention_sample(omrthread_t self, omrthread_monitor_t monitor, uint64_t blockedTime)
+{
+	omrthread_library_t lib = self->library;
+	omrthread_contention_sampler_t sampler = NULL;
+
+	/* Count this thread as active before reading the sampler so that it cannot be removed under us. */
+	addAtomic(&lib->contentionSamplersActive, 1);
+	issueReadWriteBarrier();
+	sampler = lib->contentionSampler;
+	if (NULL != sampler) {
+		/* Monitors entered by the sampler itself are not sampled. */
+		uintptr_t countdown = self->contentionSampleCountdown;
+		self->contentionSampleCountdown = UDATA_MAX;
+		sampler(self, monitor, blockedTime, lib->contentionSamplerUserData);
+		self->contentionSampleCountdown = countdown;
+	}
+	subtractAtomic(&lib->contentionSamplersActive, 1);
+}
+
+
 /**
  * Initialize and clear a thread's JLM tracing information.
  *
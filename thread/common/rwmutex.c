@@ -22,16 +22,45 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include "omrutilbase.h"
 #include "threaddef.h"
 #include "thread_internal.h"
 
 #undef  ASSERT
 #define ASSERT(x) /**/
 
+/*
+ * Reader counters of a J9THREAD_RWMUTEX_READER_BIASED mutex. Each one is on its own
+ * cache line so that readers hashed to different stripes do not share a line.
+ */
+#define RWMUTEX_READER_STRIPE_SIZE 128
+#define RWMUTEX_READER_STRIPES_SHIFT 5
+#define RWMUTEX_READER_STRIPES ((uintptr_t)1 << RWMUTEX_READER_STRIPES_SHIFT)
+
+#if defined(OMR_ENV_DATA64)
+#define RWMUTEX_READER_STRIPE_HASH ((uintptr_t)0x9E3779B97F4A7C15)
+#else /* defined(OMR_ENV_DATA64) */
+#define RWMUTEX_READER_STRIPE_HASH ((uintptr_t)0x9E3779B9)
+#endif /* defined(OMR_ENV_DATA64) */
+
+/* Fibonacci hash of the thread, so that each thread always uses the same stripe */
+#define RWMUTEX_READER_STRIPE(m, thread) \
+	(&(m)->readers[((uintptr_t)(thread) * RWMUTEX_READER_STRIPE_HASH) >> ((sizeof(uintptr_t) * 8) - RWMUTEX_READER_STRIPES_SHIFT)])
+
+typedef struct RWMutexReaderStripe {
+	volatile uintptr_t count;
+	uint8_t padding[RWMUTEX_READER_STRIPE_SIZE - sizeof(uintptr_t)];
+} RWMutexReaderStripe;
+
 typedef struct RWMutex {
 	omrthread_monitor_t syncMon;
 	intptr_t status;
 	omrthread_t writer;
+	uintptr_t flags;
+	/* Only used by J9THREAD_RWMUTEX_READER_BIASED mutexes: non-zero while a writer drains or holds the mutex */
+	volatile uintptr_t writerPending;
+	RWMutexReaderStripe *readers;
+	void *readersMemory;
 } RWMutex;
 
 #define ASSERT_RWMUTEX(m)\
@@ -41,10 +70,116 @@ typedef struct RWMutex {
 #define RWMUTEX_STATUS_IDLE(m)     ((m)->status == 0)
 #define RWMUTEX_STATUS_READING(m)  ((m)->status > 0)
 #define RWMUTEX_STATUS_WRITING(m)  ((m)->status < 0)
+#define RWMUTEX_READER_BIASED(m)   (J9THREAD_RWMUTEX_READER_BIASED == ((m)->flags & J9THREAD_RWMUTEX_READER_BIASED))
+
+static uintptr_t reader_biased_count(RWMutex *mutex);
+static void reader_biased_enter_read(RWMutex *mutex, omrthread_t self);
+static void reader_biased_exit_read(RWMutex *mutex, volatile uintptr_t *count);
+static BOOLEAN reader_biased_drain(RWMutex *mutex, BOOLEAN block);
+
+/**
+ * Sum the reader counters of a reader-biased mutex.
+ *
+ * A thread may exit a read on another stripe than it entered on, so single counters
+ * may wrap, but their sum is the number of readers.
+ *
+ * @param[in] mutex a J9THREAD_RWMUTEX_READER_BIASED mutex
+ * @return the number of threads holding the mutex for read
+ */
+static uintptr_t
+reader_biased_count(RWMutex *mutex)
+{
+	uintptr_t count = 0;
+	uintptr_t i = 0;
+	for (i = 0; i < RWMUTEX_READER_STRIPES; i++) {
+		count += mutex->readers[i].count;
+	}
+	return count;
+}
+
+/**
+ * Enter a reader-biased mutex for read.
+ *
+ * Readers only touch their own stripe unless a writer is pending, in which case
+ * they back out and queue on the monitor. A pending writer that has not yet
+ * drained the readers still lets them in, as the default mutex does, so a thread
+ * may re-enter for read while a writer waits.
+ *
+ * @param[in] mutex a J9THREAD_RWMUTEX_READER_BIASED mutex
+ * @param[in] self the current thread
+ */
+static void
+reader_biased_enter_read(RWMutex *mutex, omrthread_t self)
+{
+	volatile uintptr_t *count = &RWMUTEX_READER_STRIPE(mutex, self)->count;
+
+	addAtomic(count, 1);
+	/* Pairs with the barrier in reader_biased_drain(): either this reader sees the writer, or the writer sees this reader. */
+	issueReadWriteBarrier();
+	if (0 != mutex->writerPending) {
+		reader_biased_exit_read(mutex, count);
+
+		omrthread_monitor_enter(mutex->syncMon);
+		while (RWMUTEX_STATUS_WRITING(mutex)) {
+			omrthread_monitor_wait(mutex->syncMon);
+		}
+		addAtomic(count, 1);
+		omrthread_monitor_exit(mutex->syncMon);
+	}
+}
+
+/**
+ * Exit a reader-biased mutex for read, waking a writer that is draining the readers
+ * if this was the last reader. Of concurrently exiting readers, the one that
+ * decrements last sees the other decrements, so a draining writer is always woken.
+ *
+ * @param[in] mutex a J9THREAD_RWMUTEX_READER_BIASED mutex
+ * @param[in] count the reader counter to decrement
+ */
+static void
+reader_biased_exit_read(RWMutex *mutex, volatile uintptr_t *count)
+{
+	subtractAtomic(count, 1);
+	issueReadWriteBarrier();
+	if ((0 != mutex->writerPending) && (0 == reader_biased_count(mutex))) {
+		omrthread_monitor_enter(mutex->syncMon);
+		omrthread_monitor_notify_all(mutex->syncMon);
+		omrthread_monitor_exit(mutex->syncMon);
+	}
+}
+
+/**
+ * Stop new readers from taking the fast path, then wait for the current readers to exit.
+ *
+ * Must be called with the syncMon entered, and no other writer pending.
+ *
+ * @param[in] mutex a J9THREAD_RWMUTEX_READER_BIASED mutex
+ * @param[in] block TRUE to wait for the readers, FALSE to back out if there are any
+ * @return TRUE if there are no readers left, FALSE if the writer backed out
+ */
+static BOOLEAN
+reader_biased_drain(RWMutex *mutex, BOOLEAN block)
+{
+	mutex->writerPending = 1;
+	issueReadWriteBarrier();
+	while (0 != reader_biased_count(mutex)) {
+		if (!block) {
+			mutex->writerPending = 0;
+			return FALSE;
+		}
+		omrthread_monitor_wait(mutex->syncMon);
+	}
+	return TRUE;
+}
 
 /**
  * Acquire and initialize a new read/write mutex from the threading library.
  *
+ * With J9THREAD_RWMUTEX_READER_BIASED in flags, readers count themselves on
+ * per-thread striped counters instead of entering the mutex's monitor, and a
+ * writer stops new readers and drains the counters. Reads do not contend with
+ * each other, at the cost of more expensive writes.
+ *
  * @param[out] handle pointer to a omrthread_rwmutex_t to be set to point to the new mutex
  * @param[in] flags initial flag values for the mutex
  * @return J9THREAD_RWMUTEX_OK on success
@@ -69,6 +204,27 @@ omrthread_rwmutex_init(omrthread_rwmutex_t *handle, uintptr_t flags, const char
 	if (NULL == mutex) {
 		ret = J9THREAD_RWMUTEX_FAIL;
 	} else {
+		mutex->flags = flags;
+		mutex->writerPending = 0;
+		mutex->readers = NULL;
+		mutex->readersMemory = NULL;
+		if (RWMUTEX_READER_BIASED(mutex)) {
+			uintptr_t size = sizeof(RWMutexReaderStripe) * RWMUTEX_READER_STRIPES;
+			mutex->readersMemory = omrthread_allocate_memory(lib, size + RWMUTEX_READER_STRIPE_SIZE, OMRMEM_CATEGORY_THREADS);
+			if (NULL == mutex->readersMemory) {
+#if defined(OMR_THR_FORK_SUPPORT)
+				GLOBAL_LOCK_SIMPLE(lib);
+				pool_removeElement(lib->rwmutexPool, mutex);
+				GLOBAL_UNLOCK_SIMPLE(lib);
+#else /* defined(OMR_THR_FORK_SUPPORT) */
+				omrthread_free_memory(lib, mutex);
+#endif /* defined(OMR_THR_FORK_SUPPORT) */
+				return J9THREAD_RWMUTEX_FAIL;
+			}
+			mutex->readers = (RWMutexReaderStripe *)(((uintptr_t)mutex->readersMemory + RWMUTEX_READER_STRIPE_SIZE - 1) & ~(uintptr_t)(RWMUTEX_READER_STRIPE_SIZE - 1));
+			memset(mutex->readers, 0, size);
+		}
+
 		omrthread_monitor_init_with_name(&mutex->syncMon, 0, (char *)name);
 		mutex->status = 0;
 		mutex->writer = 0;
@@ -103,6 +259,9 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 	ASSERT(0 == mutex->status);
 	ASSERT(0 == mutex->writer);
 	omrthread_monitor_destroy(mutex->syncMon);
+	if (NULL != mutex->readersMemory) {
+		omrthread_free_memory(lib, mutex->readersMemory);
+	}
 #if defined(OMR_THR_FORK_SUPPORT)
 	ASSERT(0 != lib->rwmutexPool);
 	GLOBAL_LOCK_SIMPLE(lib);
@@ -142,8 +301,14 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
+		return J9THREAD_RWMUTEX_OK;
+	}
+
+	if (RWMUTEX_READER_BIASED(mutex)) {
+		reader_biased_enter_read(mutex, self);
 		return J9THREAD_RWMUTEX_OK;
 	}
 
@@ -170,8 +335,14 @@ omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_exit_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
+		return J9THREAD_RWMUTEX_OK;
+	}
+
+	if (RWMUTEX_READER_BIASED(mutex)) {
+		reader_biased_exit_read(mutex, &RWMUTEX_READER_STRIPE(mutex, self)->count);
 		return J9THREAD_RWMUTEX_OK;
 	}
 
@@ -226,6 +397,13 @@ omrthread_rwmutex_enter_write(omrthread_rwmutex_t mutex)
 
 	omrthread_monitor_enter(mutex->syncMon);
 
+	if (RWMUTEX_READER_BIASED(mutex)) {
+		while (0 != mutex->writerPending) {
+			omrthread_monitor_wait(mutex->syncMon);
+		}
+		reader_biased_drain(mutex, TRUE);
+	}
+
 	while (mutex->status != 0) {
 		omrthread_monitor_wait(mutex->syncMon);
 	}
@@ -263,7 +441,9 @@ omrthread_rwmutex_try_enter_write(omrthread_rwmutex_t mutex)
 	}
 
 	omrthread_monitor_enter(mutex->syncMon);
-	if (mutex->status != 0) {
+	if ((mutex->status != 0)
+		|| (RWMUTEX_READER_BIASED(mutex) && ((0 != mutex->writerPending) || !reader_biased_drain(mutex, FALSE)))
+	) {
 		/* must get out */
 		omrthread_monitor_exit(mutex->syncMon);
 		return J9THREAD_RWMUTEX_WOULDBLOCK;
@@ -299,6 +479,7 @@ omrthread_rwmutex_exit_write(omrthread_rwmutex_t mutex)
 	mutex->status++;
 	if (0 == mutex->status) {
 		mutex->writer = NULL;
+		mutex->writerPending = 0;
 		omrthread_monitor_notify_all(mutex->syncMon);
 	}
 
@@ -330,7 +511,7 @@ omrthread_rwmutex_is_writelocked(omrthread_rwmutex_t mutex)
 void
 omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 {
-	if (RWMUTEX_STATUS_READING(rwmutex)) {
+	if (RWMUTEX_STATUS_READING(rwmutex) || (RWMUTEX_READER_BIASED(rwmutex) && (0 != reader_biased_count(rwmutex)))) {
 		fprintf(stderr, "ERROR: found read-locked rwmutex during post-fork reset!\n");
 		abort();
 	}
@@ -341,6 +522,7 @@ omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 		 */
 		rwmutex->writer = NULL;
 		rwmutex->status = 0;
+		rwmutex->writerPending = 0;
 	}
 }
 
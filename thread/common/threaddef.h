@@ -98,6 +98,11 @@ intptr_t omrthread_spinlock_acquire(omrthread_t self, omrthread_monitor_t monito
 intptr_t omrthread_spinlock_acquire_no_spin(omrthread_t self, omrthread_monitor_t monitor);
 uintptr_t omrthread_spinlock_swapState(omrthread_monitor_t monitor, uintptr_t newState);
 
+#if defined(OMR_THR_FUTEX_LOCKS)
+void omrthread_spinlock_futex_block(omrthread_monitor_t monitor);
+void omrthread_spinlock_futex_wake(omrthread_monitor_t monitor, uintptr_t maxThreads);
+#endif /* defined(OMR_THR_FUTEX_LOCKS) */
+
 #if defined(OMR_THR_MCS_LOCKS)
 intptr_t
 omrthread_mcs_lock(omrthread_t self, omrthread_monitor_t monitor, omrthread_mcs_node_t mcsNode, BOOLEAN retry);
@@ -162,6 +167,7 @@ enum {
 	CALLER_STORE_EXIT_CPU_USAGE,
 	CALLER_GET_JVM_CPU_USAGE_INFO,
 	CALLER_SET_FLAG_ENABLE_CPU_MONITOR,
+	CALLER_JLM_SET_CONTENTION_SAMPLER,
 	CALLER_LAST_INDEX
 };
 #define MAX_CALLER_INDEX CALLER_LAST_INDEX
@@ -185,6 +191,11 @@ enum {
  */
 #define CUSTOM_ADAPTIVE_SPIN_TRUE  (1)
 
+/*
+ * Limit on how far adaptive spin tuning may grow spinCount2 past its default
+ */
+#define ADAPT_SPIN_TUNE_MAX_SCALE  (4)
+
 #define MACRO_SELF() ((omrthread_t)TLS_GET(((omrthread_library_t)GLOBAL_DATA(default_library))->self_ptr))
 
 #if defined(THREAD_ASSERTS)
@@ -301,6 +312,8 @@ enum {
 
 #define IS_ADAPT_SLOW_PERCENT_ENABLED(thread, monitor) (IS_ADAPT_SLOW_ENABLED((thread), (monitor)) && (0 != (thread)->library->adaptSpinSlowPercent))
 
+#define IS_ADAPT_SPIN_TUNING_ENABLED(thread) OMR_ARE_ALL_BITS_SET((thread)->library->flags, J9THREAD_LIB_FLAG_ADAPTIVE_SPIN_TUNING_ENABLED)
+
 #define JLM_NON_RECURSIVE_ENTER_COUNT(monitor) ((monitor)->tracing->enter_count - (monitor)->tracing->recursive_count)
 #define JLM_AVERAGE_HOLDTIME(monitor) ((monitor)->tracing->holdtime_avg)
 #define JLM_SLOW_PERCENT(monitor) (((monitor)->tracing->slow_count*100)/JLM_NON_RECURSIVE_ENTER_COUNT(monitor))
@@ -382,13 +395,26 @@ enum {
 		} \
 	} while(0)
 
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+#define ADAPT_TUNE_SPIN(thread, monitor, holdTime) \
+	do { \
+		if (IS_ADAPTIVE_SPIN_REQUIRED(monitor)) { \
+			jlm_adaptive_spin_tune((thread), (monitor), (holdTime)); \
+		} \
+	} while (0)
+#else /* OMR_THR_THREE_TIER_LOCKING */
+#define ADAPT_TUNE_SPIN(thread, monitor, holdTime)
+#endif /* OMR_THR_THREE_TIER_LOCKING */
+
 #define ADAPT_SAMPLE_STOP_MIN_COUNT(thread, monitor) ((thread)->library->adaptSpinSampleStopCount)
 
 #define ADAPT_SAMPLE_STOP_MAX_HOLDTIME(thread, monitor) \
 	(JLM_NON_RECURSIVE_ENTER_COUNT(monitor) * (thread)->library->adaptSpinSampleCountStopRatio)
 
+/* Spin tuning adjusts the spin counts for as long as the monitor is used, so it never stops sampling. */
 #define SHOULD_DISABLE_ADAPT_SAMPLING(thread, monitor) \
-	(IS_ADAPT_HOLDTIME_ENABLED((thread), (monitor)) && \
+	(!IS_ADAPT_SPIN_TUNING_ENABLED(thread) && \
+	 IS_ADAPT_HOLDTIME_ENABLED((thread), (monitor)) && \
 	 ((monitor)->tracing->holdtime_count > 0) && \
 	 (JLM_NON_RECURSIVE_ENTER_COUNT(monitor) >= ADAPT_SAMPLE_STOP_MIN_COUNT((thread), (monitor))) && \
 	 (JLM_AVERAGE_HOLDTIME(monitor) < ADAPT_SAMPLE_STOP_MAX_HOLDTIME((thread), (monitor))))
@@ -421,6 +447,8 @@ enum {
 #else /* OMR_THR_ADAPTIVE_SPIN */
 #define DO_ADAPT_CHECK(thread, monitor)
 #define ADAPT_DISABLE_SPIN_CHECK(thread, monitor)
+#define IS_ADAPT_SPIN_TUNING_ENABLED(thread) (0)
+#define ADAPT_TUNE_SPIN(thread, monitor, holdTime)
 #define TAKE_JLM_SAMPLE(thread, monitor) IS_JLM_ENABLED(thread)
 #endif /* OMR_THR_ADAPTIVE_SPIN */
 
@@ -488,6 +516,36 @@ enum {
 #define IS_SLOW_ENTER  (1)
 #define IS_RECURSIVE_ENTER  (1)
 
+#if defined(OMR_THR_JLM)
+/*
+ * Contention sampling: every contentionSamplePeriod'th enter of a thread that has to block
+ * is timed from its first block until it owns the monitor, and reported to the sampler
+ * registered by omrthread_jlm_set_contention_sampler().
+ */
+#define CONTENTION_SAMPLE_BLOCK(self, blockedCount, blockStart) \
+	do { \
+		uintptr_t samplePeriod = (self)->library->contentionSamplePeriod; \
+		if ((0 != samplePeriod) && (0 == (blockedCount))) { \
+			if (0 == (self)->contentionSampleCountdown) { \
+				(self)->contentionSampleCountdown = samplePeriod - 1; \
+				(blockStart) = GET_HIRES_CLOCK(); \
+			} else { \
+				(self)->contentionSampleCountdown -= 1; \
+			} \
+		} \
+	} while (0)
+
+#define CONTENTION_SAMPLE_ENTER(self, monitor, blockStart) \
+	do { \
+		if (0 != (blockStart)) { \
+			jlm_contention_sample((self), (monitor), GET_HIRES_CLOCK() - (blockStart)); \
+		} \
+	} while (0)
+#else /* OMR_THR_JLM */
+#define CONTENTION_SAMPLE_BLOCK(self, blockedCount, blockStart)
+#define CONTENTION_SAMPLE_ENTER(self, monitor, blockStart)
+#endif /* OMR_THR_JLM */
+
 #if defined(OMR_THR_JLM_HOLD_TIMES)
 #define UPDATE_JLM_MON_ENTER_HOLD_TIMES(self, monitor) \
 	do { \
@@ -568,9 +626,16 @@ enum {
 							(monitor)->tracing->holdtime_count = holdTimeCount; \
 							(monitor)->tracing->holdtime_sum += (omrtime_t)holdTime; \
 							(monitor)->tracing->holdtime_avg = (monitor)->tracing->holdtime_sum / ((uint64_t)holdTimeCount); \
-							ADAPT_DISABLE_SPIN_CHECK((self), (monitor)); \
+							if (IS_ADAPT_SPIN_TUNING_ENABLED(self)) { \
+								ADAPT_TUNE_SPIN((self), (monitor), (uint64_t)holdTime); \
+							} else { \
+								ADAPT_DISABLE_SPIN_CHECK((self), (monitor)); \
+							} \
 						} \
 					} \
+				} else if (IS_ADAPT_SPIN_TUNING_ENABLED(self)) { \
+					/* The owner was paused while holding the monitor, so spinning for it was wasted. */ \
+					ADAPT_TUNE_SPIN((self), (monitor), U_64_MAX); \
 				} \
 			} \
 			(monitor)->tracing->enter_time = 0; \
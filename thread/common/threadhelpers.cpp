@@ -22,6 +22,12 @@
 
 #include "AtomicSupport.hpp"
 
+#if defined(OMR_THR_FUTEX_LOCKS)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* defined(OMR_THR_FUTEX_LOCKS) */
+
 extern "C" {
 
 #include "thrtypes.h"
@@ -196,6 +202,60 @@ omrthread_spinlock_swapState(omrthread_monitor_t monitor, uintptr_t newState)
 	return oldState;
 }
 
+#if defined(OMR_THR_FUTEX_LOCKS)
+/**
+ * The futex word is the low order 32 bits of spinlockState, which hold all of its states.
+ */
+static VMINLINE int32_t *
+spinlockFutexWord(omrthread_monitor_t monitor)
+{
+	int32_t *word = (int32_t *)&monitor->spinlockState;
+#if defined(OMR_ENV_DATA64) && !defined(OMR_ENV_LITTLE_ENDIAN)
+	word += 1;
+#endif /* defined(OMR_ENV_DATA64) && !defined(OMR_ENV_LITTLE_ENDIAN) */
+	return word;
+}
+
+/**
+ * Sleep on a monitor's spinlockState until the spinlock is acquired. The caller must have found the
+ * spinlock owned when it swapped in SPINLOCK_EXCEEDED. The spinlock is acquired by swapping in
+ * SPINLOCK_EXCEEDED again (rather than SPINLOCK_OWNED) so that the remaining sleepers are still woken.
+ *
+ * The thread is counted in monitor->futexWaiters while it sleeps. The count is incremented before the
+ * futex is checked, so a release that reads it as 0 cannot leave this thread asleep: the futex no longer
+ * reads SPINLOCK_EXCEEDED and the wait returns at once.
+ *
+ * @param[in] monitor the monitor whose spinlock is contended
+ */
+void
+omrthread_spinlock_futex_block(omrthread_monitor_t monitor)
+{
+	VM_AtomicSupport::add(&monitor->futexWaiters, 1);
+	do {
+		syscall(SYS_futex, spinlockFutexWord(monitor), FUTEX_WAIT_PRIVATE, J9THREAD_MONITOR_SPINLOCK_EXCEEDED, NULL, NULL, 0);
+	} while (J9THREAD_MONITOR_SPINLOCK_UNOWNED != omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED));
+	VM_AtomicSupport::subtract(&monitor->futexWaiters, 1);
+}
+
+/**
+ * Wake threads sleeping in omrthread_spinlock_futex_block. Called after swapping
+ * SPINLOCK_EXCEEDED out of spinlockState. No system call is made if none are sleeping.
+ *
+ * @param[in] monitor the monitor whose spinlock was released
+ * @param[in] maxThreads maximum number of threads to wake
+ */
+void
+omrthread_spinlock_futex_wake(omrthread_monitor_t monitor, uintptr_t maxThreads)
+{
+	/* order the read of futexWaiters after the release of the spinlock */
+	VM_AtomicSupport::readWriteBarrier();
+	if (0 != monitor->futexWaiters) {
+		int count = (int)OMR_MIN(maxThreads, (uintptr_t)INT32_MAX);
+		syscall(SYS_futex, spinlockFutexWord(monitor), FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+	}
+}
+#endif /* defined(OMR_THR_FUTEX_LOCKS) */
+
 #if defined(OMR_THR_MCS_LOCKS)
 /**
  * Acquire the MCS lock.
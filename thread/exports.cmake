@@ -177,6 +177,7 @@ if(OMR_THR_JLM)
 	omr_add_exports(j9thr_obj
 		omrthread_jlm_init
 		omrthread_jlm_get_gc_lock_tracing
+		omrthread_jlm_set_contention_sampler
 	)
 endif()
 
@@ -110,6 +110,7 @@ ifeq (1,$(OMR_THR_JLM))
 define WRITE_JLM_THREAD_EXPORTS
 @echo omrthread_jlm_init >>$@
 @echo omrthread_jlm_get_gc_lock_tracing >>$@
+@echo omrthread_jlm_set_contention_sampler >>$@
 endef
 endif
 
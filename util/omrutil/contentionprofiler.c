@@ -0,0 +1,341 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Sampling monitor contention profiler. Registered as the thread library's contention sampler,
+ * it records the blocked time, monitor name and native call stack of sampled blocking monitor
+ * enters into a fixed buffer, and dumps them aggregated in collapsed-stack format:
+ *
+ *   outermost frame;...;innermost frame;monitor name <blocked microseconds>
+ *
+ * which flame graph tools read directly.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "omrcfg.h"
+#if defined(OMR_OS_WINDOWS)
+#include <windows.h>
+#elif defined(LINUX) || defined(OSX) /* defined(OMR_OS_WINDOWS) */
+#include <execinfo.h>
+#endif /* defined(OMR_OS_WINDOWS) */
+
+#include "contentionprofiler.h"
+#include "omrutilbase.h"
+
+#if defined(OMR_THR_JLM)
+
+#define CONTENTION_PROFILER_MAX_FRAME_NAME 128
+#define CONTENTION_PROFILER_MAX_LINE \
+	((OMR_CONTENTION_PROFILER_MAX_FRAMES * CONTENTION_PROFILER_MAX_FRAME_NAME) + OMR_CONTENTION_PROFILER_MAX_NAME + 1)
+
+typedef struct OMRContentionStack {
+	char *stack;
+	uint64_t blockedTime;
+} OMRContentionStack;
+
+static void contentionProfilerSample(omrthread_t self, omrthread_monitor_t monitor, uint64_t blockedTime, void *userData);
+static uintptr_t appendName(char *cursor, char *end, const char *name, uintptr_t length);
+static uintptr_t appendFrameName(OMRPortLibrary *portLibrary, char *cursor, char *end, J9PlatformStackFrame *frame);
+static char *collapseSample(OMRContentionProfiler *profiler, OMRContentionSample *sample, char *buffer);
+static int compareStacks(const void *left, const void *right);
+
+OMRContentionProfiler *
+contentionProfilerNew(OMRPortLibrary *portLibrary, uintptr_t maxSamples)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	OMRContentionProfiler *profiler = omrmem_allocate_memory(sizeof(OMRContentionProfiler), OMRMEM_CATEGORY_THREADS);
+	if (NULL == profiler) {
+		return NULL;
+	}
+	memset(profiler, 0, sizeof(OMRContentionProfiler));
+	profiler->portLib = portLibrary;
+	profiler->maxSamples = maxSamples;
+	profiler->samples = omrmem_allocate_memory(maxSamples * sizeof(OMRContentionSample), OMRMEM_CATEGORY_THREADS);
+	if (NULL == profiler->samples) {
+		omrmem_free_memory(profiler);
+		return NULL;
+	}
+	memset(profiler->samples, 0, maxSamples * sizeof(OMRContentionSample));
+	return profiler;
+}
+
+/**
+ * Free a profiler. It must not be the active contention sampler.
+ */
+void
+contentionProfilerFree(OMRContentionProfiler *profiler)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(profiler->portLib);
+	omrmem_free_memory(profiler->samples);
+	omrmem_free_memory(profiler);
+}
+
+/**
+ * Make the profiler the thread library's contention sampler, replacing any other.
+ *
+ * @param[in] profiler the profiler
+ * @param[in] samplePeriod record one in every samplePeriod blocking enters of each thread
+ * @return 0 on success
+ */
+intptr_t
+contentionProfilerStart(OMRContentionProfiler *profiler, uintptr_t samplePeriod)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(profiler->portLib);
+#if defined(LINUX) || defined(OSX)
+	void *address = NULL;
+	/* The first backtrace() loads the unwinder, which allocates; do it here rather than in the sampler. */
+	backtrace(&address, 1);
+#endif /* defined(LINUX) || defined(OSX) */
+	profiler->startTicks = getTimebase();
+	profiler->startNanos = omrtime_nano_time();
+	return omrthread_jlm_set_contention_sampler(contentionProfilerSample, profiler, samplePeriod);
+}
+
+/**
+ * Stop sampling. Samples already recorded are kept for contentionProfilerDump().
+ */
+void
+contentionProfilerStop(OMRContentionProfiler *profiler)
+{
+	omrthread_jlm_set_contention_sampler(NULL, NULL, 0);
+}
+
+/**
+ * @return the number of samples recorded; samples beyond maxSamples are dropped
+ */
+uintptr_t
+contentionProfilerGetSampleCount(OMRContentionProfiler *profiler)
+{
+	return OMR_MIN(profiler->sampleCount, profiler->maxSamples);
+}
+
+/**
+ * Record a sampled enter. This runs while the sampled thread owns the monitor, so the stack is
+ * walked without allocating memory or taking locks. Platforms without such an unwinder record
+ * no frames.
+ */
+static void
+contentionProfilerSample(omrthread_t self, omrthread_monitor_t monitor, uint64_t blockedTime, void *userData)
+{
+	OMRContentionProfiler *profiler = (OMRContentionProfiler *)userData;
+	uintptr_t index = addAtomic(&profiler->sampleCount, 1) - 1;
+
+	if (index < profiler->maxSamples) {
+		OMRContentionSample *sample = &profiler->samples[index];
+		const char *name = omrthread_monitor_get_name(monitor);
+		uintptr_t frameCount = 0;
+		uintptr_t i = 0;
+#if defined(OMR_OS_WINDOWS)
+		PVOID addresses[OMR_CONTENTION_PROFILER_MAX_FRAMES];
+
+		/* skip this function's frame */
+		frameCount = RtlCaptureStackBackTrace(1, OMR_CONTENTION_PROFILER_MAX_FRAMES, addresses, NULL);
+		for (i = 0; i < frameCount; i++) {
+			sample->frames[i] = (uintptr_t)addresses[i];
+		}
+#elif defined(LINUX) || defined(OSX) /* defined(OMR_OS_WINDOWS) */
+		void *addresses[OMR_CONTENTION_PROFILER_MAX_FRAMES + 1];
+		int count = backtrace(addresses, OMR_CONTENTION_PROFILER_MAX_FRAMES + 1);
+
+		/* skip this function's frame */
+		for (i = 1; i < (uintptr_t)OMR_MAX(count, 0); i++) {
+			sample->frames[frameCount] = (uintptr_t)addresses[i];
+			frameCount += 1;
+		}
+#endif /* defined(OMR_OS_WINDOWS) */
+		sample->frameCount = frameCount;
+		sample->blockedTime = blockedTime;
+		strncpy(sample->monitorName, (NULL != name) ? name : "<unnamed>", OMR_CONTENTION_PROFILER_MAX_NAME - 1);
+		sample->monitorName[OMR_CONTENTION_PROFILER_MAX_NAME - 1] = '\0';
+		issueWriteBarrier();
+		sample->complete = 1;
+	}
+}
+
+/**
+ * Append up to length characters of name, replacing the characters that delimit collapsed stacks.
+ * @return the number of characters appended
+ */
+static uintptr_t
+appendName(char *cursor, char *end, const char *name, uintptr_t length)
+{
+	uintptr_t appended = 0;
+	while ((appended < length) && ('\0' != name[appended]) && ((cursor + appended) < end)) {
+		char c = name[appended];
+		cursor[appended] = ((';' == c) || ('\n' == c)) ? ':' : c;
+		appended += 1;
+	}
+	return appended;
+}
+
+/**
+ * Append a frame's function name, taken from its symbol "function+0x1a (0x... [module+0x...])".
+ * Frames without a function name are shown as module+offset or, failing that, as their address.
+ * @return the number of characters appended
+ */
+static uintptr_t
+appendFrameName(OMRPortLibrary *portLibrary, char *cursor, char *end, J9PlatformStackFrame *frame)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	const char *symbol = frame->symbol;
+	uintptr_t limit = OMR_MIN(CONTENTION_PROFILER_MAX_FRAME_NAME - 1, (uintptr_t)(end - cursor));
+
+	if ((NULL != symbol) && (' ' != symbol[0]) && ('\0' != symbol[0])) {
+		return appendName(cursor, cursor + limit, symbol, strcspn(symbol, "+ "));
+	}
+	if (NULL != symbol) {
+		const char *module = strchr(symbol, '[');
+		if (NULL != module) {
+			module += 1;
+			return appendName(cursor, cursor + limit, module, strcspn(module, "]"));
+		}
+	}
+	return omrstr_printf(cursor, limit + 1, "0x%p", (void *)frame->instruction_pointer);
+}
+
+/**
+ * Build the collapsed stack of a sample, outermost frame first and the monitor name last.
+ * @return a copy of the stack allocated from the port library, or NULL
+ */
+static char *
+collapseSample(OMRContentionProfiler *profiler, OMRContentionSample *sample, char *buffer)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(profiler->portLib);
+	J9PlatformStackFrame frames[OMR_CONTENTION_PROFILER_MAX_FRAMES];
+	J9PlatformThread threadInfo;
+	char *cursor = buffer;
+	char *end = buffer + CONTENTION_PROFILER_MAX_LINE - 1;
+	char *stack = NULL;
+	uintptr_t i = 0;
+
+	memset(frames, 0, sizeof(frames));
+	memset(&threadInfo, 0, sizeof(threadInfo));
+	for (i = 0; i < sample->frameCount; i++) {
+		frames[i].instruction_pointer = sample->frames[i];
+		frames[i].parent_frame = ((i + 1) < sample->frameCount) ? &frames[i + 1] : NULL;
+	}
+	threadInfo.callstack = (0 != sample->frameCount) ? frames : NULL;
+	omrintrospect_backtrace_symbols(&threadInfo, NULL);
+
+	for (i = sample->frameCount; i > 0; i--) {
+		cursor += appendFrameName(OMRPORTLIB, cursor, end, &frames[i - 1]);
+		if (cursor < end) {
+			*cursor++ = ';';
+		}
+		if (NULL != frames[i - 1].symbol) {
+			omrmem_free_memory(frames[i - 1].symbol);
+		}
+	}
+	cursor += appendName(cursor, end, sample->monitorName, OMR_CONTENTION_PROFILER_MAX_NAME);
+	*cursor = '\0';
+
+	stack = omrmem_allocate_memory((cursor - buffer) + 1, OMRMEM_CATEGORY_THREADS);
+	if (NULL != stack) {
+		memcpy(stack, buffer, (cursor - buffer) + 1);
+	}
+	return stack;
+}
+
+static int
+compareStacks(const void *left, const void *right)
+{
+	return strcmp(((const OMRContentionStack *)left)->stack, ((const OMRContentionStack *)right)->stack);
+}
+
+/**
+ * Write the recorded samples to fd in collapsed-stack format, one line per distinct stack and
+ * monitor, weighted by the total time blocked in microseconds.
+ *
+ * @param[in] profiler the profiler; it may still be sampling
+ * @param[in] fd file descriptor from omrfile_open
+ * @return 0 on success, -1 if memory could not be allocated
+ */
+intptr_t
+contentionProfilerDump(OMRContentionProfiler *profiler, intptr_t fd)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(profiler->portLib);
+	uintptr_t sampleCount = contentionProfilerGetSampleCount(profiler);
+	uint64_t elapsedTicks = getTimebase() - profiler->startTicks;
+	uint64_t elapsedMicros = (omrtime_nano_time() - profiler->startNanos) / 1000;
+	OMRContentionStack *stacks = NULL;
+	char *buffer = NULL;
+	uintptr_t stackCount = 0;
+	uintptr_t i = 0;
+	intptr_t rc = 0;
+
+	if (0 == sampleCount) {
+		return 0;
+	}
+	stacks = omrmem_allocate_memory(sampleCount * sizeof(OMRContentionStack), OMRMEM_CATEGORY_THREADS);
+	buffer = omrmem_allocate_memory(CONTENTION_PROFILER_MAX_LINE, OMRMEM_CATEGORY_THREADS);
+	if ((NULL == stacks) || (NULL == buffer)) {
+		rc = -1;
+		goto done;
+	}
+
+	for (i = 0; i < sampleCount; i++) {
+		OMRContentionSample *sample = &profiler->samples[i];
+		if (0 != sample->complete) {
+			issueReadBarrier();
+			stacks[stackCount].stack = collapseSample(profiler, sample, buffer);
+			if (NULL == stacks[stackCount].stack) {
+				rc = -1;
+				goto done;
+			}
+			stacks[stackCount].blockedTime = sample->blockedTime;
+			stackCount += 1;
+		}
+	}
+
+	qsort(stacks, stackCount, sizeof(OMRContentionStack), compareStacks);
+	for (i = 0; i < stackCount;) {
+		uint64_t blockedTime = 0;
+		uintptr_t next = i;
+		while ((next < stackCount) && (0 == strcmp(stacks[i].stack, stacks[next].stack))) {
+			blockedTime += stacks[next].blockedTime;
+			next += 1;
+		}
+		/* Timebase ticks are converted using the rate measured since the profiler was started. */
+		if ((0 != elapsedMicros) && (0 != elapsedTicks)) {
+			blockedTime = (uint64_t)((double)blockedTime * (double)elapsedMicros / (double)elapsedTicks);
+		}
+		omrfile_printf(fd, "%s %llu\n", stacks[i].stack, (unsigned long long)OMR_MAX(blockedTime, 1));
+		i = next;
+	}
+
+done:
+	if (NULL != stacks) {
+		for (i = 0; i < stackCount; i++) {
+			if (NULL != stacks[i].stack) {
+				omrmem_free_memory(stacks[i].stack);
+			}
+		}
+		omrmem_free_memory(stacks);
+	}
+	if (NULL != buffer) {
+		omrmem_free_memory(buffer);
+	}
+	return rc;
+}
+
+#endif /* defined(OMR_THR_JLM) */
@@ -38,18 +38,12 @@
 #define LINK_TO_FREE_LIST(prev, toAdd) SRP_PTR_SET((uintptr_t *)prev, toAdd)
 #define LINK_TO_NULL(prev) SRP_PTR_SET_TO_NULL(prev)
 
-#define PUDDLE_BITS(puddle) ((uint32_t *) ((J9PoolPuddle *) (puddle) + 1))
-#define POOL_PUDDLE_BITS_LEN(pool) (((pool)->elementsPerPuddle+31) / 32)
 #define PUDDLE_SLOT_FREE(puddle, sindex) (*(PUDDLE_BITS(puddle) + (((uint32_t)(sindex)) >> 5)) & (1 << (31 - (((uint32_t)(sindex)) & 31))))
 #define MARK_SLOT_FREE(puddle, sindex) do { *(PUDDLE_BITS(puddle) + (((uint32_t)(sindex)) >> 5)) |=  (1 << (31 - (((uint32_t)(sindex)) & 31))); } while (0)
 #define MARK_SLOT_USED(puddle, sindex) do { *(PUDDLE_BITS(puddle) + (((uint32_t)(sindex)) >> 5)) &= ~(1 << (31 - (((uint32_t)(sindex)) & 31))); } while (0)
 
 #define COMPUTE_FIRST_ELEMENT(align, puddle, bitlength) (ROUND_TO((align), ((uintptr_t) (puddle)) + sizeof(J9PoolPuddle) + ((bitlength)*sizeof(uint32_t))))
 
-/* HOLE_FREQUENCY defines how often a hole appears - there is a hole every HOLE_FREQUENCY elements. Must be power of two. */
-#define HOLE_FREQUENCY	16
-#define ELEMENT_IS_HOLE(pool, element) (((pool)->flags & POOL_USES_HOLES) && ((uintptr_t) (element) % ((pool)->elementSize*HOLE_FREQUENCY) == 0))
-
 /**
  * Get a pointer to the SRP to the puddle, given a puddle element.
  *
@@ -58,7 +52,7 @@
  *
  * @return A pointer to the SRP to the puddle containing the specified element.
  */
-static J9SRP *
+J9SRP *
 pool_getElementPuddleSRP(J9Pool *pool, void *element)
 {
 	J9SRP *puddleSRP;
@@ -83,7 +77,7 @@ pool_getElementPuddleSRP(J9Pool *pool, void *element)
  *
  * @return The element's index in the puddle, or -1 if the element is not in the puddle.
  */
-static int32_t
+int32_t
 pool_getElementPuddleSlot(J9Pool *pool, J9PoolPuddle *puddle, void *element)
 {
 	int32_t returnValue = -1;
@@ -305,6 +299,16 @@ pool_new(uintptr_t structSizeArg,
 		minNumberElements = numberElements;
 	}
 
+	if (poolFlags & POOL_CONCURRENT) {
+		/* Free elements are linked through a full pointer, and puddles are never freed
+		 * since another thread may be reading a free element's link.
+		 */
+		if (structSize < sizeof(uintptr_t)) {
+			structSize = sizeof(uintptr_t);
+		}
+		poolFlags |= POOL_NEVER_FREE_PUDDLES;
+	}
+
 	roundedStructSize = ROUND_TO(elementAlignment, structSize);
 
 	poolFlags &= ~POOL_USES_HOLES;
@@ -381,6 +385,7 @@ pool_new(uintptr_t structSizeArg,
 
 	if (NULL != pool) {
 		J9PoolPuddleList *puddleList;
+		uint32_t puddleListAllocSize = sizeof(J9PoolPuddleList);
 
 		pool->elementSize = (uintptr_t)roundedStructSize;
 		pool->alignment = (uint16_t)elementAlignment;	/* we assume no alignment is > 64k */
@@ -393,8 +398,12 @@ pool_new(uintptr_t structSizeArg,
 		pool->userData = userData;
 		pool->memoryCategory = memoryCategory;
 
+		if (poolFlags & POOL_CONCURRENT) {
+			puddleListAllocSize += POOL_CONCURRENT_STATE_ALLOC_SIZE;
+		}
+
 		doInit = 1;
-		puddleList = memAlloc(userData, sizeof(J9PoolPuddleList), poolCreatorCallsite, memoryCategory, POOL_ALLOC_TYPE_PUDDLE_LIST, &doInit);
+		puddleList = memAlloc(userData, puddleListAllocSize, poolCreatorCallsite, memoryCategory, POOL_ALLOC_TYPE_PUDDLE_LIST, &doInit);
 
 		if (NULL != puddleList) {
 			NNWSRP_SET(pool->puddleList, puddleList);
@@ -405,6 +414,9 @@ pool_new(uintptr_t structSizeArg,
 					puddleList->numElements = 0;
 					NNWSRP_SET(puddleList->nextPuddle, firstPuddle);
 					NNWSRP_SET(puddleList->nextAvailablePuddle, firstPuddle);
+					if (poolFlags & POOL_CONCURRENT) {
+						poolConcurrent_reset(pool);
+					}
 				} else {
 					memFree(userData, puddleList, POOL_ALLOC_TYPE_PUDDLE_LIST);
 					memFree(userData, pool, POOL_ALLOC_TYPE_POOL);
@@ -467,6 +479,9 @@ pool_kill(J9Pool *pool)
  *  grafted onto the end of the pool's puddle chain and the
  *  element returned will come from this puddle.
  *
+ *  Pools created with POOL_CONCURRENT may call this from any number
+ *  of threads at once, without external locking.
+ *
  * @param[in] pool
  *
  * @return NULL on error
@@ -490,6 +505,12 @@ pool_newElement(J9Pool *pool)
 		return NULL;
 	}
 
+	if (pool->flags & POOL_CONCURRENT) {
+		newElement = poolConcurrent_newElement(pool);
+		Trc_pool_newElement_Exit(newElement);
+		return newElement;
+	}
+
 	/* Check if there is a puddle with free slots - if so use it. */
 	puddleList = J9POOL_PUDDLELIST(pool);
 
@@ -559,6 +580,9 @@ pool_newElement(J9Pool *pool)
  * pool with @ref pool_startDo / @ref pool_nextDo on the element
  * returned by those calls.
  *
+ * Pools created with POOL_CONCURRENT may call this from any number
+ * of threads at once, without external locking.
+ *
  * @param[in] pool
  * @param[in] anElement Pointer to the element to be removed
  *
@@ -591,6 +615,14 @@ pool_removeElement(J9Pool *pool, void *anElement)
 		return;		/* this is an error...  we were passed a bogus data pointer. */
 	}
 
+	if (pool->flags & POOL_CONCURRENT) {
+		if (!poolConcurrent_removeElement(pool, puddle, slot, anElement)) {
+			Trc_pool_removeElement_NotFound(anElement, puddle);
+		}
+		Trc_pool_removeElement_Exit();
+		return;
+	}
+
 	if (PUDDLE_SLOT_FREE(puddle, slot)) {
 		Trc_pool_removeElement_NotFound(anElement, puddle);
 		Trc_pool_removeElement_Exit();
@@ -655,6 +687,9 @@ pool_do(J9Pool *pool, void (*doFunction)(void *anElement, void *userData), void
 /**
  *	Returns the number of elements in a given pool.
  *
+ *	For a POOL_CONCURRENT pool, the count is taken from the slot bits of every
+ *	puddle, and is only exact while no other thread is using the pool.
+ *
  * @param[in] pool
  *
  * @return 0 on error
@@ -670,7 +705,17 @@ pool_numElements(J9Pool *pool)
 	Trc_pool_numElements_Entry(pool);
 
 	puddleList = J9POOL_PUDDLELIST(pool);
-	numElements = puddleList->numElements;
+	if (pool->flags & POOL_CONCURRENT) {
+		J9PoolPuddle *walk = J9POOLPUDDLELIST_NEXTPUDDLE(puddleList);
+
+		numElements = 0;
+		while (NULL != walk) {
+			numElements += poolConcurrent_usedElements(pool, walk);
+			walk = J9POOLPUDDLE_NEXTPUDDLE(walk);
+		}
+	} else {
+		numElements = puddleList->numElements;
+	}
 
 	Trc_pool_numElements_Exit(numElements);
 
@@ -707,6 +752,11 @@ poolPuddle_startDo(J9Pool *pool, J9PoolPuddle *currentPuddle, pool_state *state,
 		return NULL;
 	}
 
+	if (pool->flags & POOL_CONCURRENT) {
+		/* Concurrent pools only keep the slot bits up to date. */
+		currentPuddle->usedElements = poolConcurrent_usedElements(pool, currentPuddle);
+	}
+
 	if (0 == currentPuddle->usedElements) {	/* this puddle is empty */
 		Trc_poolPuddle_startDo_EmptyExit();
 		if ((currentPuddle->nextPuddle != 0) && (followNextPointers != 0)) {
@@ -752,6 +802,9 @@ poolPuddle_startDo(J9Pool *pool, J9PoolPuddle *currentPuddle, pool_state *state,
  *
  *	Pass in a pointer to an empty pool_state and it will be filled in.
  *
+ *	A POOL_CONCURRENT pool may only be iterated while no other thread is
+ *	allocating or freeing its elements.
+ *
  * @param[in] pool  The pool to "do" things to
  * @param[in] state The pool_state to be used for this iteration.
  *
@@ -868,6 +921,9 @@ pool_clear(J9Pool *pool)
 		}
 
 		puddleList->numElements = 0;
+		if (pool->flags & POOL_CONCURRENT) {
+			poolConcurrent_reset(pool);
+		}
 	}
 
 	Trc_pool_clear_Exit();
@@ -89,12 +89,16 @@ pool_ensureCapacity(J9Pool *aPool, uintptr_t newCapacity)
 			/* Stick it at the end of the list. */
 			NNWSRP_SET(lastPuddle->nextPuddle, newPuddle);
 			NNWSRP_SET(newPuddle->prevPuddle, lastPuddle);
-			/* And also at the top of the available puddle list. */
-			puddle = WSRP_GET(puddleList->nextAvailablePuddle, J9PoolPuddle *);
-			if (puddle) {
-				NNWSRP_SET(newPuddle->nextAvailablePuddle, puddle);
+			if (aPool->flags & POOL_CONCURRENT) {
+				poolConcurrent_addPuddle(aPool, newPuddle);
+			} else {
+				/* And also at the top of the available puddle list. */
+				puddle = WSRP_GET(puddleList->nextAvailablePuddle, J9PoolPuddle *);
+				if (puddle) {
+					NNWSRP_SET(newPuddle->nextAvailablePuddle, puddle);
+				}
+				NNWSRP_SET(puddleList->nextAvailablePuddle, newPuddle);
 			}
-			NNWSRP_SET(puddleList->nextAvailablePuddle, newPuddle);
 
 			lastPuddle = newPuddle;
 			newSize -= aPool->elementsPerPuddle;
@@ -0,0 +1,370 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Pool
+ * @brief Allocation for POOL_CONCURRENT pools.
+ *
+ * Free elements are kept on a lock-free stack shared by all threads, and in per-thread
+ * caches which take and return them in batches. The shared stack is only ever pushed
+ * onto or taken whole, so it does not suffer from ABA. The slot bits of each puddle are
+ * updated atomically, which keeps iteration and pool_includesElement working once the
+ * pool is quiescent.
+ */
+
+#include <string.h>
+
+#include "AtomicSupport.hpp"
+#include "pool_internal.h"
+
+#define POOL_NEXT_FREE(element) (*(uintptr_t **) (element))
+#define SLOT_WORD(puddle, slot) (PUDDLE_BITS(puddle) + (((uint32_t) (slot)) >> 5))
+#define SLOT_MASK(slot) ((uint32_t) 1 << (31 - (((uint32_t) (slot)) & 31)))
+
+#if defined(OMR_OS_WINDOWS)
+#define POOL_THREAD_LOCAL __declspec(thread)
+#elif (defined(LINUX) && !defined(OMRZTPF)) || defined(OSX) || defined(AIXPPC)
+#define POOL_THREAD_LOCAL __thread
+#endif /* defined(OMR_OS_WINDOWS) */
+
+#if defined(POOL_THREAD_LOCAL)
+/* Threads are numbered on their first use of any concurrent pool, so the first POOL_THREAD_CACHES get a cache each. */
+static volatile uintptr_t poolThreadCount = 0;
+static POOL_THREAD_LOCAL uintptr_t poolThreadNumber = 0;
+#endif /* defined(POOL_THREAD_LOCAL) */
+
+/**
+ * @return A number identifying the calling thread, used to pick its cache.
+ */
+static uintptr_t
+poolConcurrent_threadNumber(void)
+{
+#if defined(POOL_THREAD_LOCAL)
+	uintptr_t number = poolThreadNumber;
+
+	if (0 == number) {
+		number = VM_AtomicSupport::add(&poolThreadCount, 1);
+		poolThreadNumber = number;
+	}
+
+	return number;
+#else /* defined(POOL_THREAD_LOCAL) */
+	/* Without thread local storage, tell threads apart by the stack they run on. */
+	uintptr_t marker = 0;
+
+	return ((uintptr_t) &marker) >> 16;
+#endif /* defined(POOL_THREAD_LOCAL) */
+}
+
+/**
+ * Claim the calling thread's cache.
+ *
+ * @return The cache, or NULL if another thread sharing the slot holds it.
+ */
+static J9PoolThreadCache *
+poolConcurrent_claimCache(J9PoolConcurrentState *state)
+{
+	J9PoolThreadCache *cache = &state->caches[poolConcurrent_threadNumber() % POOL_THREAD_CACHES];
+
+	if (0 == VM_AtomicSupport::lockCompareExchange(&cache->claimed, 0, 1)) {
+		VM_AtomicSupport::monitorEnterBarrier();
+	} else {
+		cache = NULL;
+	}
+
+	return cache;
+}
+
+static void
+poolConcurrent_releaseCache(J9PoolThreadCache *cache)
+{
+	VM_AtomicSupport::writeBarrier();
+	cache->claimed = 0;
+}
+
+/**
+ * Push a chain of free elements onto the shared free list.
+ */
+static void
+poolConcurrent_pushFree(J9PoolConcurrentState *state, uintptr_t *head, uintptr_t *tail)
+{
+	uintptr_t oldHead = state->freeList;
+
+	for (;;) {
+		uintptr_t found;
+
+		POOL_NEXT_FREE(tail) = (uintptr_t *) oldHead;
+		VM_AtomicSupport::writeBarrier();
+		found = VM_AtomicSupport::lockCompareExchange(&state->freeList, oldHead, (uintptr_t) head);
+		if (found == oldHead) {
+			break;
+		}
+		oldHead = found;
+	}
+}
+
+/**
+ * Put back the part of the shared free list that a thread took but does not need.
+ * Elements freed while the list was taken end up on top of it.
+ */
+static void
+poolConcurrent_returnFree(J9PoolConcurrentState *state, uintptr_t *rest)
+{
+	uintptr_t *pushed = (uintptr_t *) VM_AtomicSupport::lockExchange(&state->freeList, (uintptr_t) rest);
+
+	if (NULL != pushed) {
+		uintptr_t *tail = pushed;
+
+		VM_AtomicSupport::readBarrier();
+		while (NULL != POOL_NEXT_FREE(tail)) {
+			tail = POOL_NEXT_FREE(tail);
+		}
+		poolConcurrent_pushFree(state, pushed, tail);
+	}
+}
+
+/**
+ * Record the puddle in every element slot, and chain all of the puddle's (free) slots.
+ *
+ * @param[out] tail The last element of the chain.
+ *
+ * @return The first element of the chain.
+ */
+static uintptr_t *
+poolConcurrent_preparePuddle(J9Pool *pool, J9PoolPuddle *puddle, uintptr_t **tail)
+{
+	uintptr_t *head = NULL;
+	uintptr_t *last = NULL;
+	uintptr_t element = (uintptr_t) J9POOLPUDDLE_FIRSTELEMENTADDRESS(puddle);
+	uintptr_t slot = 0;
+
+	for (slot = 0; slot < pool->elementsPerPuddle; slot++) {
+		if (!ELEMENT_IS_HOLE(pool, element)) {
+			J9SRP *puddleSRP = pool_getElementPuddleSRP(pool, (void *) element);
+
+			NNSRP_SET(*puddleSRP, puddle);
+			if (NULL == last) {
+				head = (uintptr_t *) element;
+			} else {
+				POOL_NEXT_FREE(last) = (uintptr_t *) element;
+			}
+			last = (uintptr_t *) element;
+		}
+		element += pool->elementSize;
+	}
+	POOL_NEXT_FREE(last) = NULL;
+	/* The puddle free list is not used by concurrent pools. */
+	SRP_SET(puddle->firstFreeSlot, NULL);
+
+	*tail = last;
+	return head;
+}
+
+/**
+ * Link a new puddle at the head of the puddle list.
+ */
+static void
+poolConcurrent_linkPuddle(J9Pool *pool, J9PoolPuddle *puddle)
+{
+	J9PoolPuddleList *puddleList = J9POOL_PUDDLELIST(pool);
+	volatile uintptr_t *nextPuddle = (volatile uintptr_t *) &puddleList->nextPuddle;
+	uintptr_t oldValue = *nextPuddle;
+	J9PoolPuddle *head = NULL;
+
+	for (;;) {
+		uintptr_t found;
+
+		head = (J9PoolPuddle *) ((uintptr_t) nextPuddle + oldValue);
+		NNWSRP_SET(puddle->nextPuddle, head);
+		VM_AtomicSupport::writeBarrier();
+		found = VM_AtomicSupport::lockCompareExchange(nextPuddle, oldValue, (uintptr_t) puddle - (uintptr_t) nextPuddle);
+		if (found == oldValue) {
+			break;
+		}
+		oldValue = found;
+	}
+	/* Only the thread which put puddle in front of head writes this. */
+	NNWSRP_SET(head->prevPuddle, puddle);
+}
+
+/**
+ * Take up to maxCount free elements from the shared free list, growing the pool by
+ * a puddle if the list is empty.
+ *
+ * @param[out] tail The last element taken.
+ *
+ * @return The first element taken, or NULL if a new puddle could not be allocated.
+ */
+static uintptr_t *
+poolConcurrent_takeFree(J9Pool *pool, J9PoolConcurrentState *state, uintptr_t maxCount, uintptr_t **tail, uintptr_t *count)
+{
+	uintptr_t *head = (uintptr_t *) VM_AtomicSupport::lockExchange(&state->freeList, 0);
+	uintptr_t *last = NULL;
+	uintptr_t *rest = NULL;
+	uintptr_t taken = 1;
+
+	if (NULL == head) {
+		J9PoolPuddle *puddle = poolPuddle_new(pool);
+
+		if (NULL == puddle) {
+			return NULL;
+		}
+		head = poolConcurrent_preparePuddle(pool, puddle, &last);
+		poolConcurrent_linkPuddle(pool, puddle);
+	} else {
+		VM_AtomicSupport::readBarrier();
+	}
+
+	last = head;
+	while ((taken < maxCount) && (NULL != POOL_NEXT_FREE(last))) {
+		last = POOL_NEXT_FREE(last);
+		taken += 1;
+	}
+	rest = POOL_NEXT_FREE(last);
+	POOL_NEXT_FREE(last) = NULL;
+	if (NULL != rest) {
+		poolConcurrent_returnFree(state, rest);
+	}
+
+	*tail = last;
+	*count = taken;
+	return head;
+}
+
+void
+poolConcurrent_reset(J9Pool *pool)
+{
+	J9PoolPuddleList *puddleList = J9POOL_PUDDLELIST(pool);
+	J9PoolPuddle *walk = J9POOLPUDDLELIST_NEXTPUDDLE(puddleList);
+
+	memset(POOL_CONCURRENT_STATE(puddleList), 0, sizeof(J9PoolConcurrentState));
+	while (NULL != walk) {
+		poolConcurrent_addPuddle(pool, walk);
+		walk = J9POOLPUDDLE_NEXTPUDDLE(walk);
+	}
+}
+
+void
+poolConcurrent_addPuddle(J9Pool *pool, J9PoolPuddle *puddle)
+{
+	uintptr_t *tail = NULL;
+	uintptr_t *head = poolConcurrent_preparePuddle(pool, puddle, &tail);
+
+	poolConcurrent_pushFree(POOL_CONCURRENT_STATE(J9POOL_PUDDLELIST(pool)), head, tail);
+}
+
+void *
+poolConcurrent_newElement(J9Pool *pool)
+{
+	J9PoolConcurrentState *state = POOL_CONCURRENT_STATE(J9POOL_PUDDLELIST(pool));
+	J9PoolThreadCache *cache = poolConcurrent_claimCache(state);
+	uintptr_t *element = NULL;
+	uintptr_t *tail = NULL;
+	uintptr_t count = 0;
+
+	if (NULL != cache) {
+		if (0 == cache->freeCount) {
+			cache->freeList = poolConcurrent_takeFree(pool, state, POOL_THREAD_CACHE_BATCH, &cache->freeTail, &cache->freeCount);
+		}
+		element = cache->freeList;
+		if (NULL != element) {
+			cache->freeCount -= 1;
+			cache->freeList = POOL_NEXT_FREE(element);
+			if (0 == cache->freeCount) {
+				cache->freeTail = NULL;
+			}
+		}
+		poolConcurrent_releaseCache(cache);
+	} else {
+		element = poolConcurrent_takeFree(pool, state, 1, &tail, &count);
+	}
+
+	if (NULL != element) {
+		J9SRP *puddleSRP = pool_getElementPuddleSRP(pool, element);
+		J9PoolPuddle *puddle = NNSRP_GET(*puddleSRP, J9PoolPuddle *);
+		int32_t slot = pool_getElementPuddleSlot(pool, puddle, element);
+
+		VM_AtomicSupport::bitAndU32(SLOT_WORD(puddle, slot), ~SLOT_MASK(slot));
+		if (!(pool->flags & POOL_NO_ZERO)) {
+			memset(element, 0, pool->elementSize);
+			NNSRP_SET(*puddleSRP, puddle);
+		}
+	}
+
+	return element;
+}
+
+uintptr_t
+poolConcurrent_removeElement(J9Pool *pool, J9PoolPuddle *puddle, int32_t slot, void *anElement)
+{
+	J9PoolConcurrentState *state = POOL_CONCURRENT_STATE(J9POOL_PUDDLELIST(pool));
+	J9PoolThreadCache *cache = NULL;
+	uintptr_t *element = (uintptr_t *) anElement;
+	uint32_t mask = SLOT_MASK(slot);
+
+	if (0 != (VM_AtomicSupport::bitOrU32(SLOT_WORD(puddle, slot), mask) & mask)) {
+		/* the slot was already free */
+		return FALSE;
+	}
+
+	cache = poolConcurrent_claimCache(state);
+	if (NULL != cache) {
+		POOL_NEXT_FREE(element) = cache->freeList;
+		if (0 == cache->freeCount) {
+			cache->freeTail = element;
+		}
+		cache->freeList = element;
+		cache->freeCount += 1;
+		if (cache->freeCount > POOL_THREAD_CACHE_MAX) {
+			poolConcurrent_pushFree(state, cache->freeList, cache->freeTail);
+			cache->freeList = NULL;
+			cache->freeTail = NULL;
+			cache->freeCount = 0;
+		}
+		poolConcurrent_releaseCache(cache);
+	} else {
+		poolConcurrent_pushFree(state, element, element);
+	}
+
+	return TRUE;
+}
+
+uintptr_t
+poolConcurrent_usedElements(J9Pool *pool, J9PoolPuddle *puddle)
+{
+	uint32_t *bits = PUDDLE_BITS(puddle);
+	uintptr_t bitLength = POOL_PUDDLE_BITS_LEN(pool);
+	uintptr_t freeSlots = 0;
+	uintptr_t i = 0;
+
+	/* Set bits are free slots, holes and the unused bits of the last word. */
+	for (i = 0; i < bitLength; i++) {
+		uint32_t word = bits[i];
+
+		word = word - ((word >> 1) & 0x55555555);
+		word = (word & 0x33333333) + ((word >> 2) & 0x33333333);
+		freeSlots += (((word + (word >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+	}
+
+	return (bitLength * 32) - freeSlots;
+}
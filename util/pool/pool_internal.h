@@ -39,6 +39,121 @@
 extern "C" {
 #endif
 
+#define PUDDLE_BITS(puddle) ((uint32_t *) ((J9PoolPuddle *) (puddle) + 1))
+#define POOL_PUDDLE_BITS_LEN(pool) (((pool)->elementsPerPuddle+31) / 32)
+
+/* HOLE_FREQUENCY defines how often a hole appears - there is a hole every HOLE_FREQUENCY elements. Must be power of two. */
+#define HOLE_FREQUENCY	16
+#define ELEMENT_IS_HOLE(pool, element) (((pool)->flags & POOL_USES_HOLES) && ((uintptr_t) (element) % ((pool)->elementSize*HOLE_FREQUENCY) == 0))
+
+/* Number of element caches in a POOL_CONCURRENT pool; threads beyond this share them. */
+#define POOL_THREAD_CACHES 64
+/* Elements a cache takes from the shared free list at a time. */
+#define POOL_THREAD_CACHE_BATCH 32
+/* A cache holding more free elements than this returns them all to the shared free list. */
+#define POOL_THREAD_CACHE_MAX 64
+#define POOL_CACHE_LINE_SIZE 64
+
+/**
+ * Free elements held for the threads mapped to one slot of a POOL_CONCURRENT pool.
+ * A thread claims the cache for the duration of one newElement or removeElement call.
+ */
+typedef struct J9PoolThreadCache {
+	volatile uintptr_t claimed;
+	uintptr_t *freeList; /* free elements, linked through their first word */
+	uintptr_t *freeTail;
+	uintptr_t freeCount;
+	uint8_t padding[POOL_CACHE_LINE_SIZE - (4 * sizeof(uintptr_t))];
+} J9PoolThreadCache;
+
+/**
+ * Allocation state of a POOL_CONCURRENT pool, stored cache line aligned after its J9PoolPuddleList.
+ * The puddle free lists and the available puddle list are not used by these pools.
+ */
+typedef struct J9PoolConcurrentState {
+	volatile uintptr_t freeList; /* lock-free stack of free elements, linked through their first word */
+	uint8_t padding[POOL_CACHE_LINE_SIZE - sizeof(uintptr_t)];
+	J9PoolThreadCache caches[POOL_THREAD_CACHES];
+} J9PoolConcurrentState;
+
+#define POOL_CONCURRENT_STATE_ALLOC_SIZE (sizeof(J9PoolConcurrentState) + POOL_CACHE_LINE_SIZE)
+#define POOL_CONCURRENT_STATE(puddleList) ((J9PoolConcurrentState *) ((((uintptr_t) ((J9PoolPuddleList *) (puddleList) + 1)) + POOL_CACHE_LINE_SIZE - 1) & ~(uintptr_t)(POOL_CACHE_LINE_SIZE - 1)))
+
+/* ---------------- pool.c ---------------- */
+
+/**
+ * @param[in] pool    The pool containing the element.
+ * @param[in] element The element for which the puddle SRP pointer is being queried.
+ *
+ * @return A pointer to the SRP to the puddle containing the specified element.
+ */
+J9SRP *
+pool_getElementPuddleSRP(J9Pool *pool, void *element);
+
+/**
+ * @param[in] pool    The pool containing the specified puddle and element.
+ * @param[in] puddle  The puddle containing the specified element.
+ * @param[in] element The element whose slot index is being queried.
+ *
+ * @return The element's index in the puddle, or -1 if the element is not in the puddle.
+ */
+int32_t
+pool_getElementPuddleSlot(J9Pool *pool, J9PoolPuddle *puddle, void *element);
+
+/* ---------------- pool_concurrent.cpp ---------------- */
+
+/**
+ * Empty the element caches and the shared free list of a POOL_CONCURRENT pool, then
+ * make every free slot of its (freshly initialized) puddles available again.
+ *
+ * @param[in] pool The pool to reset. Must not be in use by other threads.
+ */
+void
+poolConcurrent_reset(J9Pool *pool);
+
+/**
+ * Make the free slots of a new puddle, already linked into the pool, available for allocation.
+ *
+ * @param[in] pool   The pool owning the puddle.
+ * @param[in] puddle A puddle initialized by poolPuddle_new.
+ */
+void
+poolConcurrent_addPuddle(J9Pool *pool, J9PoolPuddle *puddle);
+
+/**
+ * Allocate an element from a POOL_CONCURRENT pool. Safe to call from any number of threads.
+ *
+ * @param[in] pool The pool to allocate from.
+ *
+ * @return The new element, or NULL if a new puddle was needed and could not be allocated.
+ */
+void *
+poolConcurrent_newElement(J9Pool *pool);
+
+/**
+ * Return an element to a POOL_CONCURRENT pool. Safe to call from any number of threads.
+ *
+ * @param[in] pool    The pool owning the element.
+ * @param[in] puddle  The puddle containing the element.
+ * @param[in] slot    The element's slot in the puddle.
+ * @param[in] element The element to free.
+ *
+ * @return TRUE if the element was freed, FALSE if the slot was already free.
+ */
+uintptr_t
+poolConcurrent_removeElement(J9Pool *pool, J9PoolPuddle *puddle, int32_t slot, void *element);
+
+/**
+ * Count the allocated elements in a puddle of a POOL_CONCURRENT pool from its slot bits,
+ * which are exact whenever no other thread is allocating or freeing.
+ *
+ * @param[in] pool   The pool owning the puddle.
+ * @param[in] puddle The puddle to count.
+ *
+ * @return The number of allocated elements in the puddle.
+ */
+uintptr_t
+poolConcurrent_usedElements(J9Pool *pool, J9PoolPuddle *puddle);
 
 #ifdef __cplusplus
 }